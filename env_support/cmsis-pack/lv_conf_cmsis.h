@@ -1078,7 +1078,7 @@
     /** 1: Enable the built-in profiler */
     #define LV_USE_PROFILER_BUILTIN 1
     #if LV_USE_PROFILER_BUILTIN
-        /** Default profiler trace buffer size */
+        /** Default profiler trace buffer size of each profiled thread */
         #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /**< [bytes] */
         #define LV_PROFILER_BUILTIN_DEFAULT_ENABLE 1
         #define LV_USE_PROFILER_BUILTIN_POSIX 0 /**< Enable POSIX profiler port */
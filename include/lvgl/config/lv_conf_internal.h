@@ -62,6 +62,7 @@
 #define LV_DRAW_SW_ASM_NEON      1
 #define LV_DRAW_SW_ASM_HELIUM    2
 #define LV_DRAW_SW_ASM_RISCV_V   3
+#define LV_DRAW_SW_ASM_X86_AVX2  4
 #define LV_DRAW_SW_ASM_CUSTOM    255
 
 /* VG-Lite GPU (series and revision) */
@@ -236,6 +237,22 @@
     #endif
 #endif
 
+#ifndef LV_USE_MEM_SLAB
+    #ifdef CONFIG_LV_USE_MEM_SLAB
+        #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+    #else
+        #define LV_USE_MEM_SLAB 0
+    #endif
+#endif
+
+#ifndef LV_MEM_SLAB_SPAN_SIZE
+    #ifdef CONFIG_LV_MEM_SLAB_SPAN_SIZE
+        #define LV_MEM_SLAB_SPAN_SIZE CONFIG_LV_MEM_SLAB_SPAN_SIZE
+    #else
+        #define LV_MEM_SLAB_SPAN_SIZE 4096
+    #endif
+#endif
+
 #ifndef LV_STDINT_INCLUDE
     #ifdef CONFIG_LV_STDINT_INCLUDE
         #define LV_STDINT_INCLUDE CONFIG_LV_STDINT_INCLUDE
@@ -412,6 +429,14 @@
     #endif
 #endif
 
+#ifndef LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_ARENA_CHUNK_SIZE
+        #define LV_DRAW_TASK_ARENA_CHUNK_SIZE CONFIG_LV_DRAW_TASK_ARENA_CHUNK_SIZE
+    #else
+        #define LV_DRAW_TASK_ARENA_CHUNK_SIZE 4096
+    #endif
+#endif
+
 #ifndef LV_DRAW_THREAD_STACK_SIZE
     #ifdef CONFIG_LV_DRAW_THREAD_STACK_SIZE
         #define LV_DRAW_THREAD_STACK_SIZE CONFIG_LV_DRAW_THREAD_STACK_SIZE
@@ -676,6 +701,14 @@
     #endif
 #endif
 
+#ifndef LV_DRAW_SW_SHADOW_CACHE_CNT
+    #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+    #else
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+    #endif
+#endif
+
 #ifndef LV_DRAW_SW_CIRCLE_CACHE_SIZE
     #ifdef CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
@@ -1216,6 +1249,30 @@
     #endif
 #endif
 
+#ifndef LV_OBJ_STYLE_VALUE_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_VALUE_CACHE
+        #define LV_OBJ_STYLE_VALUE_CACHE CONFIG_LV_OBJ_STYLE_VALUE_CACHE
+    #else
+        #define LV_OBJ_STYLE_VALUE_CACHE 0
+    #endif
+#endif
+
+#ifndef LV_USE_OBJ_HIT_INDEX
+    #ifdef CONFIG_LV_USE_OBJ_HIT_INDEX
+        #define LV_USE_OBJ_HIT_INDEX CONFIG_LV_USE_OBJ_HIT_INDEX
+    #else
+        #define LV_USE_OBJ_HIT_INDEX 0
+    #endif
+#endif
+
+#ifndef LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    #ifdef CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILDREN
+        #define LV_OBJ_HIT_INDEX_MIN_CHILDREN CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILDREN
+    #else
+        #define LV_OBJ_HIT_INDEX_MIN_CHILDREN 32
+    #endif
+#endif
+
 #ifndef LV_USE_OBJ_NAME
     #ifdef CONFIG_LV_USE_OBJ_NAME
         #define LV_USE_OBJ_NAME CONFIG_LV_USE_OBJ_NAME
@@ -1604,6 +1661,38 @@
     #endif
 #endif
 
+#ifndef LV_CACHE_SHARD_CNT
+    #ifdef CONFIG_LV_CACHE_SHARD_CNT
+        #define LV_CACHE_SHARD_CNT CONFIG_LV_CACHE_SHARD_CNT
+    #else
+        #define LV_CACHE_SHARD_CNT 1
+    #endif
+#endif
+
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+
+#ifndef LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+    #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+    #else
+        #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+    #endif
+#endif
+
+#ifndef LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+    #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+        #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+    #else
+        #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (32 * 1024)
+    #endif
+#endif
+
 #ifndef LV_USE_RLE
     #ifdef CONFIG_LV_USE_RLE
         #define LV_USE_RLE CONFIG_LV_USE_RLE
@@ -2058,6 +2147,38 @@
     #endif
 #endif
 
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+#ifndef LV_FONT_FMT_TXT_GID_CACHE_CNT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+        #define LV_FONT_FMT_TXT_GID_CACHE_CNT CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+    #else
+        #define LV_FONT_FMT_TXT_GID_CACHE_CNT 0
+    #endif
+#endif
+
+#ifndef LV_BINFONT_ZERO_COPY
+    #ifdef CONFIG_LV_BINFONT_ZERO_COPY
+        #define LV_BINFONT_ZERO_COPY CONFIG_LV_BINFONT_ZERO_COPY
+    #else
+        #define LV_BINFONT_ZERO_COPY 0
+    #endif
+#endif
+
+#ifndef LV_BINFONT_CACHE_SIZE
+    #ifdef CONFIG_LV_BINFONT_CACHE_SIZE
+        #define LV_BINFONT_CACHE_SIZE CONFIG_LV_BINFONT_CACHE_SIZE
+    #else
+        #define LV_BINFONT_CACHE_SIZE 0
+    #endif
+#endif
+
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_FONT_PLACEHOLDER
@@ -2712,6 +2833,18 @@
     #endif
 #endif
 
+#ifndef LV_LABEL_LINE_CACHE
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_LABEL_LINE_CACHE
+            #define LV_LABEL_LINE_CACHE CONFIG_LV_LABEL_LINE_CACHE
+        #else
+            #define LV_LABEL_LINE_CACHE 0
+        #endif
+    #else
+          #define LV_LABEL_LINE_CACHE LV_USE_LABEL
+    #endif
+#endif
+
 #ifndef LV_LABEL_WAIT_CHAR_COUNT
     #ifdef CONFIG_LV_LABEL_WAIT_CHAR_COUNT
         #define LV_LABEL_WAIT_CHAR_COUNT CONFIG_LV_LABEL_WAIT_CHAR_COUNT
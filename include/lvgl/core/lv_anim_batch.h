@@ -0,0 +1,193 @@
+/**
+ * @file lv_anim_batch.h
+ *
+ */
+
+#ifndef LV_ANIM_BATCH_H
+#define LV_ANIM_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_anim.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Maximal number of values animated together for an item of an animation batch*/
+#define LV_ANIM_BATCH_CHANNEL_MAX   4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Apply the values of an item. Called once in an animation step for each item whose values changed,
+ * so e.g. an x and y channel can be set with a single `lv_obj_set_pos()` and the widget is invalidated only once.
+ * @param batch     pointer to the animation batch
+ * @param index     index of the item
+ * @param var       the variable of the item
+ * @param values    the new value of each channel
+ */
+typedef void (*lv_anim_batch_exec_cb_t)(lv_anim_batch_t * batch, uint32_t index, void * var, const int32_t * values);
+
+/** Called when all the items of an animation batch are completed*/
+typedef void (*lv_anim_batch_completed_cb_t)(lv_anim_batch_t * batch);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create an animation batch: many animations with the same path and callback, whose times
+ * and values are stored in arrays and evaluated together in each animation step.
+ * It's much faster than starting an `lv_anim_t` for each variable when there are hundreds of them.
+ * @param channel_cnt   number of values animated together for each item [1..LV_ANIM_BATCH_CHANNEL_MAX]
+ * @return              pointer to the animation batch, NULL on error
+ */
+lv_anim_batch_t * lv_anim_batch_create(uint32_t channel_cnt);
+
+/**
+ * Delete an animation batch. Shouldn't be called from its `exec_cb`.
+ * @param batch     pointer to an animation batch
+ */
+void lv_anim_batch_delete(lv_anim_batch_t * batch);
+
+/**
+ * Add an item to an animation batch. The values of all channels are 0 by default.
+ * If the batch is running the item starts right away.
+ * @param batch     pointer to an animation batch
+ * @param var       the variable to animate, passed to `exec_cb`
+ * @param duration  duration of the animation in milliseconds
+ * @param delay     delay before starting the animation in milliseconds
+ * @return          index of the new item or -1 on error
+ */
+int32_t lv_anim_batch_add(lv_anim_batch_t * batch, void * var, uint32_t duration, uint32_t delay);
+
+/**
+ * Set the start and end value of a channel of an item
+ * @param batch     pointer to an animation batch
+ * @param index     index of the item
+ * @param channel   index of the channel
+ * @param start     the start value
+ * @param end       the end value
+ */
+void lv_anim_batch_set_values(lv_anim_batch_t * batch, uint32_t index, uint32_t channel, int32_t start, int32_t end);
+
+/**
+ * Remove all the items of an animation batch
+ * @param batch     pointer to an animation batch
+ */
+void lv_anim_batch_clear(lv_anim_batch_t * batch);
+
+/**
+ * Set a function to apply the values of the items
+ * @param batch     pointer to an animation batch
+ * @param exec_cb   the callback
+ */
+void lv_anim_batch_set_exec_cb(lv_anim_batch_t * batch, lv_anim_batch_exec_cb_t exec_cb);
+
+/**
+ * Set the path (curve) of all the items. The built-in `lv_anim_path_...` functions are sampled once
+ * so the items are evaluated without calling the path in each step. A custom path should depend
+ * only on the ratio of `act_time` and `duration`.
+ * @param batch     pointer to an animation batch
+ * @param path_cb   a function to set the current value of an animation, e.g. `lv_anim_path_ease_in`
+ */
+void lv_anim_batch_set_path_cb(lv_anim_batch_t * batch, lv_anim_path_cb_t path_cb);
+
+/**
+ * Set the parameters of the cubic-bezier curve for `lv_anim_path_custom_bezier3`
+ * @param batch     pointer to an animation batch
+ * @param x1        first control point X
+ * @param y1        first control point Y
+ * @param x2        second control point X
+ * @param y2        second control point Y
+ */
+void lv_anim_batch_set_bezier3_param(lv_anim_batch_t * batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Make the items repeat
+ * @param batch     pointer to an animation batch
+ * @param cnt       number of times each item plays, or `LV_ANIM_REPEAT_INFINITE`
+ */
+void lv_anim_batch_set_repeat_count(lv_anim_batch_t * batch, uint32_t cnt);
+
+/**
+ * Set a delay before repeating the items
+ * @param batch     pointer to an animation batch
+ * @param delay     delay in milliseconds
+ */
+void lv_anim_batch_set_repeat_delay(lv_anim_batch_t * batch, uint32_t delay);
+
+/**
+ * Set a function to call when all the items are completed. The batch can be deleted from it.
+ * @param batch         pointer to an animation batch
+ * @param completed_cb  the callback
+ */
+void lv_anim_batch_set_completed_cb(lv_anim_batch_t * batch, lv_anim_batch_completed_cb_t completed_cb);
+
+/**
+ * Set the user data of an animation batch
+ * @param batch     pointer to an animation batch
+ * @param user_data pointer to any data
+ */
+void lv_anim_batch_set_user_data(lv_anim_batch_t * batch, void * user_data);
+
+/**
+ * Start or restart all the items of an animation batch. The start values are applied immediately.
+ * @param batch     pointer to an animation batch
+ */
+void lv_anim_batch_start(lv_anim_batch_t * batch);
+
+/**
+ * Stop an animation batch. The items keep their current values.
+ * @param batch     pointer to an animation batch
+ */
+void lv_anim_batch_stop(lv_anim_batch_t * batch);
+
+/**
+ * Check if an animation batch is running
+ * @param batch     pointer to an animation batch
+ * @return          true: running; false: stopped or completed
+ */
+bool lv_anim_batch_is_running(const lv_anim_batch_t * batch);
+
+/**
+ * Get the number of items of an animation batch
+ * @param batch     pointer to an animation batch
+ * @return          the number of items
+ */
+uint32_t lv_anim_batch_get_count(const lv_anim_batch_t * batch);
+
+/**
+ * Get the current value of a channel of an item
+ * @param batch     pointer to an animation batch
+ * @param index     index of the item
+ * @param channel   index of the channel
+ * @return          the current value
+ */
+int32_t lv_anim_batch_get_value(const lv_anim_batch_t * batch, uint32_t index, uint32_t channel);
+
+/**
+ * Get the user data of an animation batch
+ * @param batch     pointer to an animation batch
+ * @return          the user data
+ */
+void * lv_anim_batch_get_user_data(const lv_anim_batch_t * batch);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ANIM_BATCH_H*/
@@ -380,6 +380,7 @@ typedef struct {
 
     uint32_t has_group;
     uint8_t prop_cnt;   /**< 255 means it's a constant style*/
+    uint8_t frozen;     /**< 1: the properties are sorted by ID. See ::lv_style_freeze*/
 } lv_style_t;
 
 /**********************
@@ -427,6 +428,16 @@ void lv_style_copy(lv_style_t * dst, const lv_style_t * src);
  */
 void lv_style_merge(lv_style_t * dst, const lv_style_t * src);
 
+/**
+ * Sort the properties of a style by their ID so that they can be looked up with a binary search.
+ * Use it on styles with many properties which are read often, e.g. the styles of a theme.
+ * A frozen style still can be modified with `lv_style_set_...` and ::lv_style_remove_prop,
+ * the properties are kept sorted.
+ * ::lv_style_reset and ::lv_style_copy make the style unfrozen.
+ * @param style     pointer to an initialized, non-constant style
+ */
+void lv_style_freeze(lv_style_t * style);
+
 
 /**
  * Check if a style is constant
@@ -541,6 +552,23 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
             }
         }
     }
+    else if(style->frozen) {
+        /*The properties are sorted so find the last one which is <= `prop`*/
+        uint32_t n = style->prop_cnt;
+        if(n == 0) return LV_STYLE_RES_NOT_FOUND;
+        lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + n * sizeof(lv_style_value_t);
+        const lv_style_prop_t * base = props;
+        while(n > 1) {
+            uint32_t half = n / 2;
+            base = base[half] <= prop ? base + half : base;
+            n -= half;
+        }
+        if(*base == prop) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[base - props];
+            return LV_STYLE_RES_FOUND;
+        }
+    }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint32_t i;
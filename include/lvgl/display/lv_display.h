@@ -78,6 +78,18 @@ typedef enum {
     LV_SCREEN_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/** Counters of a rendered frame to see how much of the redrawn area was really invalidated
+ * and how much layout work was done for it*/
+typedef struct {
+    uint32_t inv_area_cnt;      /**< Number of areas invalidated by `lv_inv_area()`*/
+    uint32_t inv_px_cnt;        /**< Sum of the size of the invalidated areas*/
+    uint32_t refr_area_cnt;     /**< Number of areas rendered after joining the invalidated areas*/
+    uint32_t refr_px_cnt;       /**< Number of rendered pixels*/
+    uint32_t layout_pass_cnt;   /**< Number of passes over the widget trees to update the layouts*/
+    uint32_t layout_obj_cnt;    /**< Number of widgets whose size and position were recalculated*/
+    uint32_t layout_apply_cnt;  /**< Number of times a layout (e.g. flex or grid) was applied to a container*/
+} lv_display_refr_stats_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 typedef void (*lv_display_sync_cb_t)(lv_display_t * disp, const lv_area_t * area);
@@ -650,6 +662,16 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+/**
+ * Get the invalidated and rendered areas and pixels of the last rendered frame.
+ * `refr_px_cnt` larger than `inv_px_cnt` means some pixels were redrawn only
+ * because invalidated areas were joined.
+ * The layout counters contain the layout updates since the previous rendered frame.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param stats     store the counters here
+ */
+void lv_display_get_refr_stats(lv_display_t * disp, lv_display_refr_stats_t * stats);
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -99,6 +99,9 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Last draw task of the list to append new tasks without walking the list */
+    lv_draw_task_t * draw_task_tail;
+
     /** Parent layer */
     lv_layer_t * parent;
 
@@ -124,14 +127,27 @@ struct _lv_layer_t  {
      */
     lv_area_t _clip_area;
 
+    /**
+     * USED INTERNALLY DURING DISPATCHING.
+     * The draw task returned last time by `lv_draw_get_next_available_task()` and the tiles
+     * covered by the unfinished draw tasks before it. Allows continuing the search without
+     * walking the draw task list from the beginning again.
+     */
+    lv_draw_task_t * _dispatch_cursor;
+    uint64_t _dispatch_busy_tiles;
+
+    /**
+     * USED INTERNALLY DURING DISPATCHING.
+     * The furthest draw task reached while looking for available draw tasks. The tasks after it
+     * were never given to a draw unit so removing the finished tasks can stop here.
+     */
+    lv_draw_task_t * _dispatch_frontier;
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /** Transform matrix to be applied when rendering the layer */
     lv_matrix_t matrix;
 #endif
 
-    /** Partial y offset */
-    int32_t partial_y_offset;
-
     /** Recolor of the layer */
     lv_color32_t recolor;
 
@@ -107,6 +107,10 @@ typedef struct {
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
+    /**Line breaks and widths of the text calculated in advance (e.g. by the label widget).
+     * Used instead of wrapping the text again if it was calculated for the same text and wrapping. Can be NULL.*/
+    const lv_draw_label_lines_t * lines;
+
     /* Properties of the letter outlines */
     lv_color_t outline_stroke_color;
     int32_t outline_stroke_width;
@@ -76,6 +76,12 @@ typedef enum _lvimage_flags_t {
      */
     LV_IMAGE_FLAGS_CUSTOM_DRAW      = 0x0040,
 
+    /**
+     * The decoder can decode the image at 1/2, 1/4 or 1/8 of its size.
+     * See `downscale` in `lv_image_decoder_args_t`.
+     */
+    LV_IMAGE_FLAGS_DOWNSCALABLE     = 0x0080,
+
     /**
      * Flags reserved for user, lvgl won't use these bits.
      */
@@ -44,6 +44,17 @@ LV_ATTRIBUTE_EXTERN_DATA extern const lv_font_class_t lv_binfont_font_class;
  */
 lv_font_t * lv_binfont_create(const char * path);
 
+/**
+ * Loads a `lv_font_t` object from a binary font file with a given size of glyph bitmap cache.
+ * `lv_binfont_create` uses `LV_BINFONT_CACHE_SIZE`.
+ * @param path          path to font file
+ * @param cache_size    size of the glyph bitmap cache in bytes. If not 0 the bitmaps are read
+ *                      from the file when they are drawn and the file is kept open until
+ *                      the font is destroyed. 0: load all the bitmaps now.
+ * @return              pointer to font where to load
+ */
+lv_font_t * lv_binfont_create_ex(const char * path, uint32_t cache_size);
+
 #if LV_USE_FS_MEMFS
 /**
  * Loads a `lv_font_t` object from a memory buffer containing the binary font file.
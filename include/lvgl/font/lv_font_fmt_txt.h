@@ -224,6 +224,13 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Drop the decompressed glyphs and glyph ids cached for the fmt_txt fonts
+ * (`LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE` and `LV_FONT_FMT_TXT_GID_CACHE_CNT`).
+ * Call it when the data of a font is modified or freed. Binary fonts call it when they are destroyed.
+ */
+void lv_font_fmt_txt_cache_invalidate(void);
+
 /**********************
  *      MACROS
  **********************/
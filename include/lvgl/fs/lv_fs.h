@@ -85,6 +85,9 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
     lv_fs_res_t (*dir_close_cb)(lv_fs_drv_t * drv, void * rddir_p);
 
+    const void * (*map_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * size); /*Optional*/
+    void (*unmap_cb)(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size); /*Optional*/
+
     void * user_data; /**< Custom file user data*/
 };
 
@@ -231,6 +234,25 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map the whole content of a file into the memory to read it without copying.
+ * Files created with ::lv_fs_make_path_from_buffer are always mapped to their buffer,
+ * other drivers need to implement `map_cb`.
+ * @param file_p    pointer to a lv_fs_file_t variable opened for reading
+ * @param size      pointer to store the size of the mapped content
+ * @return          pointer to the content, or NULL if the file can't be mapped.
+ *                  It's valid until ::lv_fs_unmap is called and must not be written.
+ */
+const void * lv_fs_map(lv_fs_file_t * file_p, uint32_t * size);
+
+/**
+ * Release the content of a file mapped by ::lv_fs_map. It must be called before closing the file.
+ * @param file_p    pointer to the lv_fs_file_t variable used with ::lv_fs_map
+ * @param buf       the pointer returned by ::lv_fs_map
+ * @param size      the size returned by ::lv_fs_map
+ */
+void lv_fs_unmap(lv_fs_file_t * file_p, const void * buf, uint32_t size);
+
 /**
  * Get the size in bytes of an open file.
  * The file read/write position will not be affected.
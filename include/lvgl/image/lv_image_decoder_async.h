@@ -0,0 +1,86 @@
+/**
+ * @file lv_image_decoder_async.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_H
+#define LV_IMAGE_DECODER_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../config/lv_conf_internal.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "../lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Called in the LVGL thread when an image requested by `lv_image_decoder_async_request()` is decoded
+ * @param src       the image source
+ * @param res       LV_RESULT_OK: the image is decoded and in the image cache;
+ *                  LV_RESULT_INVALID: the image couldn't be decoded
+ * @param user_data the `user_data` passed to `lv_image_decoder_async_request()`
+ */
+typedef void (*lv_image_decoder_async_ready_cb_t)(const void * src, lv_result_t res, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Decode an image in a background thread and put it into the image cache.
+ * Call it before loading a screen to have its images ready when they are drawn first.
+ * @param src   the image source. A file path or pointer to an `lv_image_dsc_t` variable.
+ * @return      LV_RESULT_OK: the image is queued or it's already in the cache;
+ *              LV_RESULT_INVALID: the source is invalid, the image cache is disabled or out of memory
+ */
+lv_result_t lv_image_decoder_prefetch(const void * src);
+
+/**
+ * Check if an image is decoded and request its decoding in a background thread if not.
+ * A source is decoded only once even if it's requested several times.
+ * @param src       the image source. A file path or pointer to an `lv_image_dsc_t` variable.
+ * @param ready_cb  called in the LVGL thread when the image is decoded. Not called if `true` is returned.
+ * @param user_data passed to `ready_cb`
+ * @return          true: the image is in the image cache or it can't be decoded in the background
+ *                  so it should be drawn directly; false: the decoding is pending, wait for `ready_cb`.
+ */
+bool lv_image_decoder_async_request(const void * src, lv_image_decoder_async_ready_cb_t ready_cb, void * user_data);
+
+/**
+ * Remove the pending `ready_cb`s registered with a `user_data`. The decoding itself is not stopped.
+ * @param ready_cb  the callback to remove
+ * @param user_data the `user_data` passed to `lv_image_decoder_async_request()`
+ */
+void lv_image_decoder_async_cancel(lv_image_decoder_async_ready_cb_t ready_cb, void * user_data);
+
+/**
+ * Get the number of images which are queued, being decoded or whose `ready_cb`s weren't called yet.
+ * @return      the number of pending images
+ */
+uint32_t lv_image_decoder_async_get_pending_count(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_H*/
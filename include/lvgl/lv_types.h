@@ -134,6 +134,8 @@ typedef struct _lv_anim_t lv_anim_t;
 
 typedef struct _lv_anim_timeline_t lv_anim_timeline_t;
 
+typedef struct _lv_anim_batch_t lv_anim_batch_t;
+
 typedef struct _lv_font_t lv_font_t;
 typedef struct _lv_font_class_t lv_font_class_t;
 typedef struct _lv_font_info_t lv_font_info_t;
@@ -164,10 +166,14 @@ typedef struct _lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct _lv_image_header_cache_data_t lv_image_header_cache_data_t;
 
+typedef struct _lv_image_decoder_async_t lv_image_decoder_async_t;
+
 typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_draw_label_hint_t lv_draw_label_hint_t;
 
+typedef struct _lv_draw_label_lines_t lv_draw_label_lines_t;
+
 typedef struct _lv_draw_glyph_dsc_t lv_draw_glyph_dsc_t;
 
 typedef struct _lv_draw_image_sup_t lv_draw_image_sup_t;
@@ -226,6 +232,8 @@ typedef struct _lv_led_t lv_led_t;
 
 typedef struct _lv_line_t lv_line_t;
 
+typedef struct _lv_list_t lv_list_t;
+
 typedef struct _lv_menu_load_page_event_data_t lv_menu_load_page_event_data_t;
 
 typedef struct _lv_menu_history_t lv_menu_history_t;
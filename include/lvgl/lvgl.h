@@ -12,6 +12,7 @@
 #include "config/lv_conf_kconfig.h"
 #include "core/lv_anim.h"
 #include "core/lv_anim_timeline.h"
+#include "core/lv_anim_batch.h"
 #include "core/lv_area.h"
 #include "core/lv_event.h"
 #include "core/lv_ext_data.h"
@@ -138,6 +139,7 @@
 #include "image/lv_libwebp.h"
 #include "image/lv_lodepng.h"
 #include "image/lv_image_decoder.h"
+#include "image/lv_image_decoder_async.h"
 #include "image/lv_svg.h"
 #include "image/lv_tjpgd.h"
 #include "indev/lv_gridnav.h"
@@ -21,6 +21,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of bins of `lv_mem_monitor_t::size_histogram`*/
+#define LV_MEM_SIZE_HISTOGRAM_CNT   10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,6 +42,13 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+    size_t draw_task_arena_size;        /**< Memory kept by the draw task arena */
+    uint32_t draw_task_arena_alloc_cnt; /**< Draw task allocations served by the arena instead of `lv_malloc` in the last frame */
+    size_t slab_size;                   /**< Memory taken from the heap for the small object slabs (`LV_USE_MEM_SLAB`) */
+    size_t slab_free_size;              /**< Free blocks cached in the slabs */
+    /** Number of `lv_malloc` calls by requested size since `lv_init` (`LV_USE_MEM_SLAB`).
+     *  The bins are <=16, <=32, <=64, ... <=4096 bytes and the last one counts the larger sizes. */
+    uint32_t size_histogram[LV_MEM_SIZE_HISTOGRAM_CNT];
 } lv_mem_monitor_t;
 
 /**********************
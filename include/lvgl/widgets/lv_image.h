@@ -221,6 +221,25 @@ void lv_image_set_inner_align(lv_obj_t * obj, lv_image_align_t align);
  */
 void lv_image_set_bitmap_map_src(lv_obj_t * obj, const lv_image_dsc_t * src);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Decode the image in a background thread instead of decoding it when it's drawn first.
+ * Until the image is decoded the placeholder is drawn.
+ * @param obj       pointer to an image object
+ * @param en        true: decode asynchronously; false: decode when drawn (default)
+ * @note            the image is drawn directly if it's evicted from the image cache later.
+ */
+void lv_image_set_decode_async(lv_obj_t * obj, bool en);
+
+/**
+ * Set an image to draw while the image is being decoded in the background.
+ * It's stretched to the size of the image, so a small, low resolution preview can be used too.
+ * @param obj       pointer to an image object
+ * @param src       a quickly decodable image, e.g. a C array; NULL to draw nothing meanwhile
+ */
+void lv_image_set_placeholder_src(lv_obj_t * obj, const lv_image_dsc_t * src);
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /*=====================
  * Getter functions
  *====================*/
@@ -340,6 +359,29 @@ lv_image_align_t lv_image_get_inner_align(lv_obj_t * obj);
  */
 const lv_image_dsc_t * lv_image_get_bitmap_map_src(lv_obj_t * obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Get whether the image is decoded in a background thread.
+ * @param obj       pointer to an image object
+ * @return          true: decoded asynchronously
+ */
+bool lv_image_get_decode_async(lv_obj_t * obj);
+
+/**
+ * Get the placeholder image drawn while the image is being decoded.
+ * @param obj       pointer to an image object
+ * @return          the placeholder image or NULL
+ */
+const lv_image_dsc_t * lv_image_get_placeholder_src(lv_obj_t * obj);
+
+/**
+ * Check if the image is still being decoded in the background and the placeholder is drawn instead.
+ * @param obj       pointer to an image object
+ * @return          true: the decoding is pending
+ */
+bool lv_image_is_decode_pending(lv_obj_t * obj);
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 
 #if LV_USE_OBSERVER
 /**
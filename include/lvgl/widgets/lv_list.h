@@ -24,11 +24,29 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#define LV_LIST_ITEM_NONE 0xFFFFFFFF
+LV_EXPORT_CONST_INT(LV_LIST_ITEM_NONE);
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Create an item widget of a virtual list.
+ * @param list      pointer to a list, it needs to be the parent of the new widget
+ * @return          the created item widget
+ */
+typedef lv_obj_t * (*lv_list_item_create_cb_t)(lv_obj_t * list);
+
+/**
+ * Show an item of a virtual list in an item widget. Item widgets are reused for other items
+ * when they are scrolled out, so everything which depends on the item needs to be set here.
+ * @param list      pointer to a list
+ * @param item      pointer to an item widget
+ * @param index     index of the item to show [0 .. item count - 1]
+ */
+typedef void (*lv_list_item_bind_cb_t)(lv_obj_t * list, lv_obj_t * item, uint32_t index);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_text_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_button_class;
@@ -76,6 +94,60 @@ const char * lv_list_get_button_text(lv_obj_t * list, lv_obj_t * btn);
  */
 void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt);
 
+/**
+ * Make the list virtual: instead of a widget for each item, only enough widgets are created to cover the
+ * visible area, and they are reused for other items as the list is scrolled.
+ * The list should have no other children. The items are placed below each other without flex layout.
+ * @param list          pointer to a list
+ * @param create_cb     creates the item widgets, NULL to create list buttons without icon
+ * @param bind_cb       shows an item in an item widget, NULL to remove the item widgets and use flex layout again
+ */
+void lv_list_set_item_cb(lv_obj_t * list, lv_list_item_create_cb_t create_cb, lv_list_item_bind_cb_t bind_cb);
+
+/**
+ * Set the number of items of a virtual list.
+ * @param list      pointer to a list
+ * @param cnt       number of items
+ */
+void lv_list_set_item_count(lv_obj_t * list, uint32_t cnt);
+
+/**
+ * Set the height of the items of a virtual list. All the items need to have the same height.
+ * @param list      pointer to a list
+ * @param h         height of the item widgets, 0: keep the height of the item widgets
+ *                  and measure it on the first item
+ */
+void lv_list_set_item_height(lv_obj_t * list, int32_t h);
+
+/**
+ * Show the items of a virtual list again, e.g. because the data of the items has changed.
+ * @param list      pointer to a list
+ */
+void lv_list_refresh_items(lv_obj_t * list);
+
+/**
+ * Get the number of items of a virtual list.
+ * @param list      pointer to a list
+ * @return          number of items
+ */
+uint32_t lv_list_get_item_count(lv_obj_t * list);
+
+/**
+ * Get the index of the item shown in an item widget of a virtual list.
+ * @param list      pointer to a list
+ * @param item      pointer to an item widget, or one of its children
+ * @return          index of the item, or `LV_LIST_ITEM_NONE` if it's not an item widget or it's not used now
+ */
+uint32_t lv_list_get_item_index(lv_obj_t * list, lv_obj_t * item);
+
+/**
+ * Get the widget which shows an item of a virtual list.
+ * @param list      pointer to a list
+ * @param index     index of an item
+ * @return          the item widget, or NULL if the item is not shown now
+ */
+lv_obj_t * lv_list_get_item(lv_obj_t * list, uint32_t index);
+
 #if LV_USE_TRANSLATION
 
 /**
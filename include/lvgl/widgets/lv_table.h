@@ -44,6 +44,17 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Provide the text of a cell in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param row       id of the row [0 .. row_cnt -1]
+ * @param col       id of the column [0 .. col_cnt -1]
+ * @return          text of the cell or NULL if it's empty. It's used only until the next call,
+ *                  so it can be in a static buffer.
+ * @note            it's called while drawing the Table, so the widgets shouldn't be modified in it
+ */
+typedef const char * (*lv_table_cell_text_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 #if LV_USE_OBJ_PROPERTY
@@ -142,6 +153,26 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
  */
 void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, void * user_data);
 
+/**
+ * Make the Table virtual: the texts are not stored but provided by a callback when the cells are drawn.
+ * The stored texts, control bits and user data of the cells are deleted.
+ * The rows are not measured in advance, only when they are scrolled in,
+ * so it's suitable for very large tables. It works best if the Table has a fixed height and scrolls itself.
+ * @param obj       pointer to a Table object
+ * @param cb        the callback to provide the texts or NULL to store the texts in the Table again
+ * @note            merging and cropping cells with control bits are not supported in virtual mode
+ */
+void lv_table_set_cell_text_cb(lv_obj_t * obj, lv_table_cell_text_cb_t cb);
+
+/**
+ * Set the height of the rows in virtual mode.
+ * @param obj       pointer to a Table object
+ * @param h         height of the rows, or 0 to use the height of one line of text with the paddings of the cells
+ * @param fixed     true: all the rows have this height and they are never measured;
+ *                  false: it's only an estimation for the rows which were not visible yet
+ */
+void lv_table_set_virtual_row_height(lv_obj_t * obj, int32_t h, bool fixed);
+
 /**
  * Set the selected cell
  * @param obj       pointer to a table object
@@ -163,6 +194,13 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
+/**
+ * Get the callback which provides the texts in virtual mode.
+ * @param obj       pointer to a Table object
+ * @return          the callback or NULL if the Table is not virtual
+ */
+lv_table_cell_text_cb_t lv_table_get_cell_text_cb(lv_obj_t * obj);
+
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
@@ -63,6 +63,14 @@
 
 #endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Serve small `lv_malloc()` requests (up to 256 bytes) from size class slabs with per-thread caches.
+ *  Works with any `LV_USE_STDLIB_MALLOC` and adds a size histogram to `lv_mem_monitor()`. */
+#define LV_USE_MEM_SLAB 0
+#if LV_USE_MEM_SLAB
+/** Size of the memory chunks taken from the heap and divided into small blocks [bytes] */
+#define LV_MEM_SLAB_SPAN_SIZE 4096
+#endif /*LV_USE_MEM_SLAB*/
+
 /** Header for integer types (stdint) */
 #define LV_STDINT_INCLUDE "stdint.h"
 
@@ -177,6 +185,12 @@
  */
 #define LV_DRAW_LAYER_MAX_MEMORY 0
 
+/** Draw tasks and their descriptors are allocated from chunks of this size (in bytes)
+ *  instead of allocating them one by one. When all draw tasks are finished only one chunk is kept.
+ *  Set it to 0 to allocate each draw task by `lv_malloc`.
+ */
+#define LV_DRAW_TASK_ARENA_CHUNK_SIZE 4096
+
 #if LV_USE_OS != LV_OS_NONE
 /** If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more. */
 #define LV_DRAW_THREAD_STACK_SIZE 8192
@@ -287,10 +301,16 @@
 #if LV_DRAW_SW_COMPLEX
 /** LV_DRAW_SW_SHADOW_CACHE_SIZE is the max shadow size to buffer, where
  *  shadow size is `shadow_width + radius`.
- *  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost.
+ *  Caching has at most LV_DRAW_SW_SHADOW_CACHE_CNT * LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost.
  */
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+/** Number of shadow corners to cache. They are identified by the shadow width, radius and
+ *  the size of the shadowed area, and the least recently used one is dropped if a new one is added.
+ *  Each corner uses at most LV_DRAW_SW_SHADOW_CACHE_SIZE^2 bytes.
+ */
+#define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+
 /** The circumference of 1/4 circle are saved for anti-aliasing
  *  radius * 4 bytes are used per circle (the most often used
  *  radiuses are saved).
@@ -306,6 +326,7 @@
  *  - LV_DRAW_SW_ASM_NEON
  *  - LV_DRAW_SW_ASM_HELIUM
  *  - LV_DRAW_SW_ASM_RISCV_V: RISC-V Vector
+ *  - LV_DRAW_SW_ASM_X86_AVX2: x86 SSE2, AVX2 if the compiler targets it
  *  - LV_DRAW_SW_ASM_CUSTOM
  */
 #define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_NONE
@@ -620,6 +641,20 @@
 /** Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE 0
 
+/** Cache the style properties resolved from the styles of the widgets by part and state.
+ *  The cache of a widget grows from 16 up to 128 entries of 12 bytes (on 32 bit systems)
+ *  as more properties are read.
+ *  Modifying a style requires calling `lv_obj_report_style_change()` to update the cache. */
+#define LV_OBJ_STYLE_VALUE_CACHE 0
+
+/** Sort the children of widgets with many children into a grid to find the pressed widget faster.
+ *  The grid is rebuilt on the next press after a child was added, moved or resized. */
+#define LV_USE_OBJ_HIT_INDEX 0
+#if LV_USE_OBJ_HIT_INDEX
+    /** Use the grid only for widgets with at least this many children */
+    #define LV_OBJ_HIT_INDEX_MIN_CHILDREN 32
+#endif
+
 /** Enable support for widget names */
 #define LV_USE_OBJ_NAME 0
 
@@ -796,6 +831,28 @@
  */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Split the image, image header and glyph caches into this many independently locked shards.
+ *  With several draw threads (e.g. `LV_DRAW_SW_DRAW_UNIT_CNT > 1`) it reduces the waiting for the cache locks.
+ *  Each shard gets an equal part of the cache size, so an image must fit in `LV_CACHE_DEF_SIZE / LV_CACHE_SHARD_CNT`.
+ *  1: no sharding
+ */
+#define LV_CACHE_SHARD_CNT 1
+
+/** Decode images in background threads into the image cache.
+ *  Image widgets with `lv_image_set_decode_async()` draw a placeholder until their image is decoded
+ *  and `lv_image_decoder_prefetch()` can decode the images of a screen before it's loaded.
+ *  Requires an OS (`LV_USE_OS`) and the image cache (`LV_CACHE_DEF_SIZE > 0`). */
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/** Number of image decoder threads */
+#define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+
+/** Stack size of the image decoder threads in bytes. libjpeg-turbo and libpng need 32KB or more. */
+#define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (32 * 1024)
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /** RLE decompress library */
 #define LV_USE_RLE 0
 
@@ -1064,6 +1121,26 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Size of the cache of the decompressed glyphs of the compressed built-in (fmt_txt) fonts in bytes.
+ *  0: decompress the glyphs every time they are drawn */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+
+/** Number of letter to glyph id pairs cached per thread for the built-in (fmt_txt) fonts
+ *  to avoid searching the character maps. Should be a power of 2, e.g. 64.
+ *  Works only without OS or with `LV_OS_PTHREAD` and `LV_OS_WINDOWS`.
+ *  0: don't cache */
+#define LV_FONT_FMT_TXT_GID_CACHE_CNT 0
+
+/** Point the tables of binary fonts (`lv_binfont_create`) into the font file instead of copying them
+ *  if the file is in a memory buffer or the file system driver can map it (e.g. POSIX).
+ *  With `lv_binfont_create_from_buffer` the buffer needs to be kept until the font is destroyed. */
+#define LV_BINFONT_ZERO_COPY 0
+
+/** Size of the cache of glyph bitmaps of binary fonts in bytes. If not 0, the glyph bitmaps
+ *  are read from the file when they are drawn and the file is kept open.
+ *  0: load all the glyph bitmaps when the font is created */
+#define LV_BINFONT_CACHE_SIZE 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -1349,6 +1426,10 @@
 /** Store extra some info in labels (12 bytes) to speed up drawing of very long texts */
 #define LV_LABEL_LONG_TXT_HINT 1
 
+/** Store the line breaks of labels with long texts (8 bytes per line) when the text changes
+ *  to start drawing at the first visible line without wrapping the text again in every frame */
+#define LV_LABEL_LINE_CACHE 1
+
 /** The count of wait chart */
 #define LV_LABEL_WAIT_CHAR_COUNT 3
 
@@ -2042,7 +2123,12 @@
 #define LV_USE_PROFILER_BUILTIN 0
 
 #if LV_USE_PROFILER_BUILTIN
-/** Default profiler trace buffer size in bytes */
+/** Default profiler trace buffer size in bytes
+ *
+ *  Every thread writing trace events gets its own buffer of this size
+ *  (at most 16 threads), so the total memory usage is this size
+ *  multiplied by the number of profiled threads.
+ */
 #define LV_PROFILER_BUILTIN_BUF_SIZE 16384
 
 /** Enable built-in profiler by default */
@@ -138,6 +138,7 @@ ALLOWED_EXTERNAL_HEADERS: set[str] = {
     "driver/ppa.h",
     "drm/drm_fourcc.h",
     "drm_fourcc.h",
+    "emmintrin.h",
     "errno.h",
     "esp_cache.h",
     "esp_err.h",
@@ -172,6 +173,7 @@ ALLOWED_EXTERNAL_HEADERS: set[str] = {
     "hal/color_hal.h",
     "hal_data.h",
     "include/lv_mp_mem_custom_include.h",
+    "immintrin.h",
     "intrin.h",
     "jpegint.h",
     "jpeglib.h",
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import struct
+from pathlib import Path
+
+MAGIC = b'LVPT'
+VERSION = 1
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Convert a binary trace of the built-in profiler '
+                                                 'to Chrome/Perfetto JSON.')
+    parser.add_argument('trace_file', metavar='trace_file', type=str,
+                        help='The binary trace written by the `flush_bin_cb` of the profiler.')
+    parser.add_argument('json_file', metavar='json_file', type=str, nargs='?',
+                        help='The output JSON file. If not provided, defaults to \'<trace_file>.json\'.')
+
+    args = parser.parse_args()
+    return args
+
+
+def convert(data):
+    if data[0:4] != MAGIC:
+        raise ValueError('Not a binary profiler trace')
+
+    version = data[4]
+    if version != VERSION:
+        raise ValueError(f'Unsupported version: {version}')
+
+    tick_per_sec, = struct.unpack_from('<I', data, 8)
+    us_per_tick = 1000000.0 / tick_per_sec
+
+    names = {}
+    events = []
+    pos = 12
+    while pos < len(data):
+        rec_type = chr(data[pos])
+        if rec_type == 'N':
+            length, name_id = struct.unpack_from('<BH', data, pos + 1)
+            names[name_id] = data[pos + 4:pos + 4 + length].decode('utf-8', errors='replace')
+            pos += 4 + length
+        elif rec_type in ('B', 'E'):
+            cpu, name_id, tid, tick = struct.unpack_from('<BHIQ', data, pos + 1)
+            events.append({
+                'name': names.get(name_id, f'unknown_{name_id}'),
+                'ph': rec_type,
+                'ts': tick * us_per_tick,
+                'pid': 1,
+                'tid': tid,
+                'args': {'cpu': cpu},
+            })
+            pos += 16
+        elif rec_type == 'D':
+            tid, cnt = struct.unpack_from('<II', data, pos + 4)
+            ts = events[-1]['ts'] if events else 0
+            events.append({
+                'name': f'dropped {cnt} events',
+                'ph': 'i',
+                's': 't',
+                'ts': ts,
+                'pid': 1,
+                'tid': tid,
+            })
+            pos += 12
+        else:
+            raise ValueError(f'Unknown record type {data[pos]:#x} at offset {pos}')
+
+    # The rings of the threads are flushed one after the other so sort the events by time
+    events.sort(key=lambda e: e['ts'])
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    if not args.json_file:
+        trace_file = Path(args.trace_file)
+        args.json_file = trace_file.with_suffix('.json').as_posix()
+
+    print('trace_file:', args.trace_file)
+    print('json_file :', args.json_file)
+
+    with open(args.trace_file, 'rb') as f:
+        content = f.read()
+
+    trace = convert(content)
+
+    with open(args.json_file, 'w') as f:
+        json.dump(trace, f)
+
+    print('events    :', len(trace['traceEvents']))
@@ -33,9 +33,12 @@ extern "C" {
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
+#include "../stdlib/lv_mem_slab_private.h"
+#include "../misc/lv_str_intern_private.h"
 #include "../debugging/sysmon/lv_sysmon_private.h"
 #include "../debugging/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
+#include "../image/lv_image_decoder_async_private.h"
 
 /*********************
  *      DEFINES
@@ -118,6 +121,10 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t img_decoder_async;
+#endif
+    lv_str_intern_t str_intern;
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
@@ -152,6 +159,10 @@ typedef struct _lv_global_t {
     lv_tlsf_state_t tlsf_state;
 #endif
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_state_t mem_slab;
+#endif
+
     lv_ll_t fsdrv_ll;
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
@@ -194,6 +205,9 @@ typedef struct _lv_global_t {
 
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    lv_cache_t * font_fmt_txt_glyph_cache;
+#endif
 #endif
 
 #if LV_USE_SPAN != 0
@@ -202,6 +216,7 @@ typedef struct _lv_global_t {
 
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     struct _lv_profiler_builtin_ctx_t * profiler_context;
+    uint32_t profiler_writer_cnt;
 #endif
 
 
@@ -16,6 +16,7 @@
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_hit_index_private.h"
 
 /*********************
  *      DEFINES
@@ -685,6 +686,7 @@ void lv_obj_set_send_draw_task_events(lv_obj_t * obj, bool en)
 void lv_obj_set_overflow_visible(lv_obj_t * obj, bool en)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return);
+    if(obj->overflow_visible != en) lv_obj_hit_index_invalidate(obj->parent);
     obj->overflow_visible = en;
 }
 
@@ -1050,6 +1052,7 @@ lv_result_t lv_obj_add_child(lv_obj_t * parent, lv_obj_t * child)
 
     parent->spec_attr->child_cnt = new_child_cnt;
     parent->spec_attr->children = children;
+    lv_obj_hit_index_invalidate(parent);
     return LV_RESULT_OK;
 }
 
@@ -1062,6 +1065,8 @@ void lv_obj_remove_child(lv_obj_t * parent, lv_obj_t * child)
         parent->spec_attr->children[i] = parent->spec_attr->children[i + 1];
     }
 
+    lv_obj_hit_index_invalidate(parent);
+
     /* No more children*/
     if(parent->spec_attr->child_cnt == 1) {
         lv_free(parent->spec_attr->children);
@@ -1350,6 +1355,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+#if LV_OBJ_STYLE_VALUE_CACHE
+    lv_free(obj->style_value_cache);
+    obj->style_value_cache = NULL;
+#endif
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
@@ -1364,6 +1373,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             obj->spec_attr->children = NULL;
         }
 
+        lv_obj_hit_index_delete(obj);
+
         lv_event_remove_all(&obj->spec_attr->event_list);
 #if LV_USE_OBJ_NAME
         if(obj->spec_attr->name && !obj->spec_attr->name_static) {
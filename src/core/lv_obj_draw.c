@@ -9,6 +9,7 @@
 #include "lv_obj_draw_private.h"
 #include "../lvgl_public.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 
 /*********************
  *      DEFINES
@@ -444,7 +445,10 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
         obj->spec_attr->ext_draw_size = s_new;
     }
 
-    if(s_new != s_old) lv_obj_invalidate(obj);
+    if(s_new != s_old) {
+        lv_obj_invalidate(obj);
+        lv_obj_hit_index_invalidate(obj->parent);
+    }
     LV_PROFILER_DRAW_END;
 }
 
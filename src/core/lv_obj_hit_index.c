@@ -0,0 +1,302 @@
+/**
+ * @file lv_obj_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "../misc/lv_area_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Limit the size of the grid of very large widgets*/
+#define MAX_CELL_CNT    1024
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_USE_OBJ_HIT_INDEX
+static bool index_build(lv_obj_t * obj, lv_obj_hit_index_t * index, const lv_area_t * area);
+static bool get_child_area(const lv_obj_t * child, const lv_area_t * area, lv_area_t * child_area);
+static void get_cell_range(const lv_obj_hit_index_t * index, const lv_area_t * child_area, lv_area_t * cells);
+static bool reserve(uint32_t ** buf, uint32_t * cap, uint32_t size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_hit_index_invalidate(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_HIT_INDEX
+    if(obj && obj->spec_attr && obj->spec_attr->hit_index) {
+        obj->spec_attr->hit_index->valid = 0;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_hit_index_delete(lv_obj_t * obj)
+{
+#if LV_USE_OBJ_HIT_INDEX
+    if(obj->spec_attr == NULL || obj->spec_attr->hit_index == NULL) return;
+
+    lv_obj_hit_index_t * index = obj->spec_attr->hit_index;
+    lv_free(index->cell_start);
+    lv_free(index->items);
+    lv_free(index->transformed);
+    lv_free(index);
+    obj->spec_attr->hit_index = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+#if LV_USE_OBJ_HIT_INDEX
+
+bool lv_obj_hit_index_iter_init(lv_obj_t * obj, const lv_area_t * area, const lv_point_t * point,
+                                lv_obj_hit_index_iter_t * iter)
+{
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    if(child_cnt < LV_OBJ_HIT_INDEX_MIN_CHILDREN) return false;
+
+    lv_obj_hit_index_t * index = obj->spec_attr->hit_index;
+    if(index == NULL) {
+        index = lv_zalloc(sizeof(lv_obj_hit_index_t));
+        LV_ASSERT_MALLOC(index);
+        if(index == NULL) return false;
+        obj->spec_attr->hit_index = index;
+    }
+
+    /*The area also changes when the widget is moved, resized or its overflow becomes visible*/
+    if(!index->valid || index->child_cnt != child_cnt || !lv_area_is_equal(&index->area, area)) {
+        if(!index_build(obj, index, area)) return false;
+    }
+
+    int32_t col = (point->x - index->area.x1) / index->cell_w;
+    int32_t row = (point->y - index->area.y1) / index->cell_h;
+    col = LV_CLAMP(0, col, (int32_t)index->col_cnt - 1);
+    row = LV_CLAMP(0, row, (int32_t)index->row_cnt - 1);
+    uint32_t cell = (uint32_t)row * index->col_cnt + (uint32_t)col;
+
+    iter->cell_cnt = index->cell_start[cell + 1] - index->cell_start[cell];
+    iter->cell = iter->cell_cnt ? &index->items[index->cell_start[cell]] : NULL;
+    iter->transformed = index->transformed;
+    iter->transformed_cnt = index->transformed_cnt;
+    return true;
+}
+
+int32_t lv_obj_hit_index_iter_next(lv_obj_hit_index_iter_t * iter)
+{
+    /*Both lists are in ascending order, so merge them from the end to keep the z order*/
+    if(iter->cell_cnt == 0 && iter->transformed_cnt == 0) return -1;
+
+    if(iter->transformed_cnt == 0 ||
+       (iter->cell_cnt > 0 && iter->cell[iter->cell_cnt - 1] > iter->transformed[iter->transformed_cnt - 1])) {
+        iter->cell_cnt--;
+        return (int32_t)iter->cell[iter->cell_cnt];
+    }
+
+    iter->transformed_cnt--;
+    return (int32_t)iter->transformed[iter->transformed_cnt];
+}
+
+#endif /*LV_USE_OBJ_HIT_INDEX*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_OBJ_HIT_INDEX
+
+/**
+ * Sort the children of a widget into the cells of a grid
+ * @param obj       pointer to a widget
+ * @param index     the index to build
+ * @param area      the area of `obj` in which its children can be hit
+ * @return          true: success; false: out of memory
+ */
+static bool index_build(lv_obj_t * obj, lv_obj_hit_index_t * index, const lv_area_t * area)
+{
+    LV_PROFILER_BEGIN;
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    lv_obj_t ** children = obj->spec_attr->children;
+
+    index->valid = 0;
+    index->area = *area;
+    index->child_cnt = child_cnt;
+    index->transformed_cnt = 0;
+
+    /*Children which can't be hit in the area are left out. Transformed children are always checked
+     *as their children can be anywhere*/
+    uint32_t in_cnt = 0;
+    uint32_t i;
+    lv_area_t child_area;
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_get_layer_type(children[i]) == LV_LAYER_TYPE_TRANSFORM) index->transformed_cnt++;
+        else if(get_child_area(children[i], area, &child_area)) in_cnt++;
+    }
+
+    if(!reserve(&index->transformed, &index->transformed_cap, index->transformed_cnt)) {
+        LV_PROFILER_END;
+        return false;
+    }
+
+    /*Aim for about one child per cell and split the longer side of the cells first*/
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    uint32_t cell_cnt = LV_CLAMP(1, in_cnt, MAX_CELL_CNT);
+    uint32_t col_cnt = 1;
+    uint32_t row_cnt = 1;
+    while(col_cnt * row_cnt < cell_cnt) {
+        if(w / (int32_t)col_cnt >= h / (int32_t)row_cnt) col_cnt++;
+        else row_cnt++;
+    }
+    /*Not smaller than 1 pixel*/
+    col_cnt = LV_CLAMP(1, col_cnt, (uint32_t)LV_MAX(w, 1));
+    row_cnt = LV_CLAMP(1, row_cnt, (uint32_t)LV_MAX(h, 1));
+    cell_cnt = col_cnt * row_cnt;
+
+    index->col_cnt = col_cnt;
+    index->row_cnt = row_cnt;
+    index->cell_w = (w + (int32_t)col_cnt - 1) / (int32_t)col_cnt;
+    index->cell_h = (h + (int32_t)row_cnt - 1) / (int32_t)row_cnt;
+
+    if(!reserve(&index->cell_start, &index->cell_cap, cell_cnt + 1)) {
+        LV_PROFILER_END;
+        return false;
+    }
+    lv_memzero(index->cell_start, (cell_cnt + 1) * sizeof(uint32_t));
+
+    /*Count the children per cell. `cell_start[c + 1]` is used as a counter for cell `c`*/
+    uint32_t transformed_i = 0;
+    lv_area_t cells;
+    int32_t col, row;
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_get_layer_type(children[i]) == LV_LAYER_TYPE_TRANSFORM) {
+            index->transformed[transformed_i++] = i;
+            continue;
+        }
+        if(!get_child_area(children[i], area, &child_area)) continue;
+
+        get_cell_range(index, &child_area, &cells);
+        for(row = cells.y1; row <= cells.y2; row++) {
+            for(col = cells.x1; col <= cells.x2; col++) {
+                index->cell_start[(uint32_t)row * col_cnt + (uint32_t)col + 1]++;
+            }
+        }
+    }
+
+    for(i = 0; i < cell_cnt; i++) {
+        index->cell_start[i + 1] += index->cell_start[i];
+    }
+
+    if(!reserve(&index->items, &index->item_cap, index->cell_start[cell_cnt])) {
+        LV_PROFILER_END;
+        return false;
+    }
+
+    /*Fill the cells in the same order, `cell_start[c]` is used as a write position
+     *and it's the start of the next cell after filling*/
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_get_layer_type(children[i]) == LV_LAYER_TYPE_TRANSFORM) continue;
+        if(!get_child_area(children[i], area, &child_area)) continue;
+
+        get_cell_range(index, &child_area, &cells);
+        for(row = cells.y1; row <= cells.y2; row++) {
+            for(col = cells.x1; col <= cells.x2; col++) {
+                uint32_t c = (uint32_t)row * col_cnt + (uint32_t)col;
+                index->items[index->cell_start[c]++] = i;
+            }
+        }
+    }
+
+    /*Shift back the start positions*/
+    for(i = cell_cnt; i > 0; i--) {
+        index->cell_start[i] = index->cell_start[i - 1];
+    }
+    index->cell_start[0] = 0;
+
+    index->valid = 1;
+    LV_PROFILER_END;
+    return true;
+}
+
+/**
+ * Get the area where a child or its children can be hit, the same way as `lv_indev_search_obj` checks it.
+ * @param child         pointer to a not transformed child
+ * @param area          the area of the parent in which the children can be hit
+ * @param child_area    store the result here, clipped to `area`
+ * @return              false: the child can't be hit in `area`
+ */
+static bool get_child_area(const lv_obj_t * child, const lv_area_t * area, lv_area_t * child_area)
+{
+    lv_obj_get_click_area(child, child_area);
+
+    if(lv_obj_is_overflow_visible(child)) {
+        lv_area_t ext_area = child->coords;
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&ext_area, ext_draw_size, ext_draw_size);
+        lv_area_join(child_area, child_area, &ext_area);
+    }
+
+    return lv_area_intersect(child_area, child_area, area);
+}
+
+/**
+ * Get the columns and rows of the cells covered by an area
+ * @param index         pointer to a hit index
+ * @param child_area    an area on the area of the index
+ * @param cells         store the first and last column in `x1` and `x2`, the rows in `y1` and `y2`
+ */
+static void get_cell_range(const lv_obj_hit_index_t * index, const lv_area_t * child_area, lv_area_t * cells)
+{
+    cells->x1 = (child_area->x1 - index->area.x1) / index->cell_w;
+    cells->x2 = (child_area->x2 - index->area.x1) / index->cell_w;
+    cells->y1 = (child_area->y1 - index->area.y1) / index->cell_h;
+    cells->y2 = (child_area->y2 - index->area.y1) / index->cell_h;
+}
+
+/**
+ * Make sure an array has space for a given number of elements
+ * @param buf       pointer to the array, it's reallocated if needed
+ * @param cap       pointer to the allocated number of elements
+ * @param size      the required number of elements
+ * @return          true: success; false: out of memory
+ */
+static bool reserve(uint32_t ** buf, uint32_t * cap, uint32_t size)
+{
+    if(size <= *cap) return true;
+
+    uint32_t * new_buf = lv_realloc(*buf, size * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(new_buf);
+    if(new_buf == NULL) return false;
+
+    *buf = new_buf;
+    *cap = size;
+    return true;
+}
+
+#endif /*LV_USE_OBJ_HIT_INDEX*/
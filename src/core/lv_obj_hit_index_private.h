@@ -0,0 +1,109 @@
+/**
+ * @file lv_obj_hit_index_private.h
+ *
+ */
+
+#ifndef LV_OBJ_HIT_INDEX_PRIVATE_H
+#define LV_OBJ_HIT_INDEX_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*********************
+ *      TYPEDEFS
+ *********************/
+
+#if LV_USE_OBJ_HIT_INDEX
+
+/**
+ * Uniform grid over the area of a widget where its children can be hit.
+ * Each cell lists the indices of the children reaching into it in ascending (z) order.
+ */
+struct _lv_obj_hit_index_t {
+    lv_area_t area;                 /**< The area covered by the grid*/
+    int32_t cell_w;                 /**< Width of a cell*/
+    int32_t cell_h;                 /**< Height of a cell*/
+    uint32_t col_cnt;               /**< Number of cell columns*/
+    uint32_t row_cnt;               /**< Number of cell rows*/
+    uint32_t * cell_start;          /**< `col_cnt * row_cnt + 1` offsets into `items`*/
+    uint32_t * items;               /**< Child indices of all the cells*/
+    uint32_t * transformed;         /**< Indices of the transformed children, checked for every point*/
+    uint32_t cell_cap;              /**< Allocated size of `cell_start`*/
+    uint32_t item_cap;              /**< Allocated size of `items`*/
+    uint32_t transformed_cap;       /**< Allocated size of `transformed`*/
+    uint32_t transformed_cnt;       /**< Number of transformed children*/
+    uint32_t child_cnt;             /**< Number of children when the grid was built*/
+    uint32_t valid : 1;             /**< 0: the children were changed, rebuild before use*/
+};
+
+/** Iterates the children which might be hit on a point from top to bottom*/
+typedef struct {
+    const uint32_t * cell;          /**< Child indices of the cell of the point*/
+    uint32_t cell_cnt;              /**< Remaining items in `cell`*/
+    const uint32_t * transformed;   /**< Child indices of the transformed children*/
+    uint32_t transformed_cnt;       /**< Remaining items in `transformed`*/
+} lv_obj_hit_index_iter_t;
+
+#endif /*LV_USE_OBJ_HIT_INDEX*/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Mark the hit index of a widget as outdated because a child was added, removed, moved, resized
+ * or its click area or transformation was changed.
+ * @param obj       pointer to a widget, its children are affected. Can be NULL.
+ */
+void lv_obj_hit_index_invalidate(lv_obj_t * obj);
+
+/**
+ * Free the hit index of a widget
+ * @param obj       pointer to a widget
+ */
+void lv_obj_hit_index_delete(lv_obj_t * obj);
+
+#if LV_USE_OBJ_HIT_INDEX
+
+/**
+ * Start iterating the children of a widget which might be hit on a point.
+ * The index is (re)built here if it's outdated.
+ * @param obj       pointer to a widget
+ * @param area      the area of `obj` in which its children can be hit
+ * @param point     a point on `area`
+ * @param iter      the iterator to initialize
+ * @return          true: `iter` is ready; false: the index can't be used,
+ *                  all the children needs to be checked
+ */
+bool lv_obj_hit_index_iter_init(lv_obj_t * obj, const lv_area_t * area, const lv_point_t * point,
+                                lv_obj_hit_index_iter_t * iter);
+
+/**
+ * Get the index of the next child to check, in reverse creation order
+ * @param iter      an iterator initialized by ::lv_obj_hit_index_iter_init
+ * @return          index of the child or -1 if there are no more children
+ */
+int32_t lv_obj_hit_index_iter_next(lv_obj_hit_index_iter_t * iter);
+
+#endif /*LV_USE_OBJ_HIT_INDEX*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_HIT_INDEX_PRIVATE_H*/
@@ -13,6 +13,7 @@
 #include "lv_obj_draw_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
 #include "../core/lv_global.h"
@@ -32,7 +33,8 @@
  **********************/
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
-static void layout_update_core(lv_obj_t * obj);
+static void layout_update_core(lv_obj_t * obj, lv_display_refr_stats_t * stats);
+static void mark_child_layout_as_dirty(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
 static lv_result_t invalidate_area_core(const lv_obj_t * obj, lv_area_t * area_tmp);
@@ -206,6 +208,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    lv_obj_hit_index_invalidate(parent);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -217,6 +220,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_child_layout_as_dirty(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -310,12 +314,11 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 
     obj->layout_inv = 1;
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
+    /*Mark the parents and the screen too to mark that there is something to do in their subtree*/
+    mark_child_layout_as_dirty(obj);
 
     /*Make the display refreshing*/
-    lv_display_t * disp = lv_obj_get_display(scr);
+    lv_display_t * disp = lv_obj_get_display(obj);
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
@@ -331,15 +334,18 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     update_layout_mutex = true;
 
     lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_display_t * disp = lv_obj_get_display(scr);
+    lv_display_refr_stats_t * stats = disp ? &disp->refr_stats : NULL;
+
     /*Repeat until there are no more layout invalidations*/
     while(scr->scr_layout_inv) {
         LV_LOG_TRACE("Layout update begin");
         scr->scr_layout_inv = 0;
-        layout_update_core(scr);
+        if(stats) stats->layout_pass_cnt++;
+        layout_update_core(scr, stats);
         LV_LOG_TRACE("Layout update end");
     }
 
-    lv_display_t * disp = lv_obj_get_display(scr);
     lv_display_send_event(disp, LV_EVENT_UPDATE_LAYOUT_COMPLETED, NULL);
     update_layout_mutex = false;
     LV_PROFILER_LAYOUT_END;
@@ -753,11 +759,12 @@ bool lv_obj_refresh_self_size(lv_obj_t * obj)
         return false;
 
     /**
-     * Refresh the parent's layout, because the children size is in some way dependent on its contents we need to force a
-     * recalculation of the parents layout
+     * If the size is set by the parent's layout `lv_obj_refr_size()` can't see the new content size,
+     * so force a recalculation of the parent's layout.
+     * Else the parent is notified with `LV_EVENT_CHILD_CHANGED` only if the size really changes.
      */
     lv_obj_t * parent = lv_obj_get_parent(obj);
-    if(parent != NULL) {
+    if(parent != NULL && (obj->w_layout || obj->h_layout)) {
         parent->w_layout = 0;
         parent->h_layout = 0;
         lv_obj_mark_layout_as_dirty(parent);
@@ -931,6 +938,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     obj->coords.y1 += diff.y;
     obj->coords.x2 += diff.x;
     obj->coords.y2 += diff.y;
+    lv_obj_hit_index_invalidate(parent);
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
 
@@ -954,6 +962,8 @@ void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, boo
 
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
+    if(child_cnt) lv_obj_hit_index_invalidate(obj);
+
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         if(ignore_floating && lv_obj_is_floating(child)) continue;
@@ -1178,6 +1188,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
         return;
     }
     obj->spec_attr->ext_click_pad = size;
+    lv_obj_hit_index_invalidate(obj->parent);
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1533,21 +1544,34 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res);
 }
 
-static void layout_update_core(lv_obj_t * obj)
+/**
+ * Update the layout of the dirty widgets of a subtree.
+ * Subtrees without `child_layout_inv` have nothing to update so they are skipped.
+ * @param obj       the root of the subtree
+ * @param stats     count the updates here (can be NULL)
+ */
+static void layout_update_core(lv_obj_t * obj, lv_display_refr_stats_t * stats)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->child_layout_inv || child->layout_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child, stats);
+            }
+        }
     }
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
+        if(stats) stats->layout_obj_cnt++;
         lv_obj_refr_size(obj);
         lv_obj_refr_pos(obj);
 
         if(child_cnt > 0) {
+            if(stats && lv_obj_get_style_layout(obj, LV_PART_MAIN) != LV_LAYOUT_NONE) stats->layout_apply_cnt++;
             lv_layout_apply(obj);
         }
     }
@@ -1558,6 +1582,23 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the parents of a widget that a widget in their subtree needs a layout update,
+ * and the screen that there is something to do.
+ * @param obj       pointer to a widget which needs a layout update
+ */
+static void mark_child_layout_as_dirty(lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    while(parent) {
+        parent->child_layout_inv = 1;
+        obj = parent;
+        parent = parent->parent;
+    }
+
+    obj->scr_layout_inv = 1;
+}
+
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -20,10 +20,18 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#ifndef LV_OBJ_STYLE_VALUE_CACHE_MAX_SIZE
+#define LV_OBJ_STYLE_VALUE_CACHE_MAX_SIZE 128 /**< Max. number of cache entries per object. Must be a power of 2*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_OBJ_HIT_INDEX
+typedef struct _lv_obj_hit_index_t lv_obj_hit_index_t;
+#endif
+
 /**
  * Special, rarely used attributes.
  * They are allocated automatically if any elements is set.
@@ -33,6 +41,9 @@ typedef struct _lv_obj_spec_attr_t {
     lv_group_t * group_p;
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     lv_matrix_t * matrix;           /**< The transform matrix*/
+#endif
+#if LV_USE_OBJ_HIT_INDEX
+    lv_obj_hit_index_t * hit_index; /**< Grid of the children to find the clicked one quickly*/
 #endif
     lv_event_list_t event_list;
 #if LV_USE_OBJ_NAME
@@ -53,6 +64,22 @@ typedef struct _lv_obj_spec_attr_t {
     uint16_t user_flags : 8;         /**< Store custom flags */
 } lv_obj_spec_attr_t;
 
+#if LV_OBJ_STYLE_VALUE_CACHE
+/** A style property resolved from the styles of an object for a part and state*/
+typedef struct {
+    uint32_t key;                   /**< `selector << 8 | prop` or 0 if the entry is unused*/
+    lv_style_value_t value;         /**< The value if `found` is set*/
+    uint8_t found;                  /**< 1: the property is set in a style of the object*/
+} lv_obj_style_value_cache_entry_t;
+
+/** Open addressing hash table of the resolved style properties of an object*/
+typedef struct {
+    uint16_t size;                  /**< Number of entries, a power of 2*/
+    uint16_t cnt;                   /**< Number of used entries*/
+    lv_obj_style_value_cache_entry_t * entries;  /**< Allocated together with this struct*/
+} lv_obj_style_value_cache_t;
+#endif
+
 
 struct _lv_obj_t {
 #if LV_USE_EXT_DATA
@@ -65,6 +92,10 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_VALUE_CACHE
+    /** Allocated on the first style property lookup and grows up to `LV_OBJ_STYLE_VALUE_CACHE_MAX_SIZE` entries*/
+    lv_obj_style_value_cache_t * style_value_cache;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -145,6 +176,7 @@ struct _lv_obj_t {
 
     uint16_t state;
     uint16_t layout_inv : 1;
+    uint16_t child_layout_inv : 1;  /* a descendant needs a layout update, so visit the children */
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
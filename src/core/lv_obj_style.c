@@ -11,6 +11,8 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_draw_private.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "lv_observer_private.h"
@@ -23,6 +25,7 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define STYLE_VALUE_CACHE_MIN_SIZE 16
 
 /**********************
  *      TYPEDEFS
@@ -58,6 +61,13 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_style_selector_t selector);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v);
+static void value_cache_invalidate(lv_obj_t * obj);
+#if LV_OBJ_STYLE_VALUE_CACHE
+static lv_obj_style_value_cache_entry_t * value_cache_find(lv_obj_style_value_cache_t * cache, uint32_t key);
+static lv_obj_style_value_cache_t * value_cache_resize(lv_obj_style_value_cache_t * cache, uint32_t size);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -249,6 +259,9 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return);
 
+    /*The values might be changed even if refreshing is disabled*/
+    value_cache_invalidate(obj);
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -692,6 +705,8 @@ void lv_obj_update_layer_type(lv_obj_t * obj)
     LV_CHECK_ARG(obj != NULL, return);
 
     lv_layer_type_t layer_type = calculate_layer_type(obj);
+    if(layer_type != lv_obj_get_layer_type(obj)) lv_obj_hit_index_invalidate(obj->parent);
+
     if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         if(!lv_obj_allocate_spec_attr(obj)) {
@@ -966,6 +981,129 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get a property from the styles of an object like `get_prop_core()`, but look it up in
+ * the object's value cache first and store the result there
+ * @param obj       pointer to an object
+ * @param selector  the part and state to get the property for
+ * @param prop      the property to get
+ * @param v         store the value here if found
+ * @return          LV_STYLE_RES_FOUND or LV_STYLE_RES_NOT_FOUND
+ */
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE
+    /*The transitions are skipped only temporarily, don't cache these values*/
+    if(obj->skip_trans) return get_prop_core(obj, selector, prop, v);
+
+    lv_obj_t * obj_mutable = (lv_obj_t *)obj;
+    lv_obj_style_value_cache_t * cache = obj_mutable->style_value_cache;
+    uint32_t key = ((uint32_t)selector << 8) | prop;
+    lv_obj_style_value_cache_entry_t * entry;
+
+    if(cache) {
+        entry = value_cache_find(cache, key);
+        if(entry->key == key) {
+            if(!entry->found) return LV_STYLE_RES_NOT_FOUND;
+            *v = entry->value;
+            return LV_STYLE_RES_FOUND;
+        }
+    }
+
+    lv_style_res_t found = get_prop_core(obj, selector, prop, v);
+
+    /*Keep the table at most 3/4 full to have short probe sequences*/
+    if(cache == NULL || ((uint32_t)cache->cnt + 1) * 4 > (uint32_t)cache->size * 3) {
+        if(cache && cache->size >= LV_OBJ_STYLE_VALUE_CACHE_MAX_SIZE) {
+            /*So many different parts and states were used that it's simpler to start again*/
+            lv_memzero(cache->entries, cache->size * sizeof(lv_obj_style_value_cache_entry_t));
+            cache->cnt = 0;
+        }
+        else {
+            cache = value_cache_resize(cache, cache ? cache->size * 2 : STYLE_VALUE_CACHE_MIN_SIZE);
+            if(cache == NULL) return found;
+            obj_mutable->style_value_cache = cache;
+        }
+    }
+
+    entry = value_cache_find(cache, key);
+    entry->key = key;
+    entry->found = found == LV_STYLE_RES_FOUND;
+    if(entry->found) entry->value = *v;
+    cache->cnt++;
+
+    return found;
+#else
+    return get_prop_core(obj, selector, prop, v);
+#endif
+}
+
+#if LV_OBJ_STYLE_VALUE_CACHE
+
+/**
+ * Find the entry of a key or the empty entry where it should be added
+ * @param cache     pointer to a value cache which has at least one empty entry
+ * @param key       `selector << 8 | prop`
+ * @return          pointer to the entry
+ */
+static lv_obj_style_value_cache_entry_t * value_cache_find(lv_obj_style_value_cache_t * cache, uint32_t key)
+{
+    uint32_t mask = cache->size - 1;
+    uint32_t i = ((key * 0x9E3779B1u) >> 16) & mask;
+    while(cache->entries[i].key != 0 && cache->entries[i].key != key) {
+        i = (i + 1) & mask;
+    }
+
+    return &cache->entries[i];
+}
+
+/**
+ * Allocate a larger value cache and move the entries of the old one there
+ * @param cache     pointer to the old value cache or NULL
+ * @param size      number of entries of the new cache, a power of 2
+ * @return          pointer to the new value cache, or NULL if out of memory (the old one is kept)
+ */
+static lv_obj_style_value_cache_t * value_cache_resize(lv_obj_style_value_cache_t * cache, uint32_t size)
+{
+    lv_obj_style_value_cache_t * new_cache = lv_zalloc(sizeof(lv_obj_style_value_cache_t) +
+                                                       size * sizeof(lv_obj_style_value_cache_entry_t));
+    if(new_cache == NULL) return NULL;
+    new_cache->size = (uint16_t)size;
+    new_cache->entries = (lv_obj_style_value_cache_entry_t *)(new_cache + 1);
+
+    if(cache) {
+        uint32_t i;
+        for(i = 0; i < cache->size; i++) {
+            if(cache->entries[i].key == 0) continue;
+            *value_cache_find(new_cache, cache->entries[i].key) = cache->entries[i];
+            new_cache->cnt++;
+        }
+        lv_free(cache);
+    }
+
+    return new_cache;
+}
+
+#endif /*LV_OBJ_STYLE_VALUE_CACHE*/
+
+/**
+ * Drop the cached style properties of an object as its styles have changed
+ * @param obj       pointer to an object
+ */
+static void value_cache_invalidate(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE
+    lv_obj_style_value_cache_t * cache = obj->style_value_cache;
+    if(cache && cache->cnt) {
+        lv_memzero(cache->entries, cache->size * sizeof(lv_obj_style_value_cache_entry_t));
+        cache->cnt = 0;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -1037,6 +1175,7 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
                     lv_style_remove_prop((lv_style_t *)obj->styles[i].style, tr->prop);
                 }
             }
+            value_cache_invalidate(obj);
 
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
@@ -1165,6 +1304,7 @@ static void trans_anim_completed_cb(lv_anim_t * a)
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                value_cache_invalidate(obj);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1194,6 +1334,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    value_cache_invalidate(obj);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1290,7 +1432,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_cached(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1317,7 +1459,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_cached(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -9,6 +9,7 @@
 #include "lv_obj_private.h"
 #include "../lvgl_public.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_anim_private.h"
@@ -232,6 +233,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_obj_hit_index_invalidate(parent);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -256,11 +258,18 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    lv_obj_hit_index_invalidate(parent);
+    lv_obj_hit_index_invalidate(parent2);
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CREATED, obj1);
 
+    /*Mark the new parents too if there is a pending layout update in the swapped subtrees*/
+    lv_obj_mark_layout_as_dirty(obj1);
+    lv_obj_mark_layout_as_dirty(obj2);
+
     lv_obj_invalidate(parent);
 
     if(parent != parent2) {
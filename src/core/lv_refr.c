@@ -34,9 +34,11 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static bool inv_area_buf_grow(lv_display_t * disp);
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
-static void refr_area(const lv_area_t * area_p, int32_t y_offset);
+static void refr_area(const lv_area_t * area_p);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
@@ -312,7 +314,11 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
+        if(disp->inv_area_cap == 0 && !inv_area_buf_grow(disp)) return LV_RESULT_INVALID;
+        disp->refr_stats.inv_area_cnt++;
+        disp->refr_stats.inv_px_cnt += lv_area_get_size(&com_area);
         disp->inv_areas[0] = scr_area;
+        disp->inv_area_joined[0] = 0;
         disp->inv_p = 1;
         lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
         return LV_RESULT_OK;
@@ -321,20 +327,29 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return LV_RESULT_INVALID;
 
+    disp->refr_stats.inv_area_cnt++;
+    disp->refr_stats.inv_px_cnt += lv_area_get_size(&com_area);
+
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return LV_RESULT_OK;
     }
 
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    if(disp->inv_p < disp->inv_area_cap || inv_area_buf_grow(disp)) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_area_joined[disp->inv_p] = 0;
+        disp->inv_p++;
+    }
+    else if(disp->inv_p > 0) {
+        /*If no place for the area join it to the area which grows the least*/
+        inv_area_join_cheapest(disp, &com_area);
+    }
+    else {
+        LV_LOG_WARN("couldn't allocate the buffer of the invalidated areas");
+        return LV_RESULT_INVALID;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 
@@ -419,6 +434,12 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
+
+    lv_draw_task_arena_save_frame_stats();
+
+    disp_refr->refr_stats_last = disp_refr->refr_stats;
+    lv_memzero(&disp_refr->refr_stats, sizeof(disp_refr->refr_stats));
+
     /*In double buffered direct mode or if sync callback is set, save the updated areas.
      *They will be used on the next call to synchronize the buffers.*/
     if((lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) ||
@@ -433,8 +454,7 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         }
     }
 
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    lv_memzero(disp_refr->inv_area_joined, disp_refr->inv_p * sizeof(uint8_t));
     disp_refr->inv_p = 0;
 
 refr_finish:
@@ -618,7 +638,9 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas if rendering them together is cheaper than rendering them one by one.
+ * Rendering an area costs its size plus `LV_INV_AREA_OVERHEAD` pixels
+ * for walking the widget tree and flushing.
  */
 static void lv_refr_join_area(void)
 {
@@ -629,31 +651,82 @@ static void lv_refr_join_area(void)
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+        /*Check all areas to join them in 'join_in'. If 'join_in' grew, the
+         *areas checked before might be cheap to join too, so check them again.*/
+        bool grew;
+        do {
+            grew = false;
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+
+                /*Join two area only if the joined area costs less*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) +
+                                                     LV_INV_AREA_OVERHEAD)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    grew = true;
+                }
             }
+        } while(grew);
+    }
+    LV_PROFILER_REFR_END;
+}
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+/**
+ * Make the buffer of the invalidated areas larger
+ * @param disp      pointer to a display
+ * @return          true: the buffer has place for more areas; false: `LV_INV_BUF_MAX_SIZE` is reached
+ *                  or out of memory
+ */
+static bool inv_area_buf_grow(lv_display_t * disp)
+{
+    if(disp->inv_area_cap >= LV_INV_BUF_MAX_SIZE) return false;
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    uint32_t new_cap = disp->inv_area_cap == 0 ? LV_INV_BUF_SIZE : disp->inv_area_cap * 2;
+    if(new_cap > LV_INV_BUF_MAX_SIZE) new_cap = LV_INV_BUF_MAX_SIZE;
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
-            }
+    lv_area_t * areas = lv_realloc(disp->inv_areas, new_cap * sizeof(lv_area_t));
+    if(areas == NULL) return false;
+    disp->inv_areas = areas;
+
+    uint8_t * joined = lv_realloc(disp->inv_area_joined, new_cap * sizeof(uint8_t));
+    if(joined == NULL) return false;
+    disp->inv_area_joined = joined;
+
+    disp->inv_area_cap = new_cap;
+    return true;
+}
+
+/**
+ * Join an area to the saved area whose size grows the least by it
+ * @param disp      pointer to a display with at least one saved area
+ * @param area      the area to join
+ */
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area)
+{
+    uint32_t best_i = 0;
+    uint32_t best_cost = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_t joined_area;
+        lv_area_join(&joined_area, &disp->inv_areas[i], area);
+        uint32_t cost = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+        if(cost < best_cost) {
+            best_cost = cost;
+            best_i = i;
+            if(cost == 0) break;
         }
     }
-    LV_PROFILER_REFR_END;
+
+    lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area);
 }
 
 /**
@@ -808,6 +881,8 @@ static void refr_invalid_areas(void)
         disp_refr->last_part = 0;
 
         lv_area_t inv_a = disp_refr->inv_areas[i];
+        disp_refr->refr_stats.refr_area_cnt++;
+        disp_refr->refr_stats.refr_px_cnt += lv_area_get_size(&inv_a);
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
             /*Calculate the max row num*/
             int32_t w = lv_area_get_width(&inv_a);
@@ -820,7 +895,6 @@ static void refr_invalid_areas(void)
             lv_area_t sub_area;
             sub_area.x1 = inv_a.x1;
             sub_area.x2 = inv_a.x2;
-            int32_t y_off = 0;
             for(row = inv_a.y1; row + max_row - 1 <= inv_a.y2; row += max_row) {
                 /*Calc. the next y coordinates of draw_buf*/
                 sub_area.y1 = row;
@@ -828,8 +902,7 @@ static void refr_invalid_areas(void)
                 if(sub_area.y2 > inv_a.y2) sub_area.y2 = inv_a.y2;
                 row_last = sub_area.y2;
                 if(inv_a.y2 == row_last) disp_refr->last_part = 1;
-                refr_area(&sub_area, y_off);
-                y_off += lv_area_get_height(&sub_area);
+                refr_area(&sub_area);
                 draw_buf_flush(disp_refr);
             }
 
@@ -839,15 +912,14 @@ static void refr_invalid_areas(void)
                 sub_area.y1 = row;
                 sub_area.y2 = inv_a.y2;
                 disp_refr->last_part = 1;
-                refr_area(&sub_area, y_off);
-                y_off += lv_area_get_height(&sub_area);
+                refr_area(&sub_area);
                 draw_buf_flush(disp_refr);
             }
         }
         else if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_FULL ||
                 disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
             disp_refr->last_part = 1;
-            refr_area(&disp_refr->inv_areas[i], 0);
+            refr_area(&disp_refr->inv_areas[i]);
             draw_buf_flush(disp_refr);
         }
     }
@@ -877,14 +949,13 @@ static void layer_reshape_draw_buf(lv_layer_t * layer, uint32_t stride)
  * Refresh an area if there is Virtual Display Buffer
  * @param area_p  pointer to an area to refresh
  */
-static void refr_area(const lv_area_t * area_p, int32_t y_offset)
+static void refr_area(const lv_area_t * area_p)
 {
     LV_PROFILER_REFR_BEGIN;
     lv_layer_t * layer = disp_refr->layer_head;
     layer->draw_buf = disp_refr->buf_act;
     layer->_clip_area = *area_p;
     layer->phy_clip_area = *area_p;
-    layer->partial_y_offset = y_offset;
     layer->all_tasks_added = false;
 
     if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
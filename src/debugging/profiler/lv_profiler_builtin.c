@@ -10,6 +10,7 @@
 #include "lv_profiler_builtin_private.h"
 #include "../../lvgl_public.h"
 #include "../../core/lv_global.h"
+#include "../../osal/lv_os_private.h"
 
 /*********************
  *      DEFINES
@@ -18,22 +19,47 @@
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
 
 #define profiler_ctx LV_GLOBAL_DEFAULT()->profiler_context
+#define profiler_writer_cnt LV_GLOBAL_DEFAULT()->profiler_writer_cnt
 
 #define LV_PROFILER_STR_MAX_LEN 128
 #define LV_PROFILER_TICK_PER_SEC_MAX 1000000000 /* Maximum accuracy: 1 nanosecond */
+#define LV_PROFILER_RING_MAX 16                 /* Maximum number of threads with their own ring buffer */
+#define LV_PROFILER_DRAIN_STACK_SIZE (8 * 1024)
+#define LV_PROFILER_BIN_BUF_SIZE 512
+#define LV_PROFILER_NAME_TABLE_MIN_SIZE 64
 
 #if LV_USE_OS
     #define LV_PROFILER_MULTEX_INIT   lv_mutex_init(&profiler_ctx->mutex)
-    #define LV_PROFILER_MULTEX_DEINIT lv_mutex_delete(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_LOCK   lv_mutex_lock(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_UNLOCK lv_mutex_unlock(&profiler_ctx->mutex)
 #else
     #define LV_PROFILER_MULTEX_INIT
-    #define LV_PROFILER_MULTEX_DEINIT
     #define LV_PROFILER_MULTEX_LOCK
     #define LV_PROFILER_MULTEX_UNLOCK
 #endif
 
+/* The head of a ring is written only by its thread and the tail only by the drain.
+ * The writers announce themselves in `profiler_writer_cnt` before loading `profiler_ctx`,
+ * and `uninit` clears `profiler_ctx` before reading the count, so these are sequentially consistent.
+ * Without compiler support volatile accesses are used which is enough on single core systems.*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define LV_PROFILER_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define LV_PROFILER_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define LV_PROFILER_WRITER_ENTER()      __atomic_add_fetch(&profiler_writer_cnt, 1, __ATOMIC_SEQ_CST)
+    #define LV_PROFILER_WRITER_LEAVE()      __atomic_sub_fetch(&profiler_writer_cnt, 1, __ATOMIC_SEQ_CST)
+    #define LV_PROFILER_WRITER_CNT()        __atomic_load_n(&profiler_writer_cnt, __ATOMIC_SEQ_CST)
+    #define LV_PROFILER_CTX_LOAD()          __atomic_load_n(&profiler_ctx, __ATOMIC_SEQ_CST)
+    #define LV_PROFILER_CTX_STORE(v)        __atomic_store_n(&profiler_ctx, (v), __ATOMIC_SEQ_CST)
+#else
+    #define LV_PROFILER_LOAD_ACQUIRE(p)     (*(volatile uint32_t *)(p))
+    #define LV_PROFILER_STORE_RELEASE(p, v) (*(volatile uint32_t *)(p) = (v))
+    #define LV_PROFILER_WRITER_ENTER()      ((*(volatile uint32_t *)&profiler_writer_cnt)++)
+    #define LV_PROFILER_WRITER_LEAVE()      ((*(volatile uint32_t *)&profiler_writer_cnt)--)
+    #define LV_PROFILER_WRITER_CNT()        (*(volatile uint32_t *)&profiler_writer_cnt)
+    #define LV_PROFILER_CTX_LOAD()          (*(lv_profiler_builtin_ctx_t * volatile *)&profiler_ctx)
+    #define LV_PROFILER_CTX_STORE(v)        (*(lv_profiler_builtin_ctx_t * volatile *)&profiler_ctx = (v))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -43,25 +69,53 @@
  */
 typedef struct {
     uint64_t tick;     /**< The tick value of the profiler item */
-    char tag;          /**< The tag of the profiler item */
     const char * func; /**< A pointer to the function associated with the profiler item */
+    char tag;          /**< The tag of the profiler item */
 #if LV_USE_OS
-    int tid;           /**< The thread ID of the profiler item */
-    int cpu;         /**< The CPU ID of the profiler item */
+    int cpu;           /**< The CPU ID of the profiler item */
 #endif
 } lv_profiler_builtin_item_t;
 
+/**
+ * @brief Single producer, single consumer ring buffer of a thread
+ */
+typedef struct {
+    lv_profiler_builtin_item_t * items; /**< Array of `size` items */
+    uint32_t size;                      /**< Number of items, power of 2 */
+    uint32_t head;                      /**< Number of written items, written only by the owner thread */
+    uint32_t tail;                      /**< Number of read items, written only by the drain */
+    uint32_t dropped;                   /**< Number of items dropped as the ring was full */
+    uint32_t dropped_reported;          /**< Number of dropped items already reported by the drain */
+    int tid;                            /**< The thread ID of the owner thread */
+} lv_profiler_builtin_ring_t;
+
+/**
+ * @brief An entry of the table assigning IDs to the function names in the binary format
+ */
+typedef struct {
+    const char * func;
+    uint16_t id;
+} lv_profiler_builtin_name_t;
+
 /**
  * @brief Structure representing a context for the LVGL built-in profiler
  */
 typedef struct _lv_profiler_builtin_ctx_t {
-    lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
-    uint32_t item_num;                     /**< Number of profiler items in the array */
-    uint32_t cur_index;                    /**< Index of the current profiler item */
+    lv_profiler_builtin_ring_t rings[LV_PROFILER_RING_MAX]; /**< Ring buffers of the threads */
+    uint32_t ring_cnt;                     /**< Number of used rings, written only under `mutex` */
+    uint32_t ring_size;                    /**< Number of items in a ring */
     lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
     bool enable;                           /**< Whether the built-in profiler is enabled */
+    lv_profiler_builtin_name_t * names;    /**< Hash table of the already written function names */
+    uint32_t name_table_size;              /**< Number of entries in `names`, power of 2 */
+    uint32_t name_cnt;                     /**< Number of used entries in `names` */
+    uint8_t bin_buf[LV_PROFILER_BIN_BUF_SIZE]; /**< Collects the binary records before flushing them */
+    uint32_t bin_len;                      /**< Number of bytes in `bin_buf` */
 #if LV_USE_OS
-    lv_mutex_t mutex;                      /**< Mutex to protect the built-in profiler */
+    lv_mutex_t mutex;                      /**< Serializes draining and adding rings */
+    lv_thread_t drain_thread;              /**< Flushes the rings in the background */
+    lv_thread_sync_t drain_sync;           /**< Wakes up the drain thread */
+    bool drain_exit;                       /**< Tells the drain thread to exit */
 #endif
 } lv_profiler_builtin_ctx_t;
 
@@ -73,7 +127,20 @@ static uint64_t default_tick_get_cb(void);
 static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
+static void write_item(lv_profiler_builtin_ctx_t * ctx, const char * func, char tag);
+static lv_profiler_builtin_ring_t * ring_get(lv_profiler_builtin_ctx_t * ctx, int tid);
 static void flush_no_lock(void);
+static void flush_ring_text(lv_profiler_builtin_ring_t * ring, uint32_t tail, uint32_t head);
+static void flush_ring_bin(lv_profiler_builtin_ring_t * ring, uint32_t tail, uint32_t head);
+static uint16_t bin_name_id_get(const char * func);
+static void bin_write(const void * data, uint32_t len);
+static void bin_write_header(void);
+static uint8_t * put_u16(uint8_t * p, uint16_t v);
+static uint8_t * put_u32(uint8_t * p, uint32_t v);
+static uint8_t * put_u64(uint8_t * p, uint64_t v);
+#if LV_USE_OS
+    static void drain_thread_cb(void * ptr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -115,48 +182,81 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
         return;
     }
 
-    /*Free the old item_arr memory*/
+    /*Free the old rings*/
     if(profiler_ctx) {
         lv_profiler_builtin_uninit();
     }
 
     profiler_ctx = lv_malloc_zeroed(sizeof(lv_profiler_builtin_ctx_t));
     LV_ASSERT_MALLOC(profiler_ctx);
-
-    profiler_ctx->item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
-    LV_ASSERT_MALLOC(profiler_ctx->item_arr);
-    if(profiler_ctx->item_arr == NULL) {
-        lv_free(profiler_ctx);
-        profiler_ctx = NULL;
-        LV_LOG_ERROR("malloc failed for item_arr");
+    if(profiler_ctx == NULL) {
+        LV_LOG_ERROR("malloc failed for profiler_ctx");
         return;
     }
 
+    /*The ring indices are masked so round down the size to power of 2*/
+    uint32_t ring_size = 1;
+    while(ring_size * 2 <= num) ring_size *= 2;
+
     LV_PROFILER_MULTEX_INIT;
-    profiler_ctx->item_num = num;
+    profiler_ctx->ring_size = ring_size;
     profiler_ctx->config = *config;
 
-    if(profiler_ctx->config.flush_cb) {
+    if(profiler_ctx->config.flush_bin_cb) {
+        bin_write_header();
+    }
+    else if(profiler_ctx->config.flush_cb) {
         /* add profiler header for perfetto */
         profiler_ctx->config.flush_cb("# tracer: nop\n");
         profiler_ctx->config.flush_cb("#\n");
     }
 
+#if LV_USE_OS
+    lv_thread_sync_init(&profiler_ctx->drain_sync);
+    lv_thread_init(&profiler_ctx->drain_thread, "profiler", LV_THREAD_PRIO_LOW, drain_thread_cb,
+                   LV_PROFILER_DRAIN_STACK_SIZE, profiler_ctx);
+#endif
+
     lv_profiler_builtin_set_enable(LV_PROFILER_BUILTIN_DEFAULT_ENABLE);
 
-    LV_LOG_INFO("init OK, item_num = %d", (int)num);
+    LV_LOG_INFO("init OK, ring_size = %d", (int)ring_size);
 }
 
 void lv_profiler_builtin_uninit(void)
 {
-    if(!profiler_ctx) {
+    lv_profiler_builtin_ctx_t * ctx = profiler_ctx;
+    if(!ctx) {
         return;
     }
 
-    LV_PROFILER_MULTEX_DEINIT;
-    lv_free(profiler_ctx->item_arr);
-    lv_free(profiler_ctx);
-    profiler_ctx = NULL;
+#if LV_USE_OS
+    /*The drain uses `profiler_ctx` so stop it first*/
+    ctx->drain_exit = true;
+    lv_thread_sync_signal(&ctx->drain_sync);
+    lv_thread_delete(&ctx->drain_thread);
+#endif
+
+    /*New writers won't find the context anymore*/
+    ctx->enable = false;
+    LV_PROFILER_CTX_STORE(NULL);
+
+#if LV_USE_OS
+    /*Wait for the writers which have loaded the context before it was cleared.
+     *They can still signal `drain_sync` and lock `mutex`.*/
+    while(LV_PROFILER_WRITER_CNT() != 0) {
+        lv_sleep_ms(1);
+    }
+
+    lv_thread_sync_delete(&ctx->drain_sync);
+    lv_mutex_delete(&ctx->mutex);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < ctx->ring_cnt; i++) {
+        lv_free(ctx->rings[i].items);
+    }
+    lv_free(ctx->names);
+    lv_free(ctx);
 }
 
 void lv_profiler_builtin_set_enable(bool enable)
@@ -181,30 +281,15 @@ void lv_profiler_builtin_write(const char * func, char tag)
 {
     LV_ASSERT_NULL(func);
 
-    if(!(profiler_ctx && profiler_ctx->enable)) {
-        return;
-    }
+    /*Keep `uninit` from freeing the context while it's used here*/
+    LV_PROFILER_WRITER_ENTER();
 
-    LV_PROFILER_MULTEX_LOCK;
-
-    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
-        flush_no_lock();
-        profiler_ctx->cur_index = 0;
+    lv_profiler_builtin_ctx_t * ctx = LV_PROFILER_CTX_LOAD();
+    if(ctx && ctx->enable) {
+        write_item(ctx, func, tag);
     }
 
-    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
-    item->func = func;
-    item->tag = tag;
-    item->tick = profiler_ctx->config.tick_get_cb();
-
-#if LV_USE_OS
-    item->tid = profiler_ctx->config.tid_get_cb();
-    item->cpu = profiler_ctx->config.cpu_get_cb();
-#endif
-
-    profiler_ctx->cur_index++;
-
-    LV_PROFILER_MULTEX_UNLOCK;
+    LV_PROFILER_WRITER_LEAVE();
 }
 
 /**********************
@@ -231,25 +316,145 @@ static int default_cpu_get_cb(void)
     return 0;
 }
 
+/**
+ * Add an item to the ring of the current thread
+ * @param ctx       the profiler context, kept alive by the writer count
+ * @param func      the name of the function
+ * @param tag       the tag of the item
+ */
+static void write_item(lv_profiler_builtin_ctx_t * ctx, const char * func, char tag)
+{
+#if LV_USE_OS
+    lv_profiler_builtin_ring_t * ring = ring_get(ctx, ctx->config.tid_get_cb());
+#else
+    lv_profiler_builtin_ring_t * ring = ring_get(ctx, 1);
+#endif
+    if(ring == NULL) {
+        return;
+    }
+
+    /*Only this thread writes `head` so it can be read directly*/
+    uint32_t head = ring->head;
+    uint32_t used = head - LV_PROFILER_LOAD_ACQUIRE(&ring->tail);
+
+    if(used >= ring->size) {
+#if LV_USE_OS
+        /*Don't wait for the drain thread as it would distort the measurement*/
+        LV_PROFILER_STORE_RELEASE(&ring->dropped, ring->dropped + 1);
+        return;
+#else
+        flush_no_lock();
+        used = 0;
+#endif
+    }
+
+    lv_profiler_builtin_item_t * item = &ring->items[head & (ring->size - 1)];
+    item->func = func;
+    item->tag = tag;
+    item->tick = ctx->config.tick_get_cb();
+
+#if LV_USE_OS
+    item->cpu = ctx->config.cpu_get_cb();
+#endif
+
+    LV_PROFILER_STORE_RELEASE(&ring->head, head + 1);
+
+#if LV_USE_OS
+    /*Wake up the drain thread once when the ring gets half full*/
+    if(used + 1 == ring->size / 2) {
+        lv_thread_sync_signal(&ctx->drain_sync);
+    }
+#endif
+}
+
+/**
+ * Find the ring of a thread or add a new one if the thread has no ring yet
+ * @param ctx       the profiler context
+ * @param tid       ID of the thread
+ * @return          the ring of the thread or NULL if there are no more free rings
+ */
+static lv_profiler_builtin_ring_t * ring_get(lv_profiler_builtin_ctx_t * ctx, int tid)
+{
+    /*The rings are never removed, and `ring_cnt` is increased only after the ring is initialized*/
+    uint32_t cnt = LV_PROFILER_LOAD_ACQUIRE(&ctx->ring_cnt);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(ctx->rings[i].tid == tid) return &ctx->rings[i];
+    }
+
+#if LV_USE_OS
+    lv_mutex_lock(&ctx->mutex);
+#endif
+    lv_profiler_builtin_ring_t * ring = NULL;
+    if(ctx->ring_cnt >= LV_PROFILER_RING_MAX) {
+        LV_LOG_WARN("no more rings for thread %d, increase LV_PROFILER_RING_MAX", tid);
+    }
+    else {
+        lv_profiler_builtin_item_t * items = lv_malloc(ctx->ring_size * sizeof(lv_profiler_builtin_item_t));
+        LV_ASSERT_MALLOC(items);
+        if(items) {
+            ring = &ctx->rings[ctx->ring_cnt];
+            lv_memzero(ring, sizeof(lv_profiler_builtin_ring_t));
+            ring->items = items;
+            ring->size = ctx->ring_size;
+            ring->tid = tid;
+            LV_PROFILER_STORE_RELEASE(&ctx->ring_cnt, ctx->ring_cnt + 1);
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&ctx->mutex);
+#endif
+
+    return ring;
+}
+
+/**
+ * Write out and free the items of all the rings. Called as the only consumer of the rings.
+ */
 static void flush_no_lock(void)
 {
-    if(!profiler_ctx->config.flush_cb) {
+    if(!profiler_ctx->config.flush_cb && !profiler_ctx->config.flush_bin_cb) {
         LV_LOG_WARN("flush_cb is not registered");
-        return;
     }
 
-    uint32_t cur = 0;
+    uint32_t cnt = LV_PROFILER_LOAD_ACQUIRE(&profiler_ctx->ring_cnt);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_profiler_builtin_ring_t * ring = &profiler_ctx->rings[i];
+        uint32_t tail = ring->tail;
+        uint32_t head = LV_PROFILER_LOAD_ACQUIRE(&ring->head);
+
+        if(profiler_ctx->config.flush_bin_cb) {
+            flush_ring_bin(ring, tail, head);
+        }
+        else if(profiler_ctx->config.flush_cb) {
+            flush_ring_text(ring, tail, head);
+        }
+
+        /*Release the items for the owner thread*/
+        LV_PROFILER_STORE_RELEASE(&ring->tail, head);
+    }
+
+    if(profiler_ctx->bin_len) {
+        profiler_ctx->config.flush_bin_cb(profiler_ctx->bin_buf, profiler_ctx->bin_len);
+        profiler_ctx->bin_len = 0;
+    }
+}
+
+static void flush_ring_text(lv_profiler_builtin_ring_t * ring, uint32_t tail, uint32_t head)
+{
     char buf[LV_PROFILER_STR_MAX_LEN];
     uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
-    while(cur < profiler_ctx->cur_index) {
-        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
+    while(tail != head) {
+        lv_profiler_builtin_item_t * item = &ring->items[tail & (ring->size - 1)];
+        tail++;
         uint64_t sec = item->tick / tick_per_sec;
         uint64_t nsec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
 
 #if LV_USE_OS
         lv_snprintf(buf, sizeof(buf),
                     "   LVGL-%d [%d] %" LV_PRIu64 ".%09" LV_PRIu64 ": tracing_mark_write: %c|1|%s\n",
-                    item->tid,
+                    ring->tid,
                     item->cpu,
                     sec,
                     nsec,
@@ -265,6 +470,164 @@ static void flush_no_lock(void)
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
+
+    uint32_t dropped = LV_PROFILER_LOAD_ACQUIRE(&ring->dropped);
+    if(dropped != ring->dropped_reported) {
+        LV_LOG_WARN("thread %d dropped %d items", ring->tid, (int)(dropped - ring->dropped_reported));
+        ring->dropped_reported = dropped;
+    }
+}
+
+static void flush_ring_bin(lv_profiler_builtin_ring_t * ring, uint32_t tail, uint32_t head)
+{
+    uint8_t rec[LV_PROFILER_BIN_EVENT_SIZE];
+    while(tail != head) {
+        lv_profiler_builtin_item_t * item = &ring->items[tail & (ring->size - 1)];
+        tail++;
+        uint16_t id = bin_name_id_get(item->func);
+
+        uint8_t * p = rec;
+        *p++ = (uint8_t)item->tag;
+#if LV_USE_OS
+        *p++ = (uint8_t)item->cpu;
+#else
+        *p++ = 0;
+#endif
+        p = put_u16(p, id);
+        p = put_u32(p, (uint32_t)ring->tid);
+        put_u64(p, item->tick);
+        bin_write(rec, LV_PROFILER_BIN_EVENT_SIZE);
+    }
+
+    uint32_t dropped = LV_PROFILER_LOAD_ACQUIRE(&ring->dropped);
+    if(dropped != ring->dropped_reported) {
+        uint8_t * p = rec;
+        *p++ = LV_PROFILER_BIN_RECORD_DROP;
+        *p++ = 0;
+        p = put_u16(p, 0);
+        p = put_u32(p, (uint32_t)ring->tid);
+        put_u32(p, dropped - ring->dropped_reported);
+        bin_write(rec, LV_PROFILER_BIN_DROP_SIZE);
+        ring->dropped_reported = dropped;
+    }
+}
+
+/**
+ * Get the ID of a function name for the binary format.
+ * A name record is written when a name is seen the first time.
+ * @param func      the name of the function. Only its address is compared.
+ * @return          the ID of the name
+ */
+static uint16_t bin_name_id_get(const char * func)
+{
+    /*Keep the load factor below 1/2*/
+    if((profiler_ctx->name_cnt + 1) * 2 > profiler_ctx->name_table_size) {
+        uint32_t new_size = profiler_ctx->name_table_size ? profiler_ctx->name_table_size * 2 :
+                            LV_PROFILER_NAME_TABLE_MIN_SIZE;
+        lv_profiler_builtin_name_t * new_names = lv_malloc_zeroed(new_size * sizeof(lv_profiler_builtin_name_t));
+        LV_ASSERT_MALLOC(new_names);
+        if(new_names == NULL) return 0;
+
+        uint32_t i;
+        for(i = 0; i < profiler_ctx->name_table_size; i++) {
+            lv_profiler_builtin_name_t * old = &profiler_ctx->names[i];
+            if(old->func == NULL) continue;
+            uint32_t j = (uint32_t)(((lv_uintptr_t)old->func >> 2) * 0x9E3779B1u) & (new_size - 1);
+            while(new_names[j].func) j = (j + 1) & (new_size - 1);
+            new_names[j] = *old;
+        }
+
+        lv_free(profiler_ctx->names);
+        profiler_ctx->names = new_names;
+        profiler_ctx->name_table_size = new_size;
+    }
+
+    uint32_t mask = profiler_ctx->name_table_size - 1;
+    uint32_t i = (uint32_t)(((lv_uintptr_t)func >> 2) * 0x9E3779B1u) & mask;
+    while(profiler_ctx->names[i].func) {
+        if(profiler_ctx->names[i].func == func) return profiler_ctx->names[i].id;
+        i = (i + 1) & mask;
+    }
+
+    if(profiler_ctx->name_cnt > UINT16_MAX) {
+        LV_LOG_WARN("too many names");
+        return 0;
+    }
+
+    uint16_t id = (uint16_t)profiler_ctx->name_cnt;
+    profiler_ctx->names[i].func = func;
+    profiler_ctx->names[i].id = id;
+    profiler_ctx->name_cnt++;
+
+    size_t len = lv_strlen(func);
+    if(len > UINT8_MAX) len = UINT8_MAX;
+
+    uint8_t rec[4];
+    rec[0] = LV_PROFILER_BIN_RECORD_NAME;
+    rec[1] = (uint8_t)len;
+    put_u16(&rec[2], id);
+    bin_write(rec, sizeof(rec));
+    bin_write(func, (uint32_t)len);
+
+    return id;
+}
+
+static void bin_write(const void * data, uint32_t len)
+{
+    if(profiler_ctx->bin_len + len > LV_PROFILER_BIN_BUF_SIZE) {
+        profiler_ctx->config.flush_bin_cb(profiler_ctx->bin_buf, profiler_ctx->bin_len);
+        profiler_ctx->bin_len = 0;
+    }
+
+    lv_memcpy(&profiler_ctx->bin_buf[profiler_ctx->bin_len], data, len);
+    profiler_ctx->bin_len += len;
+}
+
+static void bin_write_header(void)
+{
+    uint8_t header[LV_PROFILER_BIN_HEADER_SIZE] = {0};
+    lv_memcpy(header, LV_PROFILER_BIN_MAGIC, 4);
+    header[4] = LV_PROFILER_BIN_VERSION;
+    put_u32(&header[8], profiler_ctx->config.tick_per_sec);
+
+    profiler_ctx->config.flush_bin_cb(header, sizeof(header));
 }
 
+static uint8_t * put_u16(uint8_t * p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t * put_u32(uint8_t * p, uint32_t v)
+{
+    p = put_u16(p, (uint16_t)v);
+    return put_u16(p, (uint16_t)(v >> 16));
+}
+
+static uint8_t * put_u64(uint8_t * p, uint64_t v)
+{
+    p = put_u32(p, (uint32_t)v);
+    return put_u32(p, (uint32_t)(v >> 32));
+}
+
+#if LV_USE_OS
+static void drain_thread_cb(void * ptr)
+{
+    lv_profiler_builtin_ctx_t * ctx = ptr;
+
+    while(1) {
+        lv_thread_sync_wait(&ctx->drain_sync);
+        if(ctx->drain_exit) {
+            break;
+        }
+
+        lv_mutex_lock(&ctx->mutex);
+        flush_no_lock();
+        lv_mutex_unlock(&ctx->mutex);
+    }
+}
+#endif
+
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -22,6 +22,22 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/* Binary trace format written to `flush_bin_cb`. All numbers are little endian.
+ * The stream starts with a header:
+ *   "LVPT" magic, u8 version, 3 reserved bytes, u32 tick_per_sec
+ * followed by records. The first byte of a record tells its type:
+ *   'N': name, u8 length, u16 ID, `length` characters of the name without '\0'
+ *   'B' or 'E': begin or end event, u8 CPU, u16 name ID, u32 thread ID, u64 tick
+ *   'D': dropped events, u8 0, u16 0, u32 thread ID, u32 number of events dropped on that thread
+ * `scripts/trace_bin_to_json.py` converts it to Chrome/Perfetto JSON.*/
+#define LV_PROFILER_BIN_MAGIC           "LVPT"
+#define LV_PROFILER_BIN_VERSION         1
+#define LV_PROFILER_BIN_HEADER_SIZE     12
+#define LV_PROFILER_BIN_RECORD_NAME     'N'
+#define LV_PROFILER_BIN_RECORD_DROP     'D'
+#define LV_PROFILER_BIN_EVENT_SIZE      16
+#define LV_PROFILER_BIN_DROP_SIZE       12
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,10 +46,12 @@ extern "C" {
  * @brief LVGL profiler built-in configuration structure
  */
 struct _lv_profiler_builtin_config_t {
-    size_t buf_size;                    /**< The size of the buffer used for profiling data */
+    size_t buf_size;                    /**< The size of the buffer of each profiled thread */
     uint32_t tick_per_sec;              /**< The number of ticks per second */
     uint64_t (*tick_get_cb)(void);      /**< Callback function to get the current tick count */
     void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
+    void (*flush_bin_cb)(const void * buf, uint32_t size); /**< If set, flush the data in the binary
+                                                            *   format to this callback instead of `flush_cb`*/
     int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
     int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
 };
@@ -228,6 +228,8 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     lv_ll_clear(&disp->sync_areas);
+    lv_free(disp->inv_areas);
+    lv_free(disp->inv_area_joined);
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -1142,6 +1144,20 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+void lv_display_get_refr_stats(lv_display_t * disp, lv_display_refr_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        lv_memzero(stats, sizeof(lv_display_refr_stats_t));
+        return;
+    }
+
+    *stats = disp->refr_stats_last;
+}
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
@@ -1413,8 +1429,7 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+    if(disp->inv_area_joined) lv_memzero(disp->inv_area_joined, disp->inv_area_cap * sizeof(uint8_t));
     disp->inv_p = 0;
     lv_obj_invalidate(disp->sys_layer);
 
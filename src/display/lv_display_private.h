@@ -23,7 +23,15 @@ extern "C" {
  *      DEFINES
  *********************/
 #ifndef LV_INV_BUF_SIZE
-#define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
+#define LV_INV_BUF_SIZE 32 /**< Initial buffer size for invalid areas */
+#endif
+
+#ifndef LV_INV_BUF_MAX_SIZE
+#define LV_INV_BUF_MAX_SIZE (LV_INV_BUF_SIZE * 16) /**< The buffer of the invalid areas can grow up to this size */
+#endif
+
+#ifndef LV_INV_AREA_OVERHEAD
+#define LV_INV_AREA_OVERHEAD 512 /**< Cost of rendering an area in addition to its pixels, used to join areas */
 #endif
 
 /**********************
@@ -122,12 +130,16 @@ struct _lv_display_t {
 
     lv_color_format_t   color_format;
 
-    /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    /** Invalidated (marked to redraw) areas. Grows on demand up to `LV_INV_BUF_MAX_SIZE` areas*/
+    lv_area_t * inv_areas;
+    uint8_t * inv_area_joined;
     uint32_t inv_p;
+    uint32_t inv_area_cap;       /**< Number of areas `inv_areas` and `inv_area_joined` can store*/
     int32_t inv_en_cnt;
 
+    lv_display_refr_stats_t refr_stats;         /**< Counters of the frame being collected*/
+    lv_display_refr_stats_t refr_stats_last;    /**< Counters of the last rendered frame*/
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
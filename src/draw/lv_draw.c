@@ -32,9 +32,14 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
+static inline void update_frontier(lv_layer_t * layer, lv_draw_task_t * t, bool * frontier_passed);
+static uint64_t get_tile_mask(const lv_layer_t * layer, const lv_area_t * area);
+static inline const lv_area_t * get_touched_area(const lv_draw_task_t * t);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static lv_draw_task_t * task_alloc(size_t size);
+static void task_free(lv_draw_task_t * t);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -77,6 +82,15 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    lv_draw_task_arena_chunk_t * chunk = arena->chunk_head;
+    while(chunk) {
+        lv_draw_task_arena_chunk_t * chunk_next = chunk->next;
+        lv_free(chunk);
+        chunk = chunk_next;
+    }
+    lv_memzero(arena, sizeof(lv_draw_task_arena_t));
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -98,7 +112,7 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    lv_draw_task_t * new_task = task_alloc(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -111,17 +125,16 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     new_task->type = type;
     new_task->draw_dsc = (uint8_t *)new_task + LV_ALIGN_UP(sizeof(lv_draw_task_t), 8);
     new_task->state = LV_DRAW_TASK_STATE_WAITING;
+    new_task->tile_mask = get_tile_mask(layer, coords);
 
-    /*Find the tail*/
+    /*Append to the tail*/
     if(layer->draw_task_head == NULL) {
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
     }
+    layer->draw_task_tail = new_task;
 
     LV_PROFILER_DRAW_END;
     return new_task;
@@ -133,6 +146,9 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+    /*`_real_area` might have been updated since the task was added*/
+    t->tile_mask = get_tile_mask(layer, get_touched_area(t));
+
     lv_draw_global_info_t * info = &_draw_info;
 
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
@@ -230,12 +246,18 @@ void lv_draw_dispatch(void)
 bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
-    /*Remove the finished tasks first*/
+    /*Remove the finished tasks first. Only the tasks up to the dispatch frontier could be given
+     *to the draw units, so stop there, but always remove the finished tasks from the head.*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
     lv_draw_task_t * t_next;
+    lv_draw_task_t * frontier = layer->_dispatch_frontier;
+    bool frontier_passed = frontier == NULL;
     bool remove_task = false;
     while(t) {
+        if(frontier_passed && t_prev != NULL) break;
+        if(t == frontier) frontier_passed = true;
+
         t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_FINISHED) {
             cleanup_task(t, disp);
@@ -244,6 +266,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                 t_prev->next = t_next;
             else
                 layer->draw_task_head = t_next;
+
+            if(t_next == NULL) layer->draw_task_tail = t_prev;
+            if(t == frontier) layer->_dispatch_frontier = t_prev;
         }
         else {
             t_prev = t;
@@ -251,6 +276,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    /*The cursor might point to a removed task*/
+    if(remove_task) layer->_dispatch_cursor = NULL;
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -344,16 +372,44 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         }
     }
 
-    lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
+    /*Collect the tiles touched by the unfinished tasks before the first candidate.
+     *If continuing from the previously returned task, start from the tiles collected back then.
+     *As tasks can only get finished meanwhile, the saved tiles can only be a superset of the real ones.*/
+    lv_draw_task_t * t = layer->draw_task_head;
+    uint64_t busy_tiles = 0;
+    bool frontier_passed = layer->_dispatch_frontier == NULL;
+    if(t_prev) {
+        if(t_prev == layer->_dispatch_cursor) {
+            t = t_prev;
+            busy_tiles = layer->_dispatch_busy_tiles;
+        }
+
+        while(t != t_prev) {
+            if(t->state != LV_DRAW_TASK_STATE_FINISHED) busy_tiles |= t->tile_mask;
+            update_frontier(layer, t, &frontier_passed);
+            t = t->next;
+        }
+
+        if(t_prev->state != LV_DRAW_TASK_STATE_FINISHED) busy_tiles |= t_prev->tile_mask;
+        update_frontier(layer, t_prev, &frontier_passed);
+        t = t_prev->next;
+    }
+
     while(t) {
-        /*Find a draw task for this draw unit which is waiting and independent?*/
+        update_frontier(layer, t, &frontier_passed);
+
+        /*Find a draw task for this draw unit which is waiting and independent?
+         *If none of its tiles are used by older tasks it's surely independent, else check the exact areas.*/
         if((t->preferred_draw_unit_id == draw_unit_id || t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) &&
            t->state == LV_DRAW_TASK_STATE_WAITING &&
-           is_independent(layer, t, draw_unit_id)) {
+           ((t->tile_mask & busy_tiles) == 0 || is_independent(layer, t, draw_unit_id))) {
+            layer->_dispatch_cursor = t;
+            layer->_dispatch_busy_tiles = busy_tiles;
             LV_PROFILER_DRAW_END;
             return t;
         }
 
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED) busy_tiles |= t->tile_mask;
         t = t->next;
     }
 
@@ -575,6 +631,13 @@ void lv_draw_layer_finish_drop_shadow(lv_layer_t * drop_shadow_layer, const lv_d
     lv_draw_layer(drop_shadow_layer->parent, &layer_draw_dsc, &drop_shadow_area);
 }
 
+void lv_draw_task_arena_save_frame_stats(void)
+{
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    arena->alloc_cnt_last = arena->alloc_cnt;
+    arena->alloc_cnt = 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -602,7 +665,8 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t
         }
 
         lv_area_t a;
-        if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+        if((t->tile_mask & t_check->tile_mask) &&
+           lv_area_intersect(&a, get_touched_area(t), get_touched_area(t_check))) {
             LV_PROFILER_DRAW_END;
             return false;
         }
@@ -613,6 +677,59 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t
     return true;
 }
 
+/**
+ * Move the dispatch frontier of the layer to a task if it's after the current frontier.
+ * The tasks should be visited in the order of the list.
+ * @param layer             pointer to a layer
+ * @param t                 the visited draw task
+ * @param frontier_passed   true if the current frontier was visited already, updated by the function
+ */
+static inline void update_frontier(lv_layer_t * layer, lv_draw_task_t * t, bool * frontier_passed)
+{
+    if(*frontier_passed) layer->_dispatch_frontier = t;
+    else if(t == layer->_dispatch_frontier) *frontier_passed = true;
+}
+
+/**
+ * Get the area whose pixels can be written by a draw task.
+ * @param t     pointer to a draw task
+ * @return      `_real_area`, or the clip area for labels as their glyphs
+ *              can stick out of the coordinates (e.g. the last letter of a wrapped line)
+ */
+static inline const lv_area_t * get_touched_area(const lv_draw_task_t * t)
+{
+    return t->type == LV_DRAW_TASK_TYPE_LABEL ? &t->clip_area : &t->_real_area;
+}
+
+/**
+ * Get which tiles of the layer are touched by an area.
+ * The layer's buffer area is divided into `LV_DRAW_TILE_CNT` x `LV_DRAW_TILE_CNT` tiles
+ * and the area is clamped onto the edge tiles if it's outside of the buffer area.
+ * @param layer     pointer to a layer
+ * @param area      the area to check
+ * @return          a bitmask where bit `row * LV_DRAW_TILE_CNT + col` is set for each touched tile
+ */
+static uint64_t get_tile_mask(const lv_layer_t * layer, const lv_area_t * area)
+{
+    const lv_area_t * buf_area = &layer->buf_area;
+    int32_t tile_w = LV_MAX(1, (lv_area_get_width(buf_area) + LV_DRAW_TILE_CNT - 1) / LV_DRAW_TILE_CNT);
+    int32_t tile_h = LV_MAX(1, (lv_area_get_height(buf_area) + LV_DRAW_TILE_CNT - 1) / LV_DRAW_TILE_CNT);
+
+    int32_t col1 = LV_CLAMP(0, (area->x1 - buf_area->x1) / tile_w, LV_DRAW_TILE_CNT - 1);
+    int32_t col2 = LV_CLAMP(0, (area->x2 - buf_area->x1) / tile_w, LV_DRAW_TILE_CNT - 1);
+    int32_t row1 = LV_CLAMP(0, (area->y1 - buf_area->y1) / tile_h, LV_DRAW_TILE_CNT - 1);
+    int32_t row2 = LV_CLAMP(0, (area->y2 - buf_area->y1) / tile_h, LV_DRAW_TILE_CNT - 1);
+
+    uint64_t row_bits = ((1ULL << (col2 - col1 + 1)) - 1) << col1;
+    uint64_t mask = 0;
+    int32_t row;
+    for(row = row1; row <= row2; row++) {
+        mask |= row_bits << (row * LV_DRAW_TILE_CNT);
+    }
+
+    return mask;
+}
+
 /**
  * Get the size of the draw descriptor of a draw task
  * @param type      type of the draw task
@@ -729,7 +846,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
 
@@ -758,6 +875,97 @@ static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
         t = t->next;
     }
 
+    /*The head is never after the frontier*/
+    if(t && layer->_dispatch_frontier == NULL) layer->_dispatch_frontier = t;
+
     LV_PROFILER_DRAW_END;
     return t;
 }
+
+/**
+ * Allocate a zeroed draw task with its descriptor.
+ * Small enough tasks are bump allocated from the chunks of the draw task arena,
+ * others (or all if `LV_DRAW_TASK_ARENA_CHUNK_SIZE` is 0) are allocated by `lv_malloc`.
+ * @param size      size of the draw task and its descriptor in bytes
+ * @return          the allocated draw task or `NULL` on error
+ */
+static lv_draw_task_t * task_alloc(size_t size)
+{
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE > 0
+    const size_t header_size = LV_ALIGN_UP(sizeof(lv_draw_task_arena_chunk_t), 8);
+    const size_t capacity = LV_DRAW_TASK_ARENA_CHUNK_SIZE - header_size;
+    size = LV_ALIGN_UP(size, 8);
+
+    if(size <= capacity) {
+        lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+        lv_draw_task_arena_chunk_t * chunk = arena->chunk_act;
+        if(chunk == NULL || chunk->used + size > capacity) {
+            /*Continue in an empty chunk or add a new one*/
+            chunk = arena->chunk_head;
+            while(chunk && chunk->live_cnt > 0) chunk = chunk->next;
+
+            if(chunk == NULL) {
+                chunk = lv_malloc(LV_DRAW_TASK_ARENA_CHUNK_SIZE);
+                if(chunk) {
+                    chunk->live_cnt = 0;
+                    chunk->next = arena->chunk_head;
+                    arena->chunk_head = chunk;
+                    arena->chunk_cnt++;
+                }
+            }
+
+            if(chunk) {
+                chunk->used = 0;
+                arena->chunk_act = chunk;
+            }
+        }
+
+        if(chunk) {
+            lv_draw_task_t * t = (lv_draw_task_t *)((uint8_t *)chunk + header_size + chunk->used);
+            lv_memzero(t, size);
+            t->arena_chunk = chunk;
+            chunk->used += size;
+            chunk->live_cnt++;
+            arena->live_cnt++;
+            arena->alloc_cnt++;
+            return t;
+        }
+    }
+#endif
+
+    return lv_malloc_zeroed(size);
+}
+
+/**
+ * Free a draw task allocated by `task_alloc()`.
+ * When all the tasks of the arena are freed, keep only the chunk
+ * used last to limit the memory kept between the frames.
+ * @param t         pointer to a draw task
+ */
+static void task_free(lv_draw_task_t * t)
+{
+    lv_draw_task_arena_chunk_t * chunk = t->arena_chunk;
+    if(chunk == NULL) {
+        lv_free(t);
+        return;
+    }
+
+    lv_draw_task_arena_t * arena = &_draw_info.task_arena;
+    chunk->live_cnt--;
+    if(chunk->live_cnt == 0) chunk->used = 0;
+
+    arena->live_cnt--;
+    if(arena->live_cnt > 0) return;
+
+    chunk = arena->chunk_head;
+    while(chunk) {
+        lv_draw_task_arena_chunk_t * chunk_next = chunk->next;
+        if(chunk != arena->chunk_act) {
+            lv_free(chunk);
+            arena->chunk_cnt--;
+        }
+        chunk = chunk_next;
+    }
+    arena->chunk_head = arena->chunk_act;
+    arena->chunk_head->next = NULL;
+}
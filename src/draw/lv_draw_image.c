@@ -30,6 +30,17 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
 
+/**
+ * Adjust the draw descriptor and coordinates to draw the downscaled image at the same place and size
+ * @param new_dsc       store the adjusted draw descriptor here
+ * @param new_coords    store the adjusted coordinates here
+ * @param draw_dsc      the original draw descriptor
+ * @param coords        the original coordinates of the image
+ * @param downscale     the value returned by `lv_draw_image_get_downscale`
+ */
+static void downscale_draw_dsc(lv_draw_image_dsc_t * new_dsc, lv_area_t * new_coords,
+                               const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords, uint8_t downscale);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -229,9 +240,21 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+    /*Decode the image at lower resolution if it's drawn smaller anyway*/
+    lv_draw_image_dsc_t downscaled_dsc;
+    lv_area_t downscaled_coords;
+    uint8_t downscale = lv_draw_image_get_downscale(draw_dsc, coords);
+    if(downscale) {
+        downscale_draw_dsc(&downscaled_dsc, &downscaled_coords, draw_dsc, coords, downscale);
+        draw_dsc = &downscaled_dsc;
+        coords = &downscaled_coords;
+    }
+
+    bool transformed = draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE;
+
     lv_area_t draw_area;
     lv_area_copy(&draw_area, coords);
-    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
+    if(transformed) {
         int32_t w = lv_area_get_width(coords);
         int32_t h = lv_area_get_height(coords);
 
@@ -249,8 +272,21 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+    lv_image_decoder_args_t args;
+    if(decoder_args) {
+        args = *decoder_args;
+    }
+    else {
+        lv_memzero(&args, sizeof(args));
+        args.stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1;
+    }
+    args.downscale = downscale;
+
+    /*The bands returned by `get_area_cb` can be drawn only without transformation*/
+    if(!transformed) args.use_get_area = true;
+
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, decoder_args);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -348,6 +384,23 @@ void lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, in
     res->y2 = LV_MAX4(p[0].y, p[1].y, p[2].y, p[3].y);
 }
 
+uint8_t lv_draw_image_get_downscale(const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords)
+{
+    if(!(draw_dsc->header.flags & LV_IMAGE_FLAGS_DOWNSCALABLE)) return 0;
+    if(draw_dsc->scale_x > LV_SCALE_NONE / 2 || draw_dsc->scale_y > LV_SCALE_NONE / 2) return 0;
+
+    /*Only if the whole image is drawn and it is only scaled or rotated*/
+    if(draw_dsc->tile || draw_dsc->skew_x || draw_dsc->skew_y) return 0;
+    if(draw_dsc->clip_radius || draw_dsc->bitmap_mask_src) return 0;
+    if(!lv_area_is_equal(&draw_dsc->image_area, coords)) return 0;
+    if(lv_area_get_width(coords) != draw_dsc->header.w || lv_area_get_height(coords) != draw_dsc->header.h) return 0;
+
+    int32_t scale = LV_MAX(draw_dsc->scale_x, draw_dsc->scale_y);
+    if(scale * 8 <= LV_SCALE_NONE) return 8;
+    if(scale * 4 <= LV_SCALE_NONE) return 4;
+    return 2;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -394,3 +447,23 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         }
     }
 }
+
+static void downscale_draw_dsc(lv_draw_image_dsc_t * new_dsc, lv_area_t * new_coords,
+                               const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords, uint8_t downscale)
+{
+    *new_dsc = *draw_dsc;
+    new_dsc->header.w = (draw_dsc->header.w + downscale - 1) / downscale;
+    new_dsc->header.h = (draw_dsc->header.h + downscale - 1) / downscale;
+    new_dsc->header.stride = 0;
+    new_dsc->scale_x = draw_dsc->scale_x * downscale;
+    new_dsc->scale_y = draw_dsc->scale_y * downscale;
+    new_dsc->pivot.x = draw_dsc->pivot.x / downscale;
+    new_dsc->pivot.y = draw_dsc->pivot.y / downscale;
+
+    /*Keep the pivot at the same place on the screen*/
+    new_coords->x1 = coords->x1 + draw_dsc->pivot.x - new_dsc->pivot.x;
+    new_coords->y1 = coords->y1 + draw_dsc->pivot.y - new_dsc->pivot.y;
+    new_coords->x2 = new_coords->x1 + new_dsc->header.w - 1;
+    new_coords->y2 = new_coords->y1 + new_dsc->header.h - 1;
+    new_dsc->image_area = *new_coords;
+}
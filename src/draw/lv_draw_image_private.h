@@ -65,6 +65,14 @@ void lv_draw_image_tiled_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb,
                                 const lv_image_decoder_args_t * decoder_args);
 
+/**
+ * Get how much an image can be downscaled by its decoder as it's drawn smaller anyway
+ * @param draw_dsc      the draw descriptor of the image
+ * @param coords        the absolute coordinates of the image
+ * @return              0: not downscaled, or the downscale factor: 2, 4 or 8
+ */
+uint8_t lv_draw_image_get_downscale(const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords);
+
 /**
  * Get the area of a rectangle if its rotated and scaled
  * @param res store the coordinates here
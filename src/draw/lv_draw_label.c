@@ -37,6 +37,9 @@ typedef unsigned char cmd_state_t;
  *  STATIC PROTOTYPES
  **********************/
 static uint8_t hex_char_to_num(char hex);
+static int32_t get_max_width(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
+static bool lines_match(const lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc, int32_t max_width);
+static bool lines_reserve(lv_draw_label_lines_t * lines, uint32_t cnt);
 
 /**********************
  *  STATIC VARIABLES
@@ -210,9 +213,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
                                       const lv_area_t * coords,
                                       lv_draw_glyph_cb_t cb)
 {
-    lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     const lv_font_t * font = dsc->font;
-    int32_t w;
 
     lv_area_t clipped_area;
     bool clip_ok = lv_area_intersect(&clipped_area, coords, &t->clip_area);
@@ -223,28 +224,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
-    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
-        /*Normally use the label's width as width*/
-        w = lv_area_get_width(coords);
-    }
-    else {
-        /*If EXPAND is enabled then not limit the text's width to the object's width*/
-        if(base_dsc->obj && !lv_obj_is_send_draw_task_events(base_dsc->obj)) {
-            w = dsc->text_size.x;
-        }
-        else {
-            lv_text_attributes_t attributes = {0};
-
-            attributes.letter_space = dsc->letter_space;
-            attributes.line_space = dsc->line_space;
-            attributes.max_width = LV_COORD_MAX;
-            attributes.text_flags = dsc->flag;
-
-            lv_point_t p;
-            lv_text_get_size_attributes(&p, dsc->text, dsc->font, &attributes);
-            w = p.x;
-        }
-    }
+    int32_t w = get_max_width(dsc, coords);
 
     int32_t line_height_font = lv_font_get_line_height(font);
     int32_t line_height = line_height_font + dsc->line_space;
@@ -261,58 +241,80 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
-    int32_t last_line_start = -1;
-
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
-        /*If the label changed too much recalculate the hint.*/
-        if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
-            dsc->hint->line_start = -1;
-        }
-        last_line_start = dsc->hint->line_start;
-    }
-
-    /*Use the hint if it's valid*/
-    if(dsc->hint && last_line_start >= 0) {
-        line_start = last_line_start;
-        pos.y += dsc->hint->y;
-    }
-
+    uint32_t line_end;
     uint32_t remaining_len = dsc->text_length;
     lv_text_attributes_t attributes = {0};
     attributes.letter_space = dsc->letter_space;
     attributes.text_flags = dsc->flag;
     attributes.max_width = w;
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+    /*Use the line table only if it was calculated for the same text and wrapping*/
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines && (line_height <= 0 || !lines_match(lines, dsc, w))) lines = NULL;
+    uint32_t line_idx = 0;
 
-    /*Go the first visible line*/
-    while(pos.y + line_height_font < t->clip_area.y1) {
-        /*Go to next line*/
-        remaining_len -= line_end - line_start;
-        line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
-        pos.y += line_height;
+    if(lines) {
+        /*Jump to the first visible line*/
+        if(pos.y + line_height_font < t->clip_area.y1) {
+            line_idx = (t->clip_area.y1 - line_height_font - pos.y + line_height - 1) / line_height;
+            pos.y += (int32_t)line_idx * line_height;
+        }
+        if(line_idx >= lines->line_cnt) return;
 
-        /*Save at the threshold coordinate*/
-        if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
-            dsc->hint->line_start = line_start;
-            dsc->hint->y          = pos.y - coords->y1;
-            dsc->hint->coord_y    = coords->y1;
+        line_start = lines->lines[line_idx].start;
+        line_end = lines->lines[line_idx + 1].start;
+        remaining_len -= line_start;
+    }
+    else {
+        int32_t last_line_start = -1;
+
+        /*Check the hint to use the cached info*/
+        if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+            /*If the label changed too much recalculate the hint.*/
+            if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
+                dsc->hint->line_start = -1;
+            }
+            last_line_start = dsc->hint->line_start;
         }
 
-        if(dsc->text[line_start] == '\0') return;
+        /*Use the hint if it's valid*/
+        if(dsc->hint && last_line_start >= 0) {
+            line_start = last_line_start;
+            pos.y += dsc->hint->y;
+        }
+
+        line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+
+        /*Go the first visible line*/
+        while(pos.y + line_height_font < t->clip_area.y1) {
+            /*Go to next line*/
+            remaining_len -= line_end - line_start;
+            line_start = line_end;
+            line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
+            pos.y += line_height;
+
+            /*Save at the threshold coordinate*/
+            if(dsc->hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && dsc->hint->line_start < 0) {
+                dsc->hint->line_start = line_start;
+                dsc->hint->y          = pos.y - coords->y1;
+                dsc->hint->coord_y    = coords->y1;
+            }
+
+            if(dsc->text[line_start] == '\0') return;
+        }
     }
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        line_width = lines ? lines->lines[line_idx].width :
+                     lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
+        line_width = lines ? lines->lines[line_idx].width :
+                     lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &attributes);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -540,22 +542,27 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         /*Go to next line*/
         remaining_len -= line_end - line_start;
         line_start = line_end;
-        if(remaining_len) {
+        if(lines) {
+            line_idx++;
+            if(line_idx >= lines->line_cnt) break;
+            line_end = lines->lines[line_idx + 1].start;
+        }
+        else if(remaining_len) {
             line_end += lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &text_attributes);
         }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            line_width = lines ? lines->lines[line_idx].width :
+                         lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
+            line_width = lines ? lines->lines[line_idx].width :
+                         lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, &text_attributes);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -570,10 +577,141 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                                const lv_area_t * coords)
+{
+    int32_t w = get_max_width(dsc, coords);
+    if(lines_match(lines, dsc, w)) return true;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    lines->valid = 0;
+    lines->line_cnt = 0;
+    lines->text = dsc->text;
+    lines->text_length = dsc->text_length;
+    lines->font = dsc->font;
+    lines->max_width = w;
+    lines->letter_space = dsc->letter_space;
+    lines->flag = dsc->flag;
+
+    lv_text_attributes_t attributes = {0};
+    attributes.letter_space = dsc->letter_space;
+    attributes.text_flags = dsc->flag;
+    attributes.max_width = w;
+
+    /*Break the lines the same way as `lv_draw_label_iterate_characters` does*/
+    const char * text = dsc->text;
+    uint32_t remaining_len = dsc->text_length;
+    uint32_t line_start = 0;
+    while(remaining_len && text[line_start] != '\0') {
+        uint32_t line_len = lv_text_get_next_line(&text[line_start], remaining_len, dsc->font, NULL, &attributes);
+        if(line_len == 0) break;
+
+        if(!lines_reserve(lines, lines->line_cnt + 2)) {
+            LV_PROFILER_DRAW_END;
+            return false;
+        }
+
+        lines->lines[lines->line_cnt].start = line_start;
+        lines->lines[lines->line_cnt].width = lv_text_get_width(&text[line_start], line_len, dsc->font, &attributes);
+        lines->line_cnt++;
+
+        remaining_len -= line_len;
+        line_start += line_len;
+    }
+
+    if(!lines_reserve(lines, lines->line_cnt + 1)) {
+        LV_PROFILER_DRAW_END;
+        return false;
+    }
+
+    lines->lines[lines->line_cnt].start = line_start;
+    lines->lines[lines->line_cnt].width = 0;
+    lines->valid = 1;
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines)
+{
+    lines->valid = 0;
+}
+
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines)
+{
+    lv_free(lines->lines);
+    lv_memzero(lines, sizeof(lv_draw_label_lines_t));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the width where the text of a label draw descriptor is wrapped
+ * @param dsc       pointer to a label draw descriptor
+ * @param coords    the coordinates of the text
+ * @return          the max. width of the lines
+ */
+static int32_t get_max_width(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    /*Normally use the label's width as width*/
+    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) return lv_area_get_width(coords);
+
+    /*If EXPAND is enabled then not limit the text's width to the object's width*/
+    if(dsc->base.obj && !lv_obj_is_send_draw_task_events(dsc->base.obj)) return dsc->text_size.x;
+
+    lv_text_attributes_t attributes = {0};
+
+    attributes.letter_space = dsc->letter_space;
+    attributes.line_space = dsc->line_space;
+    attributes.max_width = LV_COORD_MAX;
+    attributes.text_flags = dsc->flag;
+
+    lv_point_t p;
+    lv_text_get_size_attributes(&p, dsc->text, dsc->font, &attributes);
+    return p.x;
+}
+
+/**
+ * Check if a line table was calculated for the text and wrapping of a label draw descriptor
+ * @param lines     pointer to a line table
+ * @param dsc       pointer to a label draw descriptor
+ * @param max_width the width where the text is wrapped
+ * @return          true: the line table can be used to draw `dsc`
+ */
+static bool lines_match(const lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc, int32_t max_width)
+{
+    return lines->valid &&
+           lines->text == dsc->text &&
+           lines->text_length == dsc->text_length &&
+           lines->font == dsc->font &&
+           lines->max_width == max_width &&
+           lines->letter_space == dsc->letter_space &&
+           lines->flag == dsc->flag;
+}
+
+/**
+ * Make sure a line table has space for a given number of lines
+ * @param lines     pointer to a line table, its array is reallocated if needed
+ * @param cnt       the required number of lines
+ * @return          true: success; false: out of memory
+ */
+static bool lines_reserve(lv_draw_label_lines_t * lines, uint32_t cnt)
+{
+    if(cnt <= lines->capacity) return true;
+
+    uint32_t new_capacity = LV_MAX(cnt, lines->capacity * 2);
+    lv_draw_label_line_t * new_lines = lv_realloc(lines->lines, new_capacity * sizeof(lv_draw_label_line_t));
+    LV_ASSERT_MALLOC(new_lines);
+    if(new_lines == NULL) return false;
+
+    lines->lines = new_lines;
+    lines->capacity = new_capacity;
+    return true;
+}
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -41,6 +41,29 @@ struct _lv_draw_label_hint_t {
     int32_t coord_y;
 };
 
+/** A line of a wrapped text*/
+typedef struct {
+    uint32_t start;             /**< Byte index of the first character of the line*/
+    int32_t width;              /**< Width of the line in pixels*/
+} lv_draw_label_line_t;
+
+/** The line breaks of a text, so that drawing can start at the first visible line
+ * without wrapping the text before it. The `y` coordinate of a line is `index * (line_height + line_space)`.*/
+struct _lv_draw_label_lines_t {
+    lv_draw_label_line_t * lines;   /**< `line_cnt + 1` lines, the start of the last one is the end of the text*/
+    uint32_t line_cnt;              /**< Number of lines*/
+    uint32_t capacity;              /**< Allocated number of lines*/
+
+    /*The parameters the lines were calculated with*/
+    const char * text;
+    uint32_t text_length;
+    const lv_font_t * font;
+    int32_t max_width;
+    int32_t letter_space;
+    lv_text_flag_t flag;
+    uint8_t valid : 1;
+};
+
 struct _lv_draw_glyph_dsc_t {
     /** Depends on `format` field, it could be image source or draw buf of bitmap or vector data. */
     const void * glyph_data;
@@ -63,6 +86,29 @@ struct _lv_draw_glyph_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Calculate the line breaks of the text of a label draw descriptor if the text or the wrapping
+ * has changed since the last update.
+ * @param lines     the line table to update
+ * @param dsc       the draw descriptor which will be used with `lines`
+ * @param coords    the coordinates where the text will be drawn
+ * @return          true: `lines` is up to date; false: out of memory
+ */
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const lv_draw_label_dsc_t * dsc,
+                                const lv_area_t * coords);
+
+/**
+ * Mark a line table as outdated, e.g. because the text was modified in place
+ * @param lines     the line table
+ */
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines);
+
+/**
+ * Free the memory of a line table
+ * @param lines     the line table
+ */
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines);
+
 /**********************
  *      MACROS
  **********************/
@@ -27,10 +27,30 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of tiles per row and column used to track the draw tasks' area in `tile_mask`*/
+#define LV_DRAW_TILE_CNT    8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** A chunk of memory from which draw tasks are allocated by bumping `used`*/
+typedef struct _lv_draw_task_arena_chunk_t {
+    struct _lv_draw_task_arena_chunk_t * next;
+    uint32_t used;          /**< Bytes handed out from the chunk*/
+    uint32_t live_cnt;      /**< Number of draw tasks in the chunk which are not freed yet*/
+} lv_draw_task_arena_chunk_t;
+
+typedef struct {
+    lv_draw_task_arena_chunk_t * chunk_head;    /**< All the chunks*/
+    lv_draw_task_arena_chunk_t * chunk_act;     /**< The chunk to allocate from*/
+    uint32_t chunk_cnt;
+    uint32_t live_cnt;          /**< Number of draw tasks allocated from the arena and not freed yet*/
+    uint32_t alloc_cnt;         /**< Allocations served in the current frame*/
+    uint32_t alloc_cnt_last;    /**< Allocations served in the last rendered frame.
+                                 *   Saved by `lv_draw_task_arena_save_frame_stats()` after each refresh.*/
+} lv_draw_task_arena_t;
+
 struct _lv_draw_task_t {
     lv_draw_task_t * next;
 
@@ -46,6 +66,12 @@ struct _lv_draw_task_t {
      */
     lv_area_t _real_area;
 
+    /**
+     * Bitmask of the `LV_DRAW_TILE_CNT` x `LV_DRAW_TILE_CNT` tiles of the target layer's `buf_area`
+     * touched by `_real_area` (or `clip_area` for labels). Used to quickly rule out overlapping with other draw tasks.
+     */
+    uint64_t tile_mask;
+
     /** The original area which is updated*/
     lv_area_t clip_area_original;
 
@@ -85,6 +111,8 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** The arena chunk from which the task was allocated or `NULL` if it was allocated by `lv_malloc`*/
+    lv_draw_task_arena_chunk_t * arena_chunk;
 };
 
 struct _lv_draw_mask_t {
@@ -194,12 +222,19 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_task_arena_t task_arena;
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Save the number of draw task allocations served by the draw task arena since the last call.
+ * Called by the display refresher after each rendered frame and reported by `lv_mem_monitor()`.
+ */
+void lv_draw_task_arena_save_frame_stats(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,47 @@
+/**
+ * @file lv_blend_x86.h
+ * x86 SSE2/AVX2 blend header
+ */
+
+#ifndef LV_BLEND_X86_H
+#define LV_BLEND_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lvgl_public.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2
+
+#include "lv_draw_sw_blend_x86_to_rgb565.h"
+#include "lv_draw_sw_blend_x86_to_rgb888.h"
+#include "lv_draw_sw_blend_x86_to_argb8888.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_H*/
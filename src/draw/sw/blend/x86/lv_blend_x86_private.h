@@ -0,0 +1,350 @@
+/**
+ * @file lv_blend_x86_private.h
+ * Thin SSE2/AVX2 abstraction used by the x86 blend routines.
+ *
+ * A vector holds `LV_BLEND_X86_PX` 32 bit lanes. Every pixel is kept in its own
+ * 32 bit lane, so the same kernels work on 4 pixels with SSE2 and on 8 pixels
+ * when the compiler targets AVX2 (e.g. `-mavx2`).
+ */
+
+#ifndef LV_BLEND_X86_PRIVATE_H
+#define LV_BLEND_X86_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lvgl_public.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2
+
+#ifdef __AVX2__
+    #include <immintrin.h>
+#else
+    #include <emmintrin.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#ifdef __AVX2__
+#define LV_BLEND_X86_PX     8
+#else
+#define LV_BLEND_X86_PX     4
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#ifdef __AVX2__
+typedef __m256i lv_blend_x86_vec_t;
+#else
+typedef __m128i lv_blend_x86_vec_t;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __AVX2__
+#define LV_X86_OP(name)     _mm256_##name
+#else
+#define LV_X86_OP(name)     _mm_##name
+#endif
+
+#ifdef __AVX2__
+#define lv_x86_zero()               _mm256_setzero_si256()
+#define lv_x86_and(a, b)            _mm256_and_si256(a, b)
+#define lv_x86_andnot(a, b)         _mm256_andnot_si256(a, b)
+#define lv_x86_or(a, b)             _mm256_or_si256(a, b)
+#else
+#define lv_x86_zero()               _mm_setzero_si128()
+#define lv_x86_and(a, b)            _mm_and_si128(a, b)
+#define lv_x86_andnot(a, b)         _mm_andnot_si128(a, b)
+#define lv_x86_or(a, b)             _mm_or_si128(a, b)
+#endif
+
+#define lv_x86_set1_16(v)           LV_X86_OP(set1_epi16)((int16_t)(v))
+#define lv_x86_set1_32(v)           LV_X86_OP(set1_epi32)((int32_t)(v))
+#define lv_x86_add16(a, b)          LV_X86_OP(add_epi16)(a, b)
+#define lv_x86_sub16(a, b)          LV_X86_OP(sub_epi16)(a, b)
+#define lv_x86_add32(a, b)          LV_X86_OP(add_epi32)(a, b)
+#define lv_x86_sub32(a, b)          LV_X86_OP(sub_epi32)(a, b)
+#define lv_x86_mullo16(a, b)        LV_X86_OP(mullo_epi16)(a, b)
+#define lv_x86_mulhi16(a, b)        LV_X86_OP(mulhi_epu16)(a, b)
+#define lv_x86_srli16(a, n)         LV_X86_OP(srli_epi16)(a, n)
+#define lv_x86_srli32(a, n)         LV_X86_OP(srli_epi32)(a, n)
+#define lv_x86_slli32(a, n)         LV_X86_OP(slli_epi32)(a, n)
+#define lv_x86_cmpeq32(a, b)        LV_X86_OP(cmpeq_epi32)(a, b)
+#define lv_x86_cmpgt32(a, b)        LV_X86_OP(cmpgt_epi32)(a, b)
+#define lv_x86_unpacklo8(a, b)      LV_X86_OP(unpacklo_epi8)(a, b)
+#define lv_x86_unpackhi8(a, b)      LV_X86_OP(unpackhi_epi8)(a, b)
+#define lv_x86_unpacklo32(a, b)     LV_X86_OP(unpacklo_epi32)(a, b)
+#define lv_x86_unpackhi32(a, b)     LV_X86_OP(unpackhi_epi32)(a, b)
+#define lv_x86_packus16(a, b)       LV_X86_OP(packus_epi16)(a, b)
+#define lv_x86_movemask8(a)         LV_X86_OP(movemask_epi8)(a)
+
+#ifdef __AVX2__
+#define LV_X86_MOVEMASK_ALL         ((int)0xFFFFFFFF)
+#else
+#define LV_X86_MOVEMASK_ALL         0xFFFF
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline lv_blend_x86_vec_t lv_x86_load(const void * p)
+{
+#ifdef __AVX2__
+    return _mm256_loadu_si256((const __m256i *)p);
+#else
+    return _mm_loadu_si128((const __m128i *)p);
+#endif
+}
+
+static inline void lv_x86_store(void * p, lv_blend_x86_vec_t v)
+{
+#ifdef __AVX2__
+    _mm256_storeu_si256((__m256i *)p, v);
+#else
+    _mm_storeu_si128((__m128i *)p, v);
+#endif
+}
+
+/**
+ * Load `LV_BLEND_X86_PX` 16 bit values and zero extend them to 32 bit lanes
+ * @param p     pointer to the values
+ * @return      the widened values
+ */
+static inline lv_blend_x86_vec_t lv_x86_load_u16(const uint16_t * p)
+{
+#ifdef __AVX2__
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p));
+#else
+    return _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)p), _mm_setzero_si128());
+#endif
+}
+
+/**
+ * Store the lower 16 bit of each 32 bit lane
+ * @param p     destination of `LV_BLEND_X86_PX` 16 bit values
+ * @param v     the values to store
+ */
+static inline void lv_x86_store_u16(uint16_t * p, lv_blend_x86_vec_t v)
+{
+#ifdef __AVX2__
+    /*Sign extend the lower half so that the saturating pack keeps it as it is*/
+    v = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+    v = _mm256_packs_epi32(v, v);
+    v = _mm256_permute4x64_epi64(v, 0x08);
+    _mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+#else
+    v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+    _mm_storel_epi64((__m128i *)p, _mm_packs_epi32(v, v));
+#endif
+}
+
+/**
+ * Load `LV_BLEND_X86_PX` opacity values and zero extend them to 32 bit lanes
+ * @param p     pointer to the opacity values, e.g. a mask
+ * @return      the widened values
+ */
+static inline lv_blend_x86_vec_t lv_x86_load_u8(const lv_opa_t * p)
+{
+#ifdef __AVX2__
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)p));
+#else
+    int32_t v;
+    lv_memcpy(&v, p, sizeof(v));
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+#endif
+}
+
+/**
+ * Multiply 32 bit lanes keeping the lower 32 bit of the result
+ */
+static inline lv_blend_x86_vec_t lv_x86_mullo32(lv_blend_x86_vec_t a, lv_blend_x86_vec_t b)
+{
+#ifdef __AVX2__
+    return _mm256_mullo_epi32(a, b);
+#else
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+/**
+ * Pick `a` where `sel` is all ones and `b` where it's zero
+ */
+static inline lv_blend_x86_vec_t lv_x86_select(lv_blend_x86_vec_t sel, lv_blend_x86_vec_t a, lv_blend_x86_vec_t b)
+{
+    return lv_x86_or(lv_x86_and(sel, a), lv_x86_andnot(sel, b));
+}
+
+/**
+ * Same as `LV_OPA_MIX2` on each 32 bit lane. The inputs must be in the 0..255 range.
+ */
+static inline lv_blend_x86_vec_t lv_x86_opa_mix2(lv_blend_x86_vec_t a1, lv_blend_x86_vec_t a2)
+{
+    return lv_x86_srli32(lv_x86_mullo16(a1, a2), 8);
+}
+
+/**
+ * Same as `LV_OPA_MIX3` on each 32 bit lane. The inputs must be in the 0..255 range.
+ */
+static inline lv_blend_x86_vec_t lv_x86_opa_mix3(lv_blend_x86_vec_t a1, lv_blend_x86_vec_t a2,
+                                                 lv_blend_x86_vec_t a3)
+{
+    /*a1 * a2 fits into 16 bit so the high half of the 16 bit product is the `>> 16` part*/
+    return lv_x86_mulhi16(lv_x86_mullo16(a1, a2), a3);
+}
+
+/**
+ * Get the per pixel mix ratio of the source, the opacity and the mask
+ * @param alpha     alpha of the source pixels or NULL if the source has no alpha channel
+ * @param mask      pointer to the mask values or NULL if there is no mask
+ * @param opa       overall opacity. Ignored if >= LV_OPA_MAX
+ * @return          the mix ratios in 32 bit lanes
+ */
+static inline lv_blend_x86_vec_t lv_x86_get_mix(const lv_blend_x86_vec_t * alpha, const lv_opa_t * mask,
+                                                lv_opa_t opa)
+{
+    lv_blend_x86_vec_t opa_v = lv_x86_set1_32(opa);
+    if(alpha) {
+        if(mask && opa < LV_OPA_MAX) return lv_x86_opa_mix3(*alpha, lv_x86_load_u8(mask), opa_v);
+        if(mask) return lv_x86_opa_mix2(*alpha, lv_x86_load_u8(mask));
+        if(opa < LV_OPA_MAX) return lv_x86_opa_mix2(*alpha, opa_v);
+        return *alpha;
+    }
+    else {
+        if(mask && opa < LV_OPA_MAX) return lv_x86_opa_mix2(lv_x86_load_u8(mask), opa_v);
+        if(mask) return lv_x86_load_u8(mask);
+        return opa_v;
+    }
+}
+
+/**
+ * Mix the 4 channels of two pixels in each 32 bit lane as `(fg * mix + bg * (255 - mix)) >> 8`
+ * @param fg        the foreground pixels
+ * @param bg        the background pixels
+ * @param mix       the mix ratio in 32 bit lanes (0..255)
+ * @param udiv255   true: divide by 255 like `LV_UDIV255` instead of `>> 8`
+ * @return          the mixed pixels
+ */
+static inline lv_blend_x86_vec_t lv_x86_mix_8888(lv_blend_x86_vec_t fg, lv_blend_x86_vec_t bg, lv_blend_x86_vec_t mix,
+                                                 bool udiv255)
+{
+    lv_blend_x86_vec_t zero = lv_x86_zero();
+    lv_blend_x86_vec_t c255 = lv_x86_set1_16(255);
+
+    /*Repeat the mix ratio for all 4 channels of a pixel*/
+    lv_blend_x86_vec_t mix16 = lv_x86_or(mix, lv_x86_slli32(mix, 16));
+    lv_blend_x86_vec_t mix_lo = lv_x86_unpacklo32(mix16, mix16);
+    lv_blend_x86_vec_t mix_hi = lv_x86_unpackhi32(mix16, mix16);
+
+    lv_blend_x86_vec_t lo = lv_x86_add16(lv_x86_mullo16(lv_x86_unpacklo8(fg, zero), mix_lo),
+                                         lv_x86_mullo16(lv_x86_unpacklo8(bg, zero), lv_x86_sub16(c255, mix_lo)));
+    lv_blend_x86_vec_t hi = lv_x86_add16(lv_x86_mullo16(lv_x86_unpackhi8(fg, zero), mix_hi),
+                                         lv_x86_mullo16(lv_x86_unpackhi8(bg, zero), lv_x86_sub16(c255, mix_hi)));
+
+    if(udiv255) {
+        /*(x * 0x8081) >> 23*/
+        lv_blend_x86_vec_t magic = lv_x86_set1_16(0x8081);
+        lo = lv_x86_srli16(lv_x86_mulhi16(lo, magic), 7);
+        hi = lv_x86_srli16(lv_x86_mulhi16(hi, magic), 7);
+    }
+    else {
+        lo = lv_x86_srli16(lo, 8);
+        hi = lv_x86_srli16(hi, 8);
+    }
+
+    return lv_x86_packus16(lo, hi);
+}
+
+/**
+ * The same as `lv_color_16_16_mix()` on RGB565 colors in 32 bit lanes
+ * @param fg        the foreground colors
+ * @param bg        the background colors
+ * @param mix       the mix ratio in 32 bit lanes (0..255)
+ * @return          the mixed colors in the lower 16 bit of the lanes
+ */
+static inline lv_blend_x86_vec_t lv_x86_mix_565(lv_blend_x86_vec_t fg, lv_blend_x86_vec_t bg, lv_blend_x86_vec_t mix)
+{
+    lv_blend_x86_vec_t rb_g = lv_x86_set1_32(0x7E0F81F);
+    fg = lv_x86_and(lv_x86_or(fg, lv_x86_slli32(fg, 16)), rb_g);
+    bg = lv_x86_and(lv_x86_or(bg, lv_x86_slli32(bg, 16)), rb_g);
+    mix = lv_x86_srli32(lv_x86_add32(mix, lv_x86_set1_32(4)), 3);
+
+    lv_blend_x86_vec_t res = lv_x86_mullo32(lv_x86_sub32(fg, bg), mix);
+    res = lv_x86_and(lv_x86_add32(lv_x86_srli32(res, 5), bg), rb_g);
+    return lv_x86_or(res, lv_x86_srli32(res, 16));
+}
+
+/**
+ * The same as `lv_color_24_16_mix()` of the SW renderer: mix 32 bit source pixels to RGB565 pixels
+ * @param fg        the foreground pixels in XRGB8888 format
+ * @param bg        the background RGB565 colors in 32 bit lanes
+ * @param mix       the mix ratio in 32 bit lanes (0..255)
+ * @return          the mixed colors in the lower 16 bit of the lanes
+ */
+static inline lv_blend_x86_vec_t lv_x86_mix_8888_565(lv_blend_x86_vec_t fg, lv_blend_x86_vec_t bg,
+                                                     lv_blend_x86_vec_t mix)
+{
+    lv_blend_x86_vec_t m5 = lv_x86_set1_32(0x1F);
+    lv_blend_x86_vec_t m6 = lv_x86_set1_32(0x3F);
+    lv_blend_x86_vec_t mix_inv = lv_x86_sub32(lv_x86_set1_32(255), mix);
+
+    lv_blend_x86_vec_t fr = lv_x86_and(lv_x86_srli32(fg, 19), m5);
+    lv_blend_x86_vec_t fgr = lv_x86_and(lv_x86_srli32(fg, 10), m6);
+    lv_blend_x86_vec_t fb = lv_x86_and(lv_x86_srli32(fg, 3), m5);
+    lv_blend_x86_vec_t fg565 = lv_x86_or(lv_x86_or(lv_x86_slli32(fr, 11), lv_x86_slli32(fgr, 5)), fb);
+
+    lv_blend_x86_vec_t br = lv_x86_and(lv_x86_srli32(bg, 11), m5);
+    lv_blend_x86_vec_t bgr = lv_x86_and(lv_x86_srli32(bg, 5), m6);
+    lv_blend_x86_vec_t bb = lv_x86_and(bg, m5);
+
+    /*The products fit into the lower 16 bit of the lanes*/
+    lv_blend_x86_vec_t r = lv_x86_srli32(lv_x86_add32(lv_x86_mullo16(fr, mix), lv_x86_mullo16(br, mix_inv)), 8);
+    lv_blend_x86_vec_t g = lv_x86_srli32(lv_x86_add32(lv_x86_mullo16(fgr, mix), lv_x86_mullo16(bgr, mix_inv)), 8);
+    lv_blend_x86_vec_t b = lv_x86_srli32(lv_x86_add32(lv_x86_mullo16(fb, mix), lv_x86_mullo16(bb, mix_inv)), 8);
+    lv_blend_x86_vec_t res = lv_x86_or(lv_x86_or(lv_x86_slli32(r, 11), lv_x86_slli32(g, 5)), b);
+
+    res = lv_x86_select(lv_x86_cmpeq32(mix, lv_x86_set1_32(255)), fg565, res);
+    return lv_x86_select(lv_x86_cmpeq32(mix, lv_x86_zero()), bg, res);
+}
+
+/**
+ * The same as `lv_color_24_24_mix()` of the SW renderer on XRGB8888 pixels.
+ * The alpha byte of the background is kept.
+ * @param fg        the foreground pixels
+ * @param bg        the background pixels
+ * @param mix       the mix ratio in 32 bit lanes (0..255)
+ * @return          the mixed pixels
+ */
+static inline lv_blend_x86_vec_t lv_x86_mix_8888_888(lv_blend_x86_vec_t fg, lv_blend_x86_vec_t bg,
+                                                     lv_blend_x86_vec_t mix)
+{
+    lv_blend_x86_vec_t rgb_mask = lv_x86_set1_32(0x00FFFFFF);
+    lv_blend_x86_vec_t res = lv_x86_mix_8888(fg, bg, mix, false);
+    res = lv_x86_select(lv_x86_cmpgt32(mix, lv_x86_set1_32(LV_OPA_MAX - 1)), fg, res);
+    res = lv_x86_select(rgb_mask, res, bg);
+    return lv_x86_select(lv_x86_cmpeq32(mix, lv_x86_zero()), bg, res);
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_PRIVATE_H*/
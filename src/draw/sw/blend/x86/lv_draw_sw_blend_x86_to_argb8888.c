@@ -0,0 +1,269 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_argb8888.c
+ * ARGB8888 blend implementation with SSE2 or AVX2
+ *
+ * The results are bit exact with the generic implementation in `lv_draw_sw_blend_to_argb8888.c`.
+ * Only the fully opaque destination pixels are mixed with vector instructions,
+ * the others need a division and are mixed pixel by pixel.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_argb8888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2
+
+#include "../lv_draw_sw_blend_private.h"
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void color_mix(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void argb8888_mix(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM color_32_32_mix(lv_color32_t fg, lv_color32_t bg);
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_blend_x86_vec_t color_v = lv_x86_set1_32(color32);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            lv_x86_store(&dest_buf_u32[x], color_v);
+        }
+        for(; x < w; x++) {
+            dest_buf_u32[x] = color32;
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Mix `LV_BLEND_X86_PX` pixels to ARGB8888 pixels like `lv_color_32_32_mix()` does
+ * @param dest      pointer to the destination pixels
+ * @param fg        the foreground pixels. Their alpha channel is ignored.
+ * @param mix       the alpha of the foreground pixels in 32 bit lanes
+ */
+static inline void mix_px(uint32_t * dest, lv_blend_x86_vec_t fg, lv_blend_x86_vec_t mix)
+{
+    lv_blend_x86_vec_t bg = lv_x86_load(dest);
+    lv_blend_x86_vec_t alpha_mask = lv_x86_set1_32(0xFF000000);
+    lv_blend_x86_vec_t bg_opaque = lv_x86_cmpeq32(lv_x86_and(bg, alpha_mask), alpha_mask);
+
+    if(lv_x86_movemask8(bg_opaque) == LV_X86_MOVEMASK_ALL) {
+        /*The same as `lv_color_mix32()` as the background is opaque*/
+        lv_blend_x86_vec_t fg_full = lv_x86_or(lv_x86_andnot(alpha_mask, fg), lv_x86_slli32(mix, 24));
+        lv_blend_x86_vec_t res = lv_x86_or(lv_x86_mix_8888(fg, bg, mix, true), alpha_mask);
+        res = lv_x86_select(lv_x86_cmpgt32(mix, lv_x86_set1_32(LV_OPA_MAX - 1)), fg_full, res);
+        res = lv_x86_select(lv_x86_cmpgt32(lv_x86_set1_32(LV_OPA_MIN + 1), mix), bg, res);
+        lv_x86_store(dest, res);
+    }
+    else {
+        uint32_t fg_u32[LV_BLEND_X86_PX];
+        uint32_t mix_u32[LV_BLEND_X86_PX];
+        lv_x86_store(fg_u32, fg);
+        lv_x86_store(mix_u32, mix);
+
+        lv_color32_t * dest_c32 = (lv_color32_t *)dest;
+        uint32_t i;
+        for(i = 0; i < LV_BLEND_X86_PX; i++) {
+            lv_color32_t fg_c32;
+            lv_memcpy(&fg_c32, &fg_u32[i], sizeof(fg_c32));
+            fg_c32.alpha = (lv_opa_t)mix_u32[i];
+            dest_c32[i] = color_32_32_mix(fg_c32, dest_c32[i]);
+        }
+    }
+}
+
+static void color_mix(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_blend_x86_vec_t color_v = lv_x86_set1_32(lv_color_to_u32(dsc->color));
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            mix_px(&dest_buf_u32[x], color_v, lv_x86_get_mix(NULL, mask ? &mask[x] : NULL, opa));
+        }
+
+        /*Process the remaining pixels in a temporary buffer to not read out of bounds*/
+        if(x < w) {
+            uint32_t dest_tmp[LV_BLEND_X86_PX] = {0};
+            lv_opa_t mask_tmp[LV_BLEND_X86_PX] = {0};
+            int32_t rest = w - x;
+            lv_memcpy(dest_tmp, &dest_buf_u32[x], rest * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], rest);
+            mix_px(dest_tmp, color_v, lv_x86_get_mix(NULL, mask ? mask_tmp : NULL, opa));
+            lv_memcpy(&dest_buf_u32[x], dest_tmp, rest * sizeof(uint32_t));
+        }
+
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dest_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+/**
+ * Mix `LV_BLEND_X86_PX` ARGB8888 source pixels to ARGB8888 pixels
+ * @param dest      pointer to the destination pixels
+ * @param src       pointer to the source pixels
+ * @param mask      pointer to the mask values or NULL
+ * @param opa       the overall opacity
+ */
+static inline void argb8888_mix_px(uint32_t * dest, const uint32_t * src, const lv_opa_t * mask, lv_opa_t opa)
+{
+    lv_blend_x86_vec_t src_v = lv_x86_load(src);
+    lv_blend_x86_vec_t alpha = lv_x86_srli32(src_v, 24);
+    mix_px(dest, src_v, lv_x86_get_mix(&alpha, mask, opa));
+}
+
+static void argb8888_mix(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            argb8888_mix_px(&dest_buf_u32[x], &src_buf_u32[x], mask ? &mask[x] : NULL, opa);
+        }
+
+        if(x < w) {
+            uint32_t dest_tmp[LV_BLEND_X86_PX] = {0};
+            uint32_t src_tmp[LV_BLEND_X86_PX] = {0};
+            lv_opa_t mask_tmp[LV_BLEND_X86_PX] = {0};
+            int32_t rest = w - x;
+            lv_memcpy(dest_tmp, &dest_buf_u32[x], rest * sizeof(uint32_t));
+            lv_memcpy(src_tmp, &src_buf_u32[x], rest * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], rest);
+            argb8888_mix_px(dest_tmp, src_tmp, mask ? mask_tmp : NULL, opa);
+            lv_memcpy(&dest_buf_u32[x], dest_tmp, rest * sizeof(uint32_t));
+        }
+
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, src_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+/**
+ * The same as `lv_color_32_32_mix()` of the SW renderer without the cache
+ */
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 */
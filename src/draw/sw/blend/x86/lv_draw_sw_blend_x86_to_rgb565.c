@@ -0,0 +1,290 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_rgb565.c
+ * RGB565 blend implementation with SSE2 or AVX2
+ *
+ * The results are bit exact with the generic implementation in `lv_draw_sw_blend_to_rgb565.c`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2
+
+#include "../lv_draw_sw_blend_private.h"
+#include "lv_blend_x86_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void color_mix(lv_draw_sw_blend_fill_dsc_t * dsc);
+static void rgb565_mix(lv_draw_sw_blend_image_dsc_t * dsc);
+static void argb8888_mix(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_blend_x86_vec_t color_v = lv_x86_set1_16(color16);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        /*One vector holds twice as many 16 bit pixels as 32 bit lanes*/
+        for(x = 0; x <= w - 2 * LV_BLEND_X86_PX; x += 2 * LV_BLEND_X86_PX) {
+            lv_x86_store(&dest_buf_u16[x], color_v);
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = color16;
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_mix(dsc);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Mix `LV_BLEND_X86_PX` pixels of a color to RGB565 pixels
+ * @param dest      pointer to the destination pixels
+ * @param color     the color in 32 bit lanes
+ * @param mask      pointer to the mask values or NULL
+ * @param opa       the overall opacity
+ */
+static inline void color_mix_px(uint16_t * dest, lv_blend_x86_vec_t color, const lv_opa_t * mask, lv_opa_t opa)
+{
+    lv_blend_x86_vec_t mix = lv_x86_get_mix(NULL, mask, opa);
+    lv_x86_store_u16(dest, lv_x86_mix_565(color, lv_x86_load_u16(dest), mix));
+}
+
+/**
+ * Mix `LV_BLEND_X86_PX` RGB565 source pixels to RGB565 pixels
+ * @param dest      pointer to the destination pixels
+ * @param src       pointer to the source pixels
+ * @param mask      pointer to the mask values or NULL
+ * @param opa       the overall opacity
+ */
+static inline void rgb565_mix_px(uint16_t * dest, const uint16_t * src, const lv_opa_t * mask, lv_opa_t opa)
+{
+    lv_blend_x86_vec_t mix = lv_x86_get_mix(NULL, mask, opa);
+    lv_x86_store_u16(dest, lv_x86_mix_565(lv_x86_load_u16(src), lv_x86_load_u16(dest), mix));
+}
+
+/**
+ * Mix `LV_BLEND_X86_PX` ARGB8888 source pixels to RGB565 pixels
+ * @param dest      pointer to the destination pixels
+ * @param src       pointer to the source pixels
+ * @param mask      pointer to the mask values or NULL
+ * @param opa       the overall opacity
+ */
+static inline void argb8888_mix_px(uint16_t * dest, const uint32_t * src, const lv_opa_t * mask, lv_opa_t opa)
+{
+    lv_blend_x86_vec_t src_v = lv_x86_load(src);
+    lv_blend_x86_vec_t alpha = lv_x86_srli32(src_v, 24);
+    lv_blend_x86_vec_t mix = lv_x86_get_mix(&alpha, mask, opa);
+    lv_x86_store_u16(dest, lv_x86_mix_8888_565(src_v, lv_x86_load_u16(dest), mix));
+}
+
+static void color_mix(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_blend_x86_vec_t color_v = lv_x86_set1_32(lv_color_to_u16(dsc->color));
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            color_mix_px(&dest_buf_u16[x], color_v, mask ? &mask[x] : NULL, opa);
+        }
+
+        /*Process the remaining pixels in a temporary buffer to not read out of bounds*/
+        if(x < w) {
+            uint16_t dest_tmp[LV_BLEND_X86_PX] = {0};
+            lv_opa_t mask_tmp[LV_BLEND_X86_PX] = {0};
+            int32_t rest = w - x;
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], rest * sizeof(uint16_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], rest);
+            color_mix_px(dest_tmp, color_v, mask ? mask_tmp : NULL, opa);
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, rest * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+static void rgb565_mix(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            rgb565_mix_px(&dest_buf_u16[x], &src_buf_u16[x], mask ? &mask[x] : NULL, opa);
+        }
+
+        if(x < w) {
+            uint16_t dest_tmp[LV_BLEND_X86_PX] = {0};
+            uint16_t src_tmp[LV_BLEND_X86_PX] = {0};
+            lv_opa_t mask_tmp[LV_BLEND_X86_PX] = {0};
+            int32_t rest = w - x;
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], rest * sizeof(uint16_t));
+            lv_memcpy(src_tmp, &src_buf_u16[x], rest * sizeof(uint16_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], rest);
+            rgb565_mix_px(dest_tmp, src_tmp, mask ? mask_tmp : NULL, opa);
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, rest * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+static void argb8888_mix(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - LV_BLEND_X86_PX; x += LV_BLEND_X86_PX) {
+            argb8888_mix_px(&dest_buf_u16[x], &src_buf_u32[x], mask ? &mask[x] : NULL, opa);
+        }
+
+        if(x < w) {
+            uint16_t dest_tmp[LV_BLEND_X86_PX] = {0};
+            uint32_t src_tmp[LV_BLEND_X86_PX] = {0};
+            lv_opa_t mask_tmp[LV_BLEND_X86_PX] = {0};
+            int32_t rest = w - x;
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], rest * sizeof(uint16_t));
+            lv_memcpy(src_tmp, &src_buf_u32[x], rest * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], rest);
+            argb8888_mix_px(dest_tmp, src_tmp, mask ? mask_tmp : NULL, opa);
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, rest * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, src_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 */
@@ -13,6 +13,8 @@
 #include "../../display/lv_display_private.h"
 #include "../../core/lv_global.h"
 #include "../../misc/lv_area_private.h"
+#include "../../misc/cache/instance/lv_image_cache.h"
+#include "../lv_draw_image_private.h"
 
 #if LV_USE_THORVG
     #if LV_USE_THORVG_INTERNAL
@@ -37,6 +39,12 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*Split a draw task among the idle threads if it draws at least this many pixels*/
+#define BAND_MIN_TASK_SIZE  (128 * 128)
+
+/*Don't make the bands lower than this*/
+#define BAND_MIN_HEIGHT     16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +54,9 @@
  **********************/
 #if LV_USE_OS
     static void render_thread_cb(void * ptr);
+    static uint32_t split_into_bands(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * t, uint32_t first_idx);
+    static bool image_is_decoded(const lv_draw_task_t * t);
+    static bool finish_band(lv_draw_sw_thread_dsc_t * thread_dsc);
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
@@ -75,6 +86,7 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_shadow_cache_init();
 #endif
 
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -87,7 +99,13 @@ void lv_draw_sw_init(void)
     draw_sw_unit->base_unit.name = "SW";
 #endif
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG && LV_USE_OS
+    lv_mutex_init(&draw_sw_unit->vector_mutex);
+#endif
+
 #if LV_USE_OS
+    lv_mutex_init(&draw_sw_unit->band_mutex);
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
@@ -113,11 +131,24 @@ void lv_draw_sw_init(void)
 void lv_draw_sw_deinit(void)
 {
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    /*The canvases need the engine so free them first*/
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) {
+        if(u->dispatch_cb != dispatch) continue;
+
+        lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) u;
+        uint32_t i;
+        for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+            lv_draw_sw_vector_ctx_deinit(&draw_sw_unit->vector_ctxs[i]);
+        }
+    }
+
     tvg_engine_term(TVG_ENGINE_SW);
 #endif
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+    lv_draw_sw_shadow_cache_deinit();
 #endif
 }
 
@@ -139,6 +170,11 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_delete(&thread_dsc->thread);
     }
 
+    lv_mutex_delete(&draw_sw_unit->band_mutex);
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_mutex_delete(&draw_sw_unit->vector_mutex);
+#endif
+
     return 0;
 #else
     LV_UNUSED(draw_unit);
@@ -199,6 +235,47 @@ lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_c
     return NULL;
 }
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+lv_draw_sw_vector_ctx_t * lv_draw_sw_vector_ctx_get(lv_draw_unit_t * draw_unit)
+{
+    /*Other draw units can call the SW render functions too*/
+    if(draw_unit == NULL || draw_unit->dispatch_cb != dispatch) return NULL;
+
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    lv_draw_sw_vector_ctx_t * ctx = NULL;
+
+#if LV_USE_OS
+    lv_mutex_lock(&draw_sw_unit->vector_mutex);
+#endif
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        if(!draw_sw_unit->vector_ctxs[i].busy) {
+            ctx = &draw_sw_unit->vector_ctxs[i];
+            ctx->busy = true;
+            break;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&draw_sw_unit->vector_mutex);
+#endif
+
+    return ctx;
+}
+
+void lv_draw_sw_vector_ctx_release(lv_draw_unit_t * draw_unit, lv_draw_sw_vector_ctx_t * ctx)
+{
+#if LV_USE_OS
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    lv_mutex_lock(&draw_sw_unit->vector_mutex);
+    ctx->busy = false;
+    lv_mutex_unlock(&draw_sw_unit->vector_mutex);
+#else
+    LV_UNUSED(draw_unit);
+    ctx->busy = false;
+#endif
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -294,6 +371,10 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         all_idle = false;
         taken_cnt++;
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+        /*Let the idle threads render a large task together*/
+        if(split_into_bands(draw_sw_unit, t, i) > 0) continue;
+
         thread_dsc->task_act = t;
 
         /*Let the render thread work*/
@@ -361,10 +442,24 @@ static void render_thread_cb(void * ptr)
             break;
         }
 
-        execute_drawing(thread_dsc->task_act);
+        if(thread_dsc->band_leader == NULL) {
+            execute_drawing(thread_dsc->task_act);
 #if LV_USE_PARALLEL_DRAW_DEBUG
-        parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
+            parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
 #endif
+        }
+        else {
+            /*Render only the band of this thread by limiting the clip area*/
+            lv_draw_task_t band_task = *thread_dsc->task_act;
+            band_task.clip_area = thread_dsc->band_area;
+            execute_drawing(&band_task);
+#if LV_USE_PARALLEL_DRAW_DEBUG
+            parallel_debug_draw(&band_task, thread_dsc->idx);
+#endif
+            /*Only the band leader finishes the task*/
+            if(!finish_band(thread_dsc)) continue;
+        }
+
         thread_dsc->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
         thread_dsc->task_act = NULL;
 
@@ -377,6 +472,136 @@ static void render_thread_cb(void * ptr)
     lv_thread_sync_delete(&thread_dsc->sync);
     LV_LOG_INFO("exit software rendering thread");
 }
+
+/**
+ * Split a large draw task into horizontal bands and assign them to the idle threads.
+ * Only the tasks which write each pixel independently of the others are split.
+ * @param draw_sw_unit  pointer to the SW draw unit
+ * @param t             the draw task to split
+ * @param first_idx     index of the first idle thread. It will be the band leader.
+ * @return              number of bands, or 0 if the task was not split
+ */
+static uint32_t split_into_bands(lv_draw_sw_unit_t * draw_sw_unit, lv_draw_task_t * t, uint32_t first_idx)
+{
+    if(LV_DRAW_SW_DRAW_UNIT_CNT < 2) return 0;
+
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            break;
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_LAYER: {
+                /*The bitmap mask is applied on the whole layer in place*/
+                lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+                if(draw_dsc->bitmap_mask_src) return 0;
+
+                /*Each band opens the image, so don't decode it once per band*/
+                if(t->type == LV_DRAW_TASK_TYPE_IMAGE && !image_is_decoded(t)) return 0;
+            }
+            break;
+        default:
+            /*E.g. blur reads the neighboring pixels, box shadow and vector
+             *graphics do most of the work once for the whole task*/
+            return 0;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return 0;
+    if(lv_area_get_size(&draw_area) < BAND_MIN_TASK_SIZE) return 0;
+
+    uint32_t idle_cnt = 0;
+    uint32_t i;
+    for(i = first_idx; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        if(draw_sw_unit->thread_dscs[i].task_act == NULL) idle_cnt++;
+    }
+
+    int32_t h = lv_area_get_height(&draw_area);
+    uint32_t band_cnt = LV_MIN(idle_cnt, (uint32_t)(h / BAND_MIN_HEIGHT));
+    if(band_cnt < 2) return 0;
+
+    lv_draw_sw_thread_dsc_t * leader = &draw_sw_unit->thread_dscs[first_idx];
+    leader->band_remaining = band_cnt;
+
+    uint32_t band_idx = 0;
+    for(i = first_idx; band_idx < band_cnt; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->task_act) continue;
+
+        thread_dsc->band_area = t->clip_area;
+        thread_dsc->band_area.y1 = draw_area.y1 + (int32_t)((h * band_idx) / band_cnt);
+        thread_dsc->band_area.y2 = draw_area.y1 + (int32_t)((h * (band_idx + 1)) / band_cnt) - 1;
+        thread_dsc->band_leader = leader;
+        thread_dsc->task_act = t;
+        band_idx++;
+    }
+
+    for(i = first_idx; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        if(thread_dsc->task_act == t && thread_dsc->inited) lv_thread_sync_signal(&thread_dsc->sync);
+    }
+
+    return band_cnt;
+}
+
+/**
+ * Check if the image of a draw task can be opened without decoding it,
+ * i.e. it's a plain variable image used directly or it's in the image cache.
+ * @param t     an image draw task
+ * @return      true: opening the image is cheap
+ */
+static bool image_is_decoded(const lv_draw_task_t * t)
+{
+    const lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+    if(lv_image_src_get_type(draw_dsc->src) == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_header_t * header = &((const lv_image_dsc_t *)draw_dsc->src)->header;
+        lv_color_format_t cf = header->cf;
+        if(!(header->flags & LV_IMAGE_FLAGS_COMPRESSED) &&
+           cf != LV_COLOR_FORMAT_RAW && cf != LV_COLOR_FORMAT_RAW_ALPHA &&
+           !LV_COLOR_FORMAT_IS_INDEXED(cf) &&
+           (!LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf) || cf == LV_COLOR_FORMAT_A8)) {
+            return true;
+        }
+    }
+
+    return lv_image_cache_contains(draw_dsc->src, lv_draw_image_get_downscale(draw_dsc, &t->area));
+}
+
+/**
+ * Mark the band of a thread as rendered. The other threads are released immediately
+ * while the band leader waits until all the bands are rendered.
+ * @param thread_dsc    pointer to the thread which has rendered its band
+ * @return              true: it's the band leader and the whole task is rendered;
+ *                      false: not the band leader, the thread is released
+ */
+static bool finish_band(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *)thread_dsc->draw_unit;
+    lv_draw_sw_thread_dsc_t * leader = thread_dsc->band_leader;
+
+    lv_mutex_lock(&draw_sw_unit->band_mutex);
+    leader->band_remaining--;
+    uint32_t remaining = leader->band_remaining;
+    lv_mutex_unlock(&draw_sw_unit->band_mutex);
+
+    if(thread_dsc != leader) {
+        thread_dsc->band_leader = NULL;
+        thread_dsc->task_act = NULL;
+        if(remaining == 0) lv_thread_sync_signal(&leader->sync);
+
+        /*The thread is free now. Request a new dispatching as it can get a new task*/
+        lv_draw_dispatch_request();
+        return false;
+    }
+
+    while(remaining > 0) {
+        lv_thread_sync_wait(&thread_dsc->sync);
+        lv_mutex_lock(&draw_sw_unit->band_mutex);
+        remaining = leader->band_remaining;
+        lv_mutex_unlock(&draw_sw_unit->band_mutex);
+    }
+
+    thread_dsc->band_leader = NULL;
+    return true;
+}
 #endif
 
 static void execute_drawing(lv_draw_task_t * t)
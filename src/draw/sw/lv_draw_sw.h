@@ -23,6 +23,16 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Counters of the cache of the blurred shadow corners*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of shadows whose corner was found in the cache*/
+    uint32_t miss_cnt;      /**< Number of shadows whose corner was calculated and added to the cache*/
+} lv_draw_sw_shadow_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -179,6 +189,19 @@ bool lv_draw_sw_unregister_blend_handler(lv_color_format_t dest_cf);
  */
 lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_cf);
 
+/**
+ * Get the hits and misses of the shadow cache since `lv_init()` or the last
+ * `lv_draw_sw_shadow_cache_reset_stats()`. Only the shadows whose corner
+ * (`shadow_width + radius`) fits into `LV_DRAW_SW_SHADOW_CACHE_SIZE` are counted.
+ * @param stats     store the counters here. All 0 if `LV_DRAW_SW_SHADOW_CACHE_SIZE` is 0.
+ */
+void lv_draw_sw_shadow_cache_get_stats(lv_draw_sw_shadow_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the shadow cache
+ */
+void lv_draw_sw_shadow_cache_reset_stats(void);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
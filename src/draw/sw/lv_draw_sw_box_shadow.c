@@ -15,7 +15,11 @@
 #if LV_DRAW_SW_COMPLEX
 
 #include "blend/lv_draw_sw_blend_private.h"
+#include "lv_draw_sw_private.h"
 #include "../../core/lv_global.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_entry.h"
+#include "../../misc/cache/class/lv_cache_lru_rb.h"
 
 /*********************
  *      DEFINES
@@ -31,13 +35,31 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+typedef struct {
+    int32_t sw;                 /**< Width of the shadow*/
+    int32_t r;                  /**< Radius of the blurred area*/
+    int32_t w;                  /**< Width of the blurred area, limited to the part which affects the corner*/
+    int32_t h;                  /**< Height of the blurred area, limited to the part which affects the corner*/
+    lv_opa_t * buf;             /**< `(sw + r)^2` opacity values of the corner*/
+} shadow_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_opa_t * get_corner_buf(const lv_area_t * core_area, int32_t sw, int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static void shadow_cache_count(bool hit);
+    static bool shadow_cache_create_cb(shadow_cache_data_t * node, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * node, void * user_data);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs, const shadow_cache_data_t * rhs);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -92,34 +114,8 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
-
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        LV_ASSERT_MALLOC(sh_buf);
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
-    }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+    lv_opa_t * sh_buf = get_corner_buf(&core_area, dsc->width, r_sh);
+    if(sh_buf == NULL) return;
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -554,10 +550,125 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     lv_free(mask_buf);
 }
 
+void lv_draw_sw_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    shadow_cache.cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(shadow_cache_data_t),
+                                         LV_DRAW_SW_SHADOW_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)shadow_cache_free_cb,
+    });
+    if(shadow_cache.cache) lv_cache_set_name(shadow_cache.cache, "DRAW_SW_SHADOW");
+
+    lv_memzero(&shadow_cache.stats, sizeof(shadow_cache.stats));
+#if LV_USE_OS
+    lv_mutex_init(&shadow_cache.stats_mutex);
+#endif
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache) {
+        lv_cache_destroy(shadow_cache.cache, NULL);
+        shadow_cache.cache = NULL;
+    }
+#if LV_USE_OS
+    lv_mutex_delete(&shadow_cache.stats_mutex);
+#endif
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+}
+
+void lv_draw_sw_shadow_cache_get_stats(lv_draw_sw_shadow_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+#if LV_USE_OS
+    lv_mutex_lock(&shadow_cache.stats_mutex);
+#endif
+    *stats = shadow_cache.stats;
+#if LV_USE_OS
+    lv_mutex_unlock(&shadow_cache.stats_mutex);
+#endif
+#else
+    lv_memzero(stats, sizeof(lv_draw_sw_shadow_cache_stats_t));
+#endif
+}
+
+void lv_draw_sw_shadow_cache_reset_stats(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+#if LV_USE_OS
+    lv_mutex_lock(&shadow_cache.stats_mutex);
+#endif
+    lv_memzero(&shadow_cache.stats, sizeof(shadow_cache.stats));
+#if LV_USE_OS
+    lv_mutex_unlock(&shadow_cache.stats_mutex);
+#endif
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the blurred corner of a shadow from the cache,
+ * or calculate it and add it to the cache if it's not cached yet.
+ * @param core_area     the area to blur
+ * @param sw            the width of the shadow
+ * @param r             the radius of `core_area`
+ * @return              buffer with the `(sw + r)^2` opacity values of the corner, free it with `lv_free()`.
+ *                      It's large enough to calculate the corner in it.
+ */
+static lv_opa_t * get_corner_buf(const lv_area_t * core_area, int32_t sw, int32_t r)
+{
+    int32_t corner_size = sw + r;
+
+    /*A larger buffer is required for calculation*/
+    lv_opa_t * sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(sh_buf);
+    if(sh_buf == NULL) return NULL;
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache == NULL || corner_size > LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+        shadow_draw_corner_buf(core_area, (uint16_t *)sh_buf, sw, r);
+        return sh_buf;
+    }
+
+    /*The farther sides of a larger area don't affect the corner,
+     *so the same corner can be used for every such area*/
+    shadow_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.sw = sw;
+    search_key.r = r;
+    search_key.w = LV_MIN(lv_area_get_width(core_area), corner_size + r);
+    search_key.h = LV_MIN(lv_area_get_height(core_area), corner_size + r);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(shadow_cache.cache, &search_key, NULL);
+    shadow_cache_count(entry != NULL);
+    if(entry) {
+        shadow_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        lv_memcpy(sh_buf, cached_data->buf, corner_size * corner_size);
+        lv_cache_release(shadow_cache.cache, entry, NULL);
+        return sh_buf;
+    }
+
+    shadow_draw_corner_buf(core_area, (uint16_t *)sh_buf, sw, r);
+
+    /*Another thread might have added it since, then that entry is returned*/
+    entry = lv_cache_acquire_or_create(shadow_cache.cache, &search_key, sh_buf);
+    if(entry) lv_cache_release(shadow_cache.cache, entry, NULL);
+#else
+    shadow_draw_corner_buf(core_area, (uint16_t *)sh_buf, sw, r);
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
+    return sh_buf;
+}
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -725,6 +836,57 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     lv_free(sh_ups_blur_buf);
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+/**
+ * Count a hit or a miss of the shadow cache
+ * @param hit       true: the corner was found in the cache
+ */
+static void shadow_cache_count(bool hit)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&shadow_cache.stats_mutex);
+#endif
+    if(hit) shadow_cache.stats.hit_cnt++;
+    else shadow_cache.stats.miss_cnt++;
+#if LV_USE_OS
+    lv_mutex_unlock(&shadow_cache.stats_mutex);
+#endif
+}
+
+static bool shadow_cache_create_cb(shadow_cache_data_t * node, void * user_data)
+{
+    const lv_opa_t * sh_buf = user_data;
+    uint32_t size = (node->sw + node->r) * (node->sw + node->r);
+
+    node->buf = lv_malloc(size);
+    LV_ASSERT_MALLOC(node->buf);
+    if(node->buf == NULL) return false;
+
+    lv_memcpy(node->buf, sh_buf, size);
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(node->buf);
+    node->buf = NULL;
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs, const shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
@@ -736,6 +898,17 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     LV_LOG_WARN("LV_DRAW_SW_COMPLEX needs to be enabled");
 }
 
+void lv_draw_sw_shadow_cache_get_stats(lv_draw_sw_shadow_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    lv_memzero(stats, sizeof(lv_draw_sw_shadow_cache_stats_t));
+}
+
+void lv_draw_sw_shadow_cache_reset_stats(void)
+{
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
 
 #endif /*LV_DRAW_USE_SW*/
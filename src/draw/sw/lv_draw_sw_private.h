@@ -31,7 +31,7 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
-typedef struct {
+typedef struct _lv_draw_sw_thread_dsc_t {
     lv_draw_task_t * task_act;
     lv_thread_t thread;
     lv_thread_sync_t sync;
@@ -39,22 +39,58 @@ typedef struct {
     uint32_t idx;
     volatile bool inited;
     volatile bool exit_status;
+
+    /**
+     * If `task_act` is split into bands among several threads, the thread which renders the first band.
+     * It waits for the others and finishes the task. `NULL` if the whole task is rendered by this thread.
+     */
+    struct _lv_draw_sw_thread_dsc_t * band_leader;
+
+    /** The part of `task_act` to render by this thread if `band_leader` is set*/
+    lv_area_t band_area;
+
+    /** Number of bands of `task_act` not rendered yet. Used only on the band leader.*/
+    uint32_t band_remaining;
 } lv_draw_sw_thread_dsc_t;
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/** Resources of `lv_draw_sw_vector()` which are kept between the vector draw tasks*/
+typedef struct {
+    void * canvas;                  /**< The ThorVG SW canvas, created on the first use*/
+    lv_draw_buf_t * scratch_buf;    /**< ARGB8888 buffer to render into if the layer has an other color format*/
+    bool busy;                      /**< Used by a thread now*/
+} lv_draw_sw_vector_ctx_t;
+#endif
+
 struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+
+    /** Protects `band_remaining` of the threads*/
+    lv_mutex_t band_mutex;
 #else
     lv_draw_task_t * task_act;
 #endif
+
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    /** One for each thread as at most one vector task runs on a thread at a time*/
+    lv_draw_sw_vector_ctx_t vector_ctxs[LV_DRAW_SW_DRAW_UNIT_CNT];
+#if LV_USE_OS
+    /** Protects `busy` of `vector_ctxs`*/
+    lv_mutex_t vector_mutex;
+#endif
+#endif
 };
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
+/** The blurred shadow corners which are reused by the shadows of the same geometry*/
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_cache_t * cache;                     /**< LRU cache of `LV_DRAW_SW_SHADOW_CACHE_CNT` corners*/
+    lv_draw_sw_shadow_cache_stats_t stats;
+#if LV_USE_OS
+    lv_mutex_t stats_mutex;                 /**< The draw threads can draw shadows in parallel*/
+#endif
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -62,6 +98,40 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * Get an unused vector context of the SW draw unit and mark it as used
+ * @param draw_unit     the draw unit executing the task
+ * @return              the context or NULL if `draw_unit` is not a SW draw unit
+ */
+lv_draw_sw_vector_ctx_t * lv_draw_sw_vector_ctx_get(lv_draw_unit_t * draw_unit);
+
+/**
+ * Mark a vector context as unused
+ * @param draw_unit     the draw unit passed to `lv_draw_sw_vector_ctx_get()`
+ * @param ctx           the context returned by `lv_draw_sw_vector_ctx_get()`
+ */
+void lv_draw_sw_vector_ctx_release(lv_draw_unit_t * draw_unit, lv_draw_sw_vector_ctx_t * ctx);
+
+/**
+ * Free the canvas and the buffer of a vector context
+ * @param ctx           pointer to a vector context
+ */
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx);
+#endif
+
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Create the cache of the blurred shadow corners if `LV_DRAW_SW_SHADOW_CACHE_SIZE` is enabled
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -10,6 +10,8 @@
 #include "../lv_draw_vector_private.h"
 #include "../lv_draw_private.h"
 #include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
+#include "../../misc/lv_area_private.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 #if LV_USE_THORVG_INTERNAL
@@ -18,8 +20,6 @@
     #include <thorvg_capi.h>
 #endif
 #include "blend/lv_draw_sw_blend_private.h"
-#include "blend/lv_draw_sw_blend_to_rgb565.h"
-#include "blend/lv_draw_sw_blend_to_rgb888.h"
 
 /*********************
  *      DEFINES
@@ -44,7 +44,7 @@ typedef struct {
 
 typedef struct {
     Tvg_Canvas * canvas;
-    int32_t partial_y_offset;
+    lv_area_t draw_area;    /**< The area of the layer to update with absolute coordinates*/
     int32_t translate_x;
     int32_t translate_y;
     lv_opa_t opa;
@@ -390,42 +390,62 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
     tvg_paint_set_blend_method(obj, lv_blend_to_tvg(blend));
 }
 
-static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area, const lv_draw_buf_t * new_buf,
-                            const lv_area_t * src_area)
+static bool _row_is_empty(const uint32_t * row, int32_t w)
 {
-    lv_draw_sw_blend_image_dsc_t fill_dsc;
-    fill_dsc.dest_w = src_area->x2;
-    fill_dsc.dest_h = src_area->y2;
-    fill_dsc.dest_stride = draw_buf->header.stride;
-    fill_dsc.dest_buf = draw_buf->data;
-
-    fill_dsc.opa = LV_OPA_100;
-    fill_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
-    fill_dsc.src_stride = new_buf->header.stride;
-    fill_dsc.src_color_format = new_buf->header.cf;
-    fill_dsc.src_buf = new_buf->data;
-
-    fill_dsc.mask_buf = NULL;
-    fill_dsc.mask_stride = 0;
-
-    fill_dsc.relative_area = *dst_area;
-    fill_dsc.src_area  = *src_area;
-
-    switch(draw_buf->header.cf) {
-#if LV_DRAW_SW_SUPPORT_RGB565
-        case LV_COLOR_FORMAT_RGB565:
-        case LV_COLOR_FORMAT_RGB565A8:
-            lv_draw_sw_blend_image_to_rgb565(&fill_dsc);
-            break;
-#endif
-#if LV_DRAW_SW_SUPPORT_RGB888
-        case LV_COLOR_FORMAT_RGB888:
-            lv_draw_sw_blend_image_to_rgb888(&fill_dsc, 3);
-            break;
-#endif
-        default:
-            break;
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        if(row[x]) return false;
+    }
+    return true;
+}
+
+static lv_draw_buf_t * _scratch_buf_get(lv_draw_sw_vector_ctx_t * ctx, int32_t w, int32_t h)
+{
+    /*Reuse the buffer of the previous tasks if it's large enough*/
+    if(ctx->scratch_buf &&
+       lv_draw_buf_reshape(ctx->scratch_buf, LV_COLOR_FORMAT_ARGB8888, w, h, LV_STRIDE_AUTO) == NULL) {
+        lv_draw_buf_destroy(ctx->scratch_buf);
+        ctx->scratch_buf = NULL;
     }
+
+    if(ctx->scratch_buf == NULL) {
+        ctx->scratch_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(ctx->scratch_buf == NULL) return NULL;
+    }
+
+    lv_draw_buf_clear(ctx->scratch_buf, NULL);
+    return ctx->scratch_buf;
+}
+
+static void _blend_scratch_buf(lv_draw_task_t * t, const lv_draw_buf_t * scratch_buf, const lv_area_t * draw_area)
+{
+    const uint8_t * data = scratch_buf->data;
+    uint32_t stride = scratch_buf->header.stride;
+    int32_t w = scratch_buf->header.w;
+    int32_t h = scratch_buf->header.h;
+
+    /*Blend only the rows touched by the paths*/
+    int32_t y_first = 0;
+    while(y_first < h && _row_is_empty((const uint32_t *)(data + y_first * stride), w)) y_first++;
+    if(y_first == h) return;
+
+    int32_t y_last = h - 1;
+    while(y_last > y_first && _row_is_empty((const uint32_t *)(data + y_last * stride), w)) y_last--;
+
+    lv_area_t blend_area = *draw_area;
+    blend_area.y1 = draw_area->y1 + y_first;
+    blend_area.y2 = draw_area->y1 + y_last;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.src_area = draw_area;
+    blend_dsc.src_buf = data;
+    blend_dsc.src_stride = stride;
+    blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    blend_dsc.opa = LV_OPA_COVER;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend(t, &blend_dsc);
 }
 
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc)
@@ -452,8 +472,12 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
         tvg_shape_set_fill_color(obj, c.r, c.g, c.b, c.a);
     }
     else {
-        tvg_canvas_set_viewport(canvas, (int32_t)rc.x + state->translate_x, (int32_t)rc.y + state->translate_y,
-                                (int32_t)rc.w, (int32_t)rc.h);
+        /*Don't draw outside of the task's area as other threads might draw there*/
+        lv_area_t scissor_area;
+        if(lv_area_intersect(&scissor_area, &dsc->scissor_area, &state->draw_area)) {
+            tvg_canvas_set_viewport(canvas, scissor_area.x1 + state->translate_x, scissor_area.y1 + state->translate_y,
+                                    lv_area_get_width(&scissor_area), lv_area_get_height(&scissor_area));
+        }
 
         lv_matrix_t matrix;
         lv_matrix_identity(&matrix);
@@ -473,6 +497,55 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
     tvg_canvas_push(canvas, obj);
 }
 
+static void _render(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc, lv_draw_sw_vector_ctx_t * ctx,
+                    const lv_area_t * draw_area)
+{
+    lv_layer_t * layer = dsc->base.layer;
+    lv_draw_buf_t * draw_buf = layer->draw_buf;
+    Tvg_Canvas * canvas = ctx->canvas;
+    int32_t draw_w = lv_area_get_width(draw_area);
+    int32_t draw_h = lv_area_get_height(draw_area);
+
+    _tvg_draw_state state = {canvas, *draw_area, -layer->buf_area.x1, -layer->buf_area.y1, t->opa};
+
+    /*ThorVG renders only to ARGB8888 so render the other formats into a buffer of the draw area's size
+     *and blend it to the layer.*/
+    lv_draw_buf_t * scratch_buf = NULL;
+    lv_color_format_t cf = draw_buf->header.cf;
+    if(cf != LV_COLOR_FORMAT_ARGB8888 && cf != LV_COLOR_FORMAT_XRGB8888) {
+        scratch_buf = _scratch_buf_get(ctx, draw_w, draw_h);
+        if(scratch_buf == NULL) return;
+
+        tvg_swcanvas_set_target(canvas, (uint32_t *)scratch_buf->data, scratch_buf->header.stride / 4, draw_w, draw_h,
+                                TVG_COLORSPACE_ARGB8888);
+        state.translate_x = -draw_area->x1;
+        state.translate_y = -draw_area->y1;
+    }
+    else {
+        tvg_swcanvas_set_target(canvas, (uint32_t *)draw_buf->data, draw_buf->header.stride / 4,
+                                lv_area_get_width(&layer->buf_area), lv_area_get_height(&layer->buf_area),
+                                TVG_COLORSPACE_ARGB8888);
+    }
+
+    tvg_canvas_set_viewport(canvas, draw_area->x1 + state.translate_x, draw_area->y1 + state.translate_y,
+                            draw_w, draw_h);
+
+    lv_ll_t * task_list = dsc->task_list;
+    lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &state);
+    dsc->task_list = NULL;
+
+    if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
+        tvg_canvas_sync(canvas);
+    }
+
+    /*Free the paints but keep the canvas for the next task*/
+    tvg_canvas_clear(canvas, true);
+
+    if(scratch_buf) {
+        _blend_scratch_buf(t, scratch_buf, draw_area);
+    }
+}
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -487,48 +560,41 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
     if(draw_buf == NULL)
         return;
 
-    void * buf = draw_buf->data;
-    int32_t width = lv_area_get_width(&layer->buf_area);
-    int32_t height = lv_area_get_height(&layer->buf_area);
-    uint32_t stride = draw_buf->header.stride;
-
-    lv_color_format_t cf = draw_buf->header.cf;
-
-    bool allow_buffer = false;
-    lv_draw_buf_t * new_buf = NULL;
+    /*Only the clip area of the task can change*/
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->clip_area, &layer->buf_area))
+        return;
 
-    if(cf != LV_COLOR_FORMAT_ARGB8888 && \
-       cf != LV_COLOR_FORMAT_XRGB8888) {
-        allow_buffer = true;
-        new_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
-        lv_draw_buf_clear(new_buf, NULL);
-        buf = new_buf->data;
-        stride = new_buf->header.stride;
+    /*The canvas and the buffer are kept by the SW draw unit between the tasks.
+     *Use temporary ones if the task is rendered by an other draw unit.*/
+    lv_draw_sw_vector_ctx_t tmp_ctx;
+    lv_draw_sw_vector_ctx_t * ctx = lv_draw_sw_vector_ctx_get(t->draw_unit);
+    if(ctx == NULL) {
+        lv_memzero(&tmp_ctx, sizeof(tmp_ctx));
+        ctx = &tmp_ctx;
     }
-    Tvg_Canvas * canvas = tvg_swcanvas_create();
-    tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
-    _tvg_rect rc;
-    lv_area_to_tvg(&rc, &t->clip_area);
-    tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)(rc.y - layer->partial_y_offset), (int32_t)rc.w, (int32_t)rc.h);
+    if(ctx->canvas == NULL) ctx->canvas = tvg_swcanvas_create();
 
-    _tvg_draw_state state = {canvas, layer->partial_y_offset, -layer->buf_area.x1, -layer->buf_area.y1, t->opa};
+    if(ctx->canvas) {
+        _render(t, dsc, ctx, &draw_area);
+    }
 
-    lv_ll_t * task_list = dsc->task_list;
-    lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &state);
-    dsc->task_list = NULL;
+    if(ctx == &tmp_ctx) lv_draw_sw_vector_ctx_deinit(ctx);
+    else lv_draw_sw_vector_ctx_release(t->draw_unit, ctx);
+}
 
-    if(tvg_canvas_draw(canvas) == TVG_RESULT_SUCCESS) {
-        tvg_canvas_sync(canvas);
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx)
+{
+    if(ctx->canvas) {
+        tvg_canvas_destroy(ctx->canvas);
+        ctx->canvas = NULL;
     }
 
-    if(allow_buffer) {
-        lv_area_t src_area = {0, 0, width, height};
-        _blend_draw_buf(draw_buf, &layer->buf_area, new_buf, &src_area);
-        lv_draw_buf_destroy(new_buf);
+    if(ctx->scratch_buf) {
+        lv_draw_buf_destroy(ctx->scratch_buf);
+        ctx->scratch_buf = NULL;
     }
-
-    tvg_canvas_destroy(canvas);
 }
 
 /**********************
@@ -10,16 +10,55 @@
 #include "../../lvgl_public.h"
 #include "../fmt_txt/lv_font_fmt_txt_private.h"
 #include "../../fs/lv_fs_private.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_entry.h"
+#include "../../misc/cache/class/lv_cache_lru_rb.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_FONT_FMT_TXT_LARGE
+    #define BITMAP_INDEX_MAX    UINT32_MAX
+#else
+    #define BITMAP_INDEX_MAX    0xFFFFF     /*`bitmap_index` has 20 bits*/
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+
+/** Reads the font file from the file system or from its mapped content*/
 typedef struct {
     lv_fs_file_t * fp;
+    const uint8_t * data;       /**< The mapped font file or NULL to read `fp`*/
+    uint32_t size;              /**< Size of `data`*/
+    uint32_t pos;               /**< Read position in `data`*/
+} font_reader_t;
+
+typedef struct {
+    font_reader_t * reader;
     int8_t bit_pos;
     uint8_t byte_value;
 } bit_iterator_t;
 
+/** The `dsc` of the loaded fonts*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t fmt_txt;  /**< Must be the first to be used by the `fmt_txt` functions*/
+    lv_fs_file_t file;              /**< Kept open if the font points into the mapped file or reads bitmaps later*/
+    const uint8_t * map;            /**< The mapped font file or NULL*/
+    uint32_t map_size;              /**< Size of `map`*/
+    lv_cache_t * bitmap_cache;      /**< Cache of the glyph bitmaps read on demand or NULL if all are loaded*/
+    uint32_t * glyph_pos;           /**< File position of the glyphs and the end of the last glyph*/
+    uint8_t glyph_header_bits;      /**< Size of the glyph descriptor before the bitmap in bits*/
+} binfont_dsc_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;      /**< The size of the bitmap*/
+    uint32_t gid;
+    uint8_t * bitmap;
+} bitmap_cache_data_t;
+
 typedef struct font_header_bin {
     uint32_t version;
     uint16_t tables_count;
@@ -60,9 +99,23 @@ typedef struct cmap_table_bin {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+static bit_iterator_t init_bit_iterator(font_reader_t * reader);
+static bool lvgl_load_font(font_reader_t * reader, lv_font_t * font, uint32_t cache_size);
+static int32_t load_kern(font_reader_t * reader, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+
+static lv_fs_res_t reader_read(font_reader_t * reader, void * buf, uint32_t btr);
+static lv_fs_res_t reader_seek(font_reader_t * reader, uint32_t pos);
+static lv_fs_res_t read_table(font_reader_t * reader, uint32_t size, uint32_t align, void ** table);
+static lv_fs_res_t read_glyph_bitmap(font_reader_t * reader, uint32_t glyph_pos, uint32_t header_bits,
+                                     uint32_t bmp_size, uint8_t * bitmap);
+static void free_table(const binfont_dsc_t * dsc, const void * table);
+
+static const void * get_glyph_bitmap_cached_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf);
+static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data);
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data);
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs,
+                                                      const bitmap_cache_data_t * rhs);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -93,16 +146,41 @@ const lv_font_class_t lv_binfont_font_class = {
 
 lv_font_t * lv_binfont_create(const char * path)
 {
-    LV_ASSERT_NULL(path);
+    return lv_binfont_create_ex(path, LV_BINFONT_CACHE_SIZE);
+}
 
-    lv_fs_file_t file;
-    lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
-    if(fs_res != LV_FS_RES_OK) return NULL;
+lv_font_t * lv_binfont_create_ex(const char * path, uint32_t cache_size)
+{
+    LV_ASSERT_NULL(path);
 
     lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
     LV_ASSERT_MALLOC(font);
+    if(font == NULL) return NULL;
+
+    binfont_dsc_t * dsc = lv_malloc_zeroed(sizeof(binfont_dsc_t));
+    LV_ASSERT_MALLOC(dsc);
+    if(dsc == NULL) {
+        lv_free(font);
+        return NULL;
+    }
+
+    lv_fs_res_t fs_res = lv_fs_open(&dsc->file, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) {
+        lv_free(dsc);
+        lv_free(font);
+        return NULL;
+    }
+
+    font->dsc = dsc;
+
+    font_reader_t reader = {.fp = &dsc->file};
+#if LV_BINFONT_ZERO_COPY
+    dsc->map = lv_fs_map(&dsc->file, &dsc->map_size);
+    reader.data = dsc->map;
+    reader.size = dsc->map_size;
+#endif
 
-    if(!lvgl_load_font(&file, font)) {
+    if(!lvgl_load_font(&reader, font, cache_size)) {
         LV_LOG_WARN("Error loading font file: %s", path);
         /*
         * When `lvgl_load_font` fails it can leak some pointers.
@@ -110,10 +188,13 @@ lv_font_t * lv_binfont_create(const char * path)
         * `lv_binfont_destroy` should free them correctly.
         */
         lv_binfont_destroy(font);
-        font = NULL;
+        return NULL;
     }
 
-    lv_fs_close(&file);
+    /*The file is used later only if the font points into it or reads the bitmaps on demand*/
+    if(dsc->map == NULL && dsc->bitmap_cache == NULL) {
+        lv_fs_close(&dsc->file);
+    }
 
     return font;
 }
@@ -132,23 +213,25 @@ void lv_binfont_destroy(lv_font_t * font)
 {
     if(font == NULL) return;
 
-    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
-    if(dsc == NULL) return;
+    binfont_dsc_t * binfont_dsc = (binfont_dsc_t *)font->dsc;
+    if(binfont_dsc == NULL) return;
+
+    const lv_font_fmt_txt_dsc_t * dsc = &binfont_dsc->fmt_txt;
 
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
-            lv_free((void *)kern_dsc->glyph_ids);
-            lv_free((void *)kern_dsc->values);
+            free_table(binfont_dsc, kern_dsc->glyph_ids);
+            free_table(binfont_dsc, kern_dsc->values);
             lv_free((void *)kern_dsc);
         }
     }
     else {
         const lv_font_fmt_txt_kern_classes_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
-            lv_free((void *)kern_dsc->class_pair_values);
-            lv_free((void *)kern_dsc->left_class_mapping);
-            lv_free((void *)kern_dsc->right_class_mapping);
+            free_table(binfont_dsc, kern_dsc->class_pair_values);
+            free_table(binfont_dsc, kern_dsc->left_class_mapping);
+            free_table(binfont_dsc, kern_dsc->right_class_mapping);
             lv_free((void *)kern_dsc);
         }
     }
@@ -156,15 +239,31 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_cmap_t * cmaps = dsc->cmaps;
     if(NULL != cmaps) {
         for(int i = 0; i < dsc->cmap_num; ++i) {
-            lv_free((void *)cmaps[i].glyph_id_ofs_list);
-            lv_free((void *)cmaps[i].unicode_list);
+            free_table(binfont_dsc, cmaps[i].glyph_id_ofs_list);
+            free_table(binfont_dsc, cmaps[i].unicode_list);
         }
         lv_free((void *)cmaps);
     }
 
-    lv_free((void *)dsc->glyph_bitmap);
+    /*The glyphs and glyph ids of this font might be cached by their descriptor address*/
+    lv_font_fmt_txt_cache_invalidate();
+
+    if(binfont_dsc->bitmap_cache) {
+        lv_cache_destroy(binfont_dsc->bitmap_cache, NULL);
+    }
+    lv_free(binfont_dsc->glyph_pos);
+
+    free_table(binfont_dsc, dsc->glyph_bitmap);
     lv_free((void *)dsc->glyph_dsc);
-    lv_free((void *)dsc);
+
+    if(binfont_dsc->map) {
+        lv_fs_unmap(&binfont_dsc->file, binfont_dsc->map, binfont_dsc->map_size);
+    }
+    if(binfont_dsc->file.drv) {
+        lv_fs_close(&binfont_dsc->file);
+    }
+
+    lv_free(binfont_dsc);
     lv_free(font);
 }
 
@@ -172,10 +271,10 @@ void lv_binfont_destroy(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
+static bit_iterator_t init_bit_iterator(font_reader_t * reader)
 {
     bit_iterator_t it;
-    it.fp = fp;
+    it.reader = reader;
     it.bit_pos = -1;
     it.byte_value = 0;
     return it;
@@ -190,7 +289,7 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
 
         if(it->bit_pos < 0) {
             it->bit_pos = 7;
-            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+            *res = reader_read(it->reader, &(it->byte_value), 1);
             if(*res != LV_FS_RES_OK) {
                 return 0;
             }
@@ -212,15 +311,136 @@ static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
     return value;
 }
 
-static int read_label(lv_fs_file_t * fp, int start, const char * label)
+/**
+ * Read from the current position of the font file
+ * @param reader    pointer to a font reader
+ * @param buf       store the read bytes here
+ * @param btr       number of bytes to read
+ * @return          LV_FS_RES_OK or any error from `lv_fs_res_t`
+ */
+static lv_fs_res_t reader_read(font_reader_t * reader, void * buf, uint32_t btr)
 {
-    lv_fs_seek(fp, start, LV_FS_SEEK_SET);
+    if(reader->data == NULL) {
+        return lv_fs_read(reader->fp, buf, btr, NULL);
+    }
+
+    if(btr > reader->size - reader->pos) {
+        return LV_FS_RES_UNKNOWN;
+    }
+
+    lv_memcpy(buf, reader->data + reader->pos, btr);
+    reader->pos += btr;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Set the read position in the font file
+ * @param reader    pointer to a font reader
+ * @param pos       the new position from the start of the file
+ * @return          LV_FS_RES_OK or any error from `lv_fs_res_t`
+ */
+static lv_fs_res_t reader_seek(font_reader_t * reader, uint32_t pos)
+{
+    if(reader->data == NULL) {
+        return lv_fs_seek(reader->fp, pos, LV_FS_SEEK_SET);
+    }
+
+    if(pos > reader->size) {
+        return LV_FS_RES_UNKNOWN;
+    }
+
+    reader->pos = pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Get a table from the current position of the font file. It points into the mapped file
+ * if the file is mapped and the table is aligned, else it's allocated and read.
+ * @param reader    pointer to a font reader
+ * @param size      size of the table in bytes
+ * @param align     required alignment of the table
+ * @param table     store the table here. It's set even if reading fails so that it can be freed.
+ * @return          LV_FS_RES_OK or any error from `lv_fs_res_t`
+ */
+static lv_fs_res_t read_table(font_reader_t * reader, uint32_t size, uint32_t align, void ** table)
+{
+    if(reader->data && size <= reader->size - reader->pos &&
+       ((lv_uintptr_t)(reader->data + reader->pos) & (align - 1)) == 0) {
+        *table = (void *)(reader->data + reader->pos);
+        reader->pos += size;
+        return LV_FS_RES_OK;
+    }
+
+    *table = lv_malloc(size);
+    LV_ASSERT_MALLOC(*table);
+    if(*table == NULL) {
+        return LV_FS_RES_OUT_OF_MEM;
+    }
+
+    return reader_read(reader, *table, size);
+}
+
+/**
+ * Free a table unless it points into the mapped font file
+ * @param dsc       the descriptor of the font
+ * @param table     the table to free. Can be NULL.
+ */
+static void free_table(const binfont_dsc_t * dsc, const void * table)
+{
+    const uint8_t * table_u8 = table;
+    if(dsc->map && table_u8 >= dsc->map && table_u8 < dsc->map + dsc->map_size) return;
+
+    lv_free((void *)table);
+}
+
+/**
+ * Read the bitmap of a glyph. It follows the descriptor of the glyph
+ * so it starts on a byte boundary only if the descriptor's size is a multiple of 8 bits.
+ * @param reader        pointer to a font reader
+ * @param glyph_pos     the position of the glyph in the file
+ * @param header_bits   size of the glyph descriptor in bits
+ * @param bmp_size      size of the bitmap in bytes
+ * @param bitmap        store the bitmap here
+ * @return              LV_FS_RES_OK or any error from `lv_fs_res_t`
+ */
+static lv_fs_res_t read_glyph_bitmap(font_reader_t * reader, uint32_t glyph_pos, uint32_t header_bits,
+                                     uint32_t bmp_size, uint8_t * bitmap)
+{
+    lv_fs_res_t res = reader_seek(reader, glyph_pos + header_bits / 8);
+    if(res != LV_FS_RES_OK) {
+        return res;
+    }
+
+    /*Read the bytes the bitmap overlaps and shift them in place*/
+    res = reader_read(reader, bitmap, bmp_size);
+    if(res != LV_FS_RES_OK || bmp_size == 0) {
+        return res;
+    }
+
+    uint32_t shift = header_bits % 8;
+    if(shift == 0) {
+        return LV_FS_RES_OK;
+    }
+
+    for(uint32_t k = 0; k < bmp_size - 1; k++) {
+        bitmap[k] = (uint8_t)((bitmap[k] << shift) | (bitmap[k + 1] >> (8 - shift)));
+    }
+
+    /*The last fragment should be on the MSB*/
+    bitmap[bmp_size - 1] = (uint8_t)(bitmap[bmp_size - 1] << shift);
+
+    return LV_FS_RES_OK;
+}
+
+static int read_label(font_reader_t * reader, int start, const char * label)
+{
+    reader_seek(reader, start);
 
     uint32_t length;
     char buf[4];
 
-    if(lv_fs_read(fp, &length, 4, NULL) != LV_FS_RES_OK
-       || lv_fs_read(fp, buf, 4, NULL) != LV_FS_RES_OK
+    if(reader_read(reader, &length, 4) != LV_FS_RES_OK
+       || reader_read(reader, buf, 4) != LV_FS_RES_OK
        || lv_memcmp(label, buf, 4) != 0) {
         LV_LOG_WARN("Error reading '%s' label.", label);
         return -1;
@@ -229,15 +449,15 @@ static int read_label(lv_fs_file_t * fp, int start, const char * label)
     return length;
 }
 
-static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+static bool load_cmaps_tables(font_reader_t * reader, lv_font_fmt_txt_dsc_t * font_dsc,
                               uint32_t cmaps_start, cmap_table_bin_t * cmap_table)
 {
-    if(lv_fs_read(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(reader, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
     for(unsigned int i = 0; i < font_dsc->cmap_num; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, cmaps_start + cmap_table[i].data_offset, LV_FS_SEEK_SET);
+        lv_fs_res_t res = reader_seek(reader, cmaps_start + cmap_table[i].data_offset);
         if(res != LV_FS_RES_OK) {
             return false;
         }
@@ -252,11 +472,12 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
         switch(cmap_table[i].format_type) {
             case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
                     uint32_t ids_size = (uint32_t)(sizeof(uint8_t) * cmap_table[i].data_entries_count);
-                    uint8_t * glyph_id_ofs_list = lv_malloc(ids_size);
+                    void * glyph_id_ofs_list;
+                    res = read_table(reader, ids_size, sizeof(uint8_t), &glyph_id_ofs_list);
 
                     cmap->glyph_id_ofs_list = glyph_id_ofs_list;
 
-                    if(lv_fs_read(fp, glyph_id_ofs_list, ids_size, NULL) != LV_FS_RES_OK) {
+                    if(res != LV_FS_RES_OK) {
                         return false;
                     }
 
@@ -268,21 +489,23 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
             case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
             case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
                     uint32_t list_size = sizeof(uint16_t) * cmap_table[i].data_entries_count;
-                    uint16_t * unicode_list = (uint16_t *)lv_malloc(list_size);
+                    void * unicode_list;
+                    res = read_table(reader, list_size, sizeof(uint16_t), &unicode_list);
 
                     cmap->unicode_list = unicode_list;
                     cmap->list_length = cmap_table[i].data_entries_count;
 
-                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                    if(res != LV_FS_RES_OK) {
                         return false;
                     }
 
                     if(cmap_table[i].format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-                        uint16_t * buf = lv_malloc(sizeof(uint16_t) * cmap->list_length);
+                        void * buf;
+                        res = read_table(reader, sizeof(uint16_t) * cmap->list_length, sizeof(uint16_t), &buf);
 
                         cmap->glyph_id_ofs_list = buf;
 
-                        if(lv_fs_read(fp, buf, sizeof(uint16_t) * cmap->list_length, NULL) != LV_FS_RES_OK) {
+                        if(res != LV_FS_RES_OK) {
                             return false;
                         }
                     }
@@ -296,15 +519,15 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
     return true;
 }
 
-static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
+static int32_t load_cmaps(font_reader_t * reader, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
 {
-    int32_t cmaps_length = read_label(fp, cmaps_start, "cmap");
+    int32_t cmaps_length = read_label(reader, cmaps_start, "cmap");
     if(cmaps_length < 0) {
         return -1;
     }
 
     uint32_t cmaps_subtables_count;
-    if(lv_fs_read(fp, &cmaps_subtables_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(reader, &cmaps_subtables_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -318,17 +541,19 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 
     cmap_table_bin_t * cmaps_tables = lv_malloc(sizeof(cmap_table_bin_t) * font_dsc->cmap_num);
 
-    bool success = load_cmaps_tables(fp, font_dsc, cmaps_start, cmaps_tables);
+    bool success = load_cmaps_tables(reader, font_dsc, cmaps_start, cmaps_tables);
 
     lv_free(cmaps_tables);
 
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+static int32_t load_glyph(font_reader_t * reader, binfont_dsc_t * dsc, uint32_t start, uint32_t * glyph_offset,
+                          uint32_t loca_count, font_header_bin_t * header, uint32_t cache_size)
 {
-    int32_t glyph_length = read_label(fp, start, "glyf");
+    lv_font_fmt_txt_dsc_t * font_dsc = &dsc->fmt_txt;
+
+    int32_t glyph_length = read_label(reader, start, "glyf");
     if(glyph_length < 0) {
         return -1;
     }
@@ -340,17 +565,22 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 
     font_dsc->glyph_dsc = glyph_dsc;
 
+    int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+
+    /*Bitmaps starting on a byte boundary can be used from the mapped file as they are*/
+    bool bitmap_in_map = reader->data && nbits % 8 == 0 && (uint32_t)glyph_length <= BITMAP_INDEX_MAX;
+
     int cur_bmp_size = 0;
 
     for(unsigned int i = 0; i < loca_count; ++i) {
         lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
 
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        lv_fs_res_t res = reader_seek(reader, start + glyph_offset[i]);
         if(res != LV_FS_RES_OK) {
             return -1;
         }
 
-        bit_iterator_t bit_it = init_bit_iterator(fp);
+        bit_iterator_t bit_it = init_bit_iterator(reader);
 
         if(header->advance_width_bits == 0) {
             gdsc->adv_w = header->default_advance_width;
@@ -386,7 +616,6 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             return -1;
         }
 
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
         int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
@@ -398,10 +627,48 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             gdsc->ofs_y = 0;
         }
 
-        gdsc->bitmap_index = cur_bmp_size;
-        if(gdsc->box_w * gdsc->box_h != 0) {
-            cur_bmp_size += bmp_size;
+        if(bitmap_in_map) {
+            gdsc->bitmap_index = glyph_offset[i] + nbits / 8;
+        }
+        else if(cache_size == 0) {
+            gdsc->bitmap_index = cur_bmp_size;
+            if(gdsc->box_w * gdsc->box_h != 0) {
+                cur_bmp_size += bmp_size;
+            }
+        }
+    }
+
+    if(bitmap_in_map) {
+        font_dsc->glyph_bitmap = reader->data + start;
+        return glyph_length;
+    }
+
+    if(cache_size) {
+        /*Keep only the position of the glyphs and read the bitmaps when they are drawn*/
+        dsc->glyph_pos = lv_malloc(sizeof(uint32_t) * (loca_count + 1));
+        LV_ASSERT_MALLOC(dsc->glyph_pos);
+        if(dsc->glyph_pos == NULL) {
+            return -1;
+        }
+
+        for(unsigned int i = 0; i < loca_count; ++i) {
+            dsc->glyph_pos[i] = start + glyph_offset[i];
+        }
+        dsc->glyph_pos[loca_count] = start + glyph_length;
+        dsc->glyph_header_bits = (uint8_t)nbits;
+
+        dsc->bitmap_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(bitmap_cache_data_t), cache_size,
+        (lv_cache_ops_t) {
+            .compare_cb = (lv_cache_compare_cb_t)bitmap_cache_compare_cb,
+            .create_cb = (lv_cache_create_cb_t)bitmap_cache_create_cb,
+            .free_cb = (lv_cache_free_cb_t)bitmap_cache_free_cb,
+        });
+        if(dsc->bitmap_cache == NULL) {
+            return -1;
         }
+        lv_cache_set_name(dsc->bitmap_cache, "BINFONT_BITMAP");
+
+        return glyph_length;
     }
 
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
@@ -412,19 +679,6 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     cur_bmp_size = 0;
 
     for(unsigned int i = 1; i < loca_count; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
-        bit_iterator_t bit_it = init_bit_iterator(fp);
-
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
-
-        read_bits(&bit_it, nbits, &res);
-        if(res != LV_FS_RES_OK) {
-            return -1;
-        }
-
         if(glyph_dsc[i].box_w * glyph_dsc[i].box_h == 0) {
             continue;
         }
@@ -432,26 +686,8 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
-        if(nbits % 8 == 0) {  /*Fast path*/
-            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
-                return -1;
-            }
-        }
-        else {
-            for(int k = 0; k < bmp_size - 1; ++k) {
-                glyph_bmp[cur_bmp_size + k] = read_bits(&bit_it, 8, &res);
-                if(res != LV_FS_RES_OK) {
-                    return -1;
-                }
-            }
-            glyph_bmp[cur_bmp_size + bmp_size - 1] = read_bits(&bit_it, 8 - nbits % 8, &res);
-            if(res != LV_FS_RES_OK) {
-                return -1;
-            }
-
-            /*The last fragment should be on the MSB but read_bits() will place it to the LSB*/
-            glyph_bmp[cur_bmp_size + bmp_size - 1] = glyph_bmp[cur_bmp_size + bmp_size - 1] << (nbits % 8);
-
+        if(read_glyph_bitmap(reader, start + glyph_offset[i], nbits, bmp_size, &glyph_bmp[cur_bmp_size]) != LV_FS_RES_OK) {
+            return -1;
         }
 
         cur_bmp_size += bmp_size;
@@ -459,15 +695,100 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     return glyph_length;
 }
 
-static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * glyph_dsc)
+/**
+ * Get the bitmap of a glyph from the bitmap cache. The bitmap is read from the file if it's not cached.
+ * @param g_dsc         the glyph descriptor
+ * @param draw_buf      the draw buffer to decode the bitmap into
+ * @return              `draw_buf`, the raw bitmap if `req_raw_bitmap` is set or NULL on error
+ */
+static const void * get_glyph_bitmap_cached_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
-    LV_UNUSED(font);
-    LV_UNUSED(glyph_dsc);
-    /*No custom memory management needed*/
+    const lv_font_t * font = g_dsc->resolved_font;
+    binfont_dsc_t * dsc = (binfont_dsc_t *)font->dsc;
+    uint32_t gid = g_dsc->gid.index;
+    if(!gid) return NULL;
+
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &dsc->fmt_txt.glyph_dsc[gid];
+    if(gdsc->box_w * gdsc->box_h == 0) return NULL;
+
+    bitmap_cache_data_t search_key = {
+        .slot.size = dsc->glyph_pos[gid + 1] - dsc->glyph_pos[gid] - dsc->glyph_header_bits / 8,
+        .gid = gid,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->bitmap_cache, &search_key, dsc);
+    if(entry == NULL) {
+        LV_LOG_WARN("Couldn't get the bitmap of glyph %" LV_PRIu32, gid);
+        return NULL;
+    }
+
+    bitmap_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+
+    /*The raw bitmap needs to stay in the cache until the glyph is released*/
+    if(g_dsc->req_raw_bitmap) {
+        g_dsc->entry = entry;
+        return cached_data->bitmap;
+    }
+
+    const void * res = lv_font_fmt_txt_decode_bitmap(&dsc->fmt_txt, gdsc, cached_data->bitmap, g_dsc->stride, draw_buf);
+    lv_cache_release(dsc->bitmap_cache, entry, NULL);
+    return res;
+}
+
+static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    const binfont_dsc_t * dsc = font->dsc;
+    if(dsc->bitmap_cache == NULL || g_dsc->entry == NULL) return;
+
+    lv_cache_release(dsc->bitmap_cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    binfont_dsc_t * dsc = user_data;
+
+    node->bitmap = lv_malloc(node->slot.size);
+    LV_ASSERT_MALLOC(node->bitmap);
+    if(node->bitmap == NULL) return false;
+
+    /*It's called with the cache locked so the file is not read from other threads at the same time*/
+    font_reader_t reader = {
+        .fp = &dsc->file,
+        .data = dsc->map,
+        .size = dsc->map_size,
+    };
+
+    if(read_glyph_bitmap(&reader, dsc->glyph_pos[node->gid], dsc->glyph_header_bits,
+                         (uint32_t)node->slot.size, node->bitmap) != LV_FS_RES_OK) {
+        lv_free(node->bitmap);
+        node->bitmap = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(node->bitmap);
+    node->bitmap = NULL;
+}
+
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs,
+                                                      const bitmap_cache_data_t * rhs)
+{
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+
+    return 0;
 }
 
 /*
- * Loads a `lv_font_t` from a binary file, given a `lv_fs_file_t`.
+ * Loads a `lv_font_t` from a binary file, given a font reader.
  *
  * Memory allocations on `lvgl_load_font` should be immediately zeroed and
  * the pointer should be set on the `lv_font_t` data before any possible return.
@@ -475,26 +796,22 @@ static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * glyph
  * When something fails, it returns `false` and the memory on the `lv_font_t`
  * still needs to be freed using `lv_binfont_destroy`.
  *
- * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
- * should be freed.
+ * `lv_binfont_destroy` will assume that all non-null pointers are allocated
+ * or point into the mapped font file.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(font_reader_t * reader, lv_font_t * font, uint32_t cache_size)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
-
-    lv_memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
-
-    font->dsc = font_dsc;
+    binfont_dsc_t * dsc = (binfont_dsc_t *)font->dsc;
+    lv_font_fmt_txt_dsc_t * font_dsc = &dsc->fmt_txt;
 
     /*header*/
-    int32_t header_length = read_label(fp, 0, "head");
+    int32_t header_length = read_label(reader, 0, "head");
     if(header_length < 0) {
         return false;
     }
 
     font_header_bin_t font_header;
-    if(lv_fs_read(fp, &font_header, sizeof(font_header_bin_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(reader, &font_header, sizeof(font_header_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -513,20 +830,20 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     /*cmaps*/
     uint32_t cmaps_start = header_length;
-    int32_t cmaps_length = load_cmaps(fp, font_dsc, cmaps_start);
+    int32_t cmaps_length = load_cmaps(reader, font_dsc, cmaps_start);
     if(cmaps_length < 0) {
         return false;
     }
 
     /*loca*/
     uint32_t loca_start = cmaps_start + cmaps_length;
-    int32_t loca_length = read_label(fp, loca_start, "loca");
+    int32_t loca_length = read_label(reader, loca_start, "loca");
     if(loca_length < 0) {
         return false;
     }
 
     uint32_t loca_count;
-    if(lv_fs_read(fp, &loca_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(reader, &loca_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -536,7 +853,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     if(font_header.index_to_loc_format == 0) {
         for(unsigned int i = 0; i < loca_count; ++i) {
             uint16_t offset;
-            if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
+            if(reader_read(reader, &offset, sizeof(uint16_t)) != LV_FS_RES_OK) {
                 failed = true;
                 break;
             }
@@ -544,7 +861,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         }
     }
     else if(font_header.index_to_loc_format == 1) {
-        if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(reader, glyph_offset, loca_count * sizeof(uint32_t)) != LV_FS_RES_OK) {
             failed = true;
         }
     }
@@ -561,7 +878,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               reader, dsc, glyph_start, glyph_offset, loca_count, &font_header, cache_size);
 
     lv_free(glyph_offset);
 
@@ -569,6 +886,10 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         return false;
     }
 
+    if(dsc->bitmap_cache) {
+        font->get_glyph_bitmap = get_glyph_bitmap_cached_cb;
+    }
+
     /*kerning*/
     if(font_header.tables_count < 4) {
         font_dsc->kern_dsc = NULL;
@@ -579,22 +900,22 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     uint32_t kern_start = glyph_start + glyph_length;
 
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+    int32_t kern_length = load_kern(reader, font_dsc, font_header.glyph_id_format, kern_start);
 
     return kern_length >= 0;
 }
 
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+static int32_t load_kern(font_reader_t * reader, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
 {
-    int32_t kern_length = read_label(fp, start, "kern");
+    int32_t kern_length = read_label(reader, start, "kern");
     if(kern_length < 0) {
         return -1;
     }
 
     uint8_t kern_format_type;
     int32_t padding;
-    if(lv_fs_read(fp, &kern_format_type, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-       lv_fs_read(fp, &padding, 3 * sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+    if(reader_read(reader, &kern_format_type, sizeof(uint8_t)) != LV_FS_RES_OK ||
+       reader_read(reader, &padding, 3 * sizeof(uint8_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -607,31 +928,35 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         font_dsc->kern_classes = 0;
 
         uint32_t glyph_entries;
-        if(lv_fs_read(fp, &glyph_entries, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(reader, &glyph_entries, sizeof(uint32_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
         int ids_size;
+        uint32_t ids_align;
         if(format == 0) {
             ids_size = sizeof(int8_t) * 2 * glyph_entries;
+            ids_align = sizeof(int8_t);
         }
         else {
             ids_size = sizeof(int16_t) * 2 * glyph_entries;
+            ids_align = sizeof(int16_t);
         }
 
-        uint8_t * glyph_ids = lv_malloc(ids_size);
-        int8_t * values = lv_malloc(glyph_entries);
-
         kern_pair->glyph_ids_size = format;
         kern_pair->pair_cnt = glyph_entries;
-        kern_pair->glyph_ids = glyph_ids;
-        kern_pair->values = values;
 
-        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
+        void * glyph_ids;
+        lv_fs_res_t res = read_table(reader, ids_size, ids_align, &glyph_ids);
+        kern_pair->glyph_ids = glyph_ids;
+        if(res != LV_FS_RES_OK) {
             return -1;
         }
 
-        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+        void * values;
+        res = read_table(reader, glyph_entries, sizeof(int8_t), &values);
+        kern_pair->values = values;
+        if(res != LV_FS_RES_OK) {
             return -1;
         }
     }
@@ -648,27 +973,35 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         uint8_t kern_table_rows;
         uint8_t kern_table_cols;
 
-        if(lv_fs_read(fp, &kern_class_mapping_length, sizeof(uint16_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_rows, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_cols, sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+        if(reader_read(reader, &kern_class_mapping_length, sizeof(uint16_t)) != LV_FS_RES_OK ||
+           reader_read(reader, &kern_table_rows, sizeof(uint8_t)) != LV_FS_RES_OK ||
+           reader_read(reader, &kern_table_cols, sizeof(uint8_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
         int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
 
-        uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
-        uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
-        int8_t * kern_values = lv_malloc(kern_values_length);
-
-        kern_classes->left_class_mapping  = kern_left;
-        kern_classes->right_class_mapping = kern_right;
         kern_classes->left_class_cnt = kern_table_rows;
         kern_classes->right_class_cnt = kern_table_cols;
-        kern_classes->class_pair_values = kern_values;
 
-        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+        void * kern_left;
+        lv_fs_res_t res = read_table(reader, kern_class_mapping_length, sizeof(uint8_t), &kern_left);
+        kern_classes->left_class_mapping = kern_left;
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        void * kern_right;
+        res = read_table(reader, kern_class_mapping_length, sizeof(uint8_t), &kern_right);
+        kern_classes->right_class_mapping = kern_right;
+        if(res != LV_FS_RES_OK) {
+            return -1;
+        }
+
+        void * kern_values;
+        res = read_table(reader, kern_values_length, sizeof(int8_t), &kern_values);
+        kern_classes->class_pair_values = kern_values;
+        if(res != LV_FS_RES_OK) {
             return -1;
         }
     }
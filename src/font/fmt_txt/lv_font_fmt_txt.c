@@ -10,6 +10,9 @@
 #include "lv_font_fmt_txt_private.h"
 #include "../../core/lv_global.h"
 #include "../../misc/lv_utils.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_entry.h"
+#include "../../misc/cache/class/lv_cache_lru_rb.h"
 
 /*********************
  *      DEFINES
@@ -18,6 +21,49 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_USE_FONT_COMPRESSED && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+    #define USE_GLYPH_CACHE 1
+#else
+    #define USE_GLYPH_CACHE 0
+#endif
+
+/*The glyph id cache is used without locking so every thread needs its own.
+ *Only the OSes whose threads are known to support compiler level thread local storage*/
+#if LV_FONT_FMT_TXT_GID_CACHE_CNT
+    #if LV_USE_OS == LV_OS_NONE
+        #define GID_CACHE_THREAD_LOCAL
+    #elif LV_USE_OS == LV_OS_PTHREAD || LV_USE_OS == LV_OS_WINDOWS
+        #if defined(_MSC_VER)
+            #define GID_CACHE_THREAD_LOCAL __declspec(thread)
+        #elif defined(__GNUC__)
+            #define GID_CACHE_THREAD_LOCAL __thread
+        #endif
+    #endif
+
+    #if (LV_FONT_FMT_TXT_GID_CACHE_CNT & (LV_FONT_FMT_TXT_GID_CACHE_CNT - 1)) != 0
+        #error "LV_FONT_FMT_TXT_GID_CACHE_CNT should be a power of 2"
+    #endif
+#endif
+
+#ifdef GID_CACHE_THREAD_LOCAL
+    #define USE_GID_CACHE 1
+#else
+    #define USE_GID_CACHE 0
+#endif
+
+/*The generation is incremented by the invalidating thread and read by the draw threads.
+ *Other compilers fall back to volatile accesses.*/
+#if USE_GID_CACHE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define GID_CACHE_GENERATION_GET()  __atomic_load_n(&gid_cache_generation, __ATOMIC_ACQUIRE)
+        #define GID_CACHE_GENERATION_INC()  __atomic_add_fetch(&gid_cache_generation, 1, __ATOMIC_RELEASE)
+    #else
+        #define GID_CACHE_GENERATION_GET()  (*(volatile uint32_t *)&gid_cache_generation)
+        #define GID_CACHE_GENERATION_INC()  ((*(volatile uint32_t *)&gid_cache_generation)++)
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -26,15 +72,40 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if USE_GID_CACHE
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font of the entry, NULL: unused*/
+    uint32_t letter;
+    uint32_t gid;                           /**< 0 if the font has no glyph for the letter*/
+} gid_cache_entry_t;
+#endif
+
+#if USE_GLYPH_CACHE
+typedef struct {
+    lv_cache_slot_size_t slot;              /**< The size of the decoded bitmap*/
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    uint8_t * bitmap;                       /**< A8 bitmap with the stride of the draw buffers*/
+} glyph_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
 
+#if USE_GLYPH_CACHE
+    static const void * get_cached_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, lv_draw_buf_t * draw_buf);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * node, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+#endif
+
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
     static inline void decompress_line(uint8_t * out, int32_t w);
@@ -64,6 +135,13 @@ static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
 
 static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 
+#if USE_GID_CACHE
+/*Incremented to invalidate the glyph id caches of all threads*/
+static uint32_t gid_cache_generation;
+static GID_CACHE_THREAD_LOCAL gid_cache_entry_t gid_cache[LV_FONT_FMT_TXT_GID_CACHE_CNT];
+static GID_CACHE_THREAD_LOCAL uint32_t gid_cache_tls_generation;
+#endif
+
 const lv_font_class_t lv_builtin_font_class = {
     .create_cb = builtin_font_create_cb,
     .delete_cb = builtin_font_delete_cb,
@@ -95,15 +173,24 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 
     if(g_dsc->req_raw_bitmap) return &fdsc->glyph_bitmap[gdsc->bitmap_index];
 
+#if USE_GLYPH_CACHE
+    /*Decompressing is slow so keep the decompressed glyphs. Plain bitmaps are simply converted*/
+    if(fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN && glyph_cache) {
+        return get_cached_bitmap(fdsc, gid, draw_buf);
+    }
+#endif
+
+    return lv_font_fmt_txt_decode_bitmap(fdsc, gdsc, &fdsc->glyph_bitmap[gdsc->bitmap_index], g_dsc->stride, draw_buf);
+}
+
+const void * lv_font_fmt_txt_decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                           const uint8_t * bitmap_in, uint32_t stride_in, lv_draw_buf_t * draw_buf)
+{
     uint8_t * bitmap_out = draw_buf->data;
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint32_t stride_in = g_dsc->stride;
-
-
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
         uint8_t * bitmap_out_tmp = bitmap_out;
         int32_t i = 0;
         int32_t x, y;
@@ -201,7 +288,7 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     else {
 #if LV_USE_FONT_COMPRESSED
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
+        decompress(bitmap_in, bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
         lv_draw_buf_flush_cache(draw_buf, NULL);
         return draw_buf;
@@ -272,16 +359,90 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+void lv_font_fmt_txt_cache_init(void)
+{
+#if USE_GLYPH_CACHE
+    glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t),
+                                  LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    });
+    if(glyph_cache) lv_cache_set_name(glyph_cache, "FONT_FMT_TXT_GLYPH");
+#endif
+
+    /*Don't use the glyph ids cached before a previous `lv_deinit()`*/
+    lv_font_fmt_txt_cache_invalidate();
+}
+
+void lv_font_fmt_txt_cache_deinit(void)
+{
+#if USE_GLYPH_CACHE
+    if(glyph_cache) {
+        lv_cache_destroy(glyph_cache, NULL);
+        glyph_cache = NULL;
+    }
+#endif
+}
+
+void lv_font_fmt_txt_cache_invalidate(void)
+{
+#if USE_GLYPH_CACHE
+    if(glyph_cache) lv_cache_drop_all(glyph_cache, NULL);
+#endif
+
+#if USE_GID_CACHE
+    /*The caches of the threads are cleared when they are used next time*/
+    GID_CACHE_GENERATION_INC();
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the glyph id of a letter, from the glyph id cache if possible
+ * @param font      pointer to a fmt_txt font
+ * @param letter    a unicode letter
+ * @return          the glyph id or 0 if the font has no glyph for the letter
+ */
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+
+#if USE_GID_CACHE
+    uint32_t generation = GID_CACHE_GENERATION_GET();
+    if(gid_cache_tls_generation != generation) {
+        lv_memzero(gid_cache, sizeof(gid_cache));
+        gid_cache_tls_generation = generation;
+    }
+
+    /*Consecutive letters of a font go to consecutive entries, the fonts are shifted by their address*/
+    uint32_t idx = (letter + (uint32_t)((lv_uintptr_t)fdsc >> 3)) & (LV_FONT_FMT_TXT_GID_CACHE_CNT - 1);
+    gid_cache_entry_t * entry = &gid_cache[idx];
+    if(entry->fdsc == fdsc && entry->letter == letter) return entry->gid;
+
+    uint32_t gid = find_glyph_dsc_id(fdsc, letter);
+    entry->fdsc = fdsc;
+    entry->letter = letter;
+    entry->gid = gid;
+    return gid;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
 
+/**
+ * Search the glyph id of a letter in the cmaps of a font
+ * @param fdsc      pointer to the descriptor of a fmt_txt font
+ * @param letter    a unicode letter, not 0
+ * @return          the glyph id or 0 if the font has no glyph for the letter
+ */
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -405,6 +566,84 @@ static int kern_pair_16_compare(const void * ref, const void * element)
     else return ref16_p->gid_right - element16_p[1];
 }
 
+#if USE_GLYPH_CACHE
+
+/**
+ * Copy the decompressed bitmap of a glyph from the glyph cache to a draw buffer.
+ * If it's not cached yet decompress it and add it to the cache.
+ * @param fdsc      pointer to the descriptor of a compressed fmt_txt font
+ * @param gid       the glyph id
+ * @param draw_buf  the draw buffer to fill
+ * @return          `draw_buf` or NULL if the glyph has no bitmap
+ */
+static const void * get_cached_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, lv_draw_buf_t * draw_buf)
+{
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+
+    glyph_cache_data_t search_key = {
+        .slot.size = stride * gdsc->box_h,
+        .fdsc = fdsc,
+        .gid = gid,
+    };
+    if(search_key.slot.size == 0) return NULL;
+
+    /*The entries are not kept acquired as the built-in fonts have no `release_glyph`*/
+    lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache, &search_key, NULL);
+    if(entry) {
+        glyph_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+        lv_memcpy(draw_buf->data, cached_data->bitmap, cached_data->slot.size);
+        lv_cache_release(glyph_cache, entry, NULL);
+        lv_draw_buf_flush_cache(draw_buf, NULL);
+        return draw_buf;
+    }
+
+    if(lv_font_fmt_txt_decode_bitmap(fdsc, gdsc, &fdsc->glyph_bitmap[gdsc->bitmap_index], 0, draw_buf) == NULL) {
+        return NULL;
+    }
+
+    /*Another thread might have added it since, then that entry is returned*/
+    entry = lv_cache_acquire_or_create(glyph_cache, &search_key, draw_buf);
+    if(entry) lv_cache_release(glyph_cache, entry, NULL);
+
+    return draw_buf;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * node, void * user_data)
+{
+    lv_draw_buf_t * draw_buf = user_data;
+
+    node->bitmap = lv_malloc(node->slot.size);
+    LV_ASSERT_MALLOC(node->bitmap);
+    if(node->bitmap == NULL) return false;
+
+    lv_memcpy(node->bitmap, draw_buf->data, node->slot.size);
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(node->bitmap);
+    node->bitmap = NULL;
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) {
+        return (lv_uintptr_t)lhs->fdsc > (lv_uintptr_t)rhs->fdsc ? 1 : -1;
+    }
+
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif /*USE_GLYPH_CACHE*/
+
 #if LV_USE_FONT_COMPRESSED
 
 /**
@@ -16,8 +16,6 @@ extern "C" {
 
 #include "../../lvgl_public.h"
 
-#if LV_USE_FONT_COMPRESSED
-
 /*********************
  *      DEFINES
  *********************/
@@ -26,6 +24,8 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_FONT_COMPRESSED
+
 typedef enum {
     RLE_STATE_SINGLE = 0,
     RLE_STATE_REPEATED,
@@ -41,15 +41,39 @@ typedef struct {
     lv_font_fmt_rle_state_t state;
 } lv_font_fmt_rle_t;
 
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Convert the bitmap of a glyph to an A8 draw buffer.
+ * Used by ::lv_font_get_bitmap_fmt_txt and by fonts which load the bitmaps from elsewhere.
+ * @param fdsc          the font descriptor, its `bpp` and `bitmap_format` are used
+ * @param gdsc          the descriptor of the glyph
+ * @param bitmap_in     the bitmap of the glyph as stored in the font
+ * @param stride_in     the stride of `bitmap_in` in bytes, 0: not padded
+ * @param draw_buf      the draw buffer to fill
+ * @return              `draw_buf` or NULL if the glyph has no bitmap
+ */
+const void * lv_font_fmt_txt_decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                           const uint8_t * bitmap_in, uint32_t stride_in, lv_draw_buf_t * draw_buf);
+
+/**
+ * Create the glyph cache of the compressed fmt_txt fonts. Called by `lv_init()`.
+ */
+void lv_font_fmt_txt_cache_init(void);
+
+/**
+ * Destroy the glyph cache of the compressed fmt_txt fonts. Called by `lv_deinit()`.
+ */
+void lv_font_fmt_txt_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
 
-#endif
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
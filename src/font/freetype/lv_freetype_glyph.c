@@ -73,6 +73,7 @@ static bool freetype_glyph_create_cb(lv_freetype_glyph_cache_data_t * data, void
 static void freetype_glyph_free_cb(lv_freetype_glyph_cache_data_t * data, void * user_data);
 static lv_cache_compare_res_t freetype_glyph_compare_cb(const lv_freetype_glyph_cache_data_t * lhs,
                                                         const lv_freetype_glyph_cache_data_t * rhs);
+static uint32_t freetype_glyph_hash_cb(const lv_freetype_glyph_cache_data_t * key);
 
 #if LV_FREETYPE_CACHE_FT_GLYPH_L1
 static inline uint32_t glyph_l1_hash(uint32_t unicode, uint32_t size);
@@ -99,10 +100,12 @@ lv_cache_t * lv_freetype_create_glyph_cache(uint32_t cache_size)
         .create_cb = (lv_cache_create_cb_t)freetype_glyph_create_cb,
         .free_cb = (lv_cache_free_cb_t)freetype_glyph_free_cb,
         .compare_cb = (lv_cache_compare_cb_t)freetype_glyph_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t)freetype_glyph_hash_cb,
     };
 
-    lv_cache_t * glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_glyph_cache_data_t),
-                                               cache_size, ops);
+    lv_cache_t * glyph_cache = lv_cache_create_sharded(&lv_cache_class_lru_rb_count,
+                                                       sizeof(lv_freetype_glyph_cache_data_t),
+                                                       cache_size, ops, LV_CACHE_SHARD_CNT);
     lv_cache_set_name(glyph_cache, CACHE_NAME);
 
     return glyph_cache;
@@ -387,4 +390,9 @@ static lv_cache_compare_res_t freetype_glyph_compare_cb(const lv_freetype_glyph_
     return 0;
 }
 
+static uint32_t freetype_glyph_hash_cb(const lv_freetype_glyph_cache_data_t * key)
+{
+    return key->unicode ^ (key->size << 16);
+}
+
 #endif /*LV_USE_FREETYPE*/
@@ -113,11 +113,13 @@ static bool tiny_ttf_glyph_cache_create_cb(tiny_ttf_glyph_cache_data_t * node, v
 static void tiny_ttf_glyph_cache_free_cb(tiny_ttf_glyph_cache_data_t * node, void * user_data);
 static lv_cache_compare_res_t tiny_ttf_glyph_cache_compare_cb(const tiny_ttf_glyph_cache_data_t * lhs,
                                                               const tiny_ttf_glyph_cache_data_t * rhs);
+static uint32_t tiny_ttf_glyph_cache_hash_cb(const tiny_ttf_glyph_cache_data_t * key);
 
 static bool tiny_ttf_draw_data_cache_create_cb(tiny_ttf_cache_data_t * node, void * user_data);
 static void tiny_ttf_draw_data_cache_free_cb(tiny_ttf_cache_data_t * node, void * user_data);
 static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf_cache_data_t * lhs,
                                                                   const tiny_ttf_cache_data_t * rhs);
+static uint32_t tiny_ttf_draw_data_cache_hash_cb(const tiny_ttf_cache_data_t * key);
 
 static bool tiny_ttf_kerning_cache_create_cb(tiny_ttf_kerning_cache_data_t * node, void * user_data);
 static void tiny_ttf_kerning_cache_free_cb(tiny_ttf_kerning_cache_data_t * node, void * user_data);
@@ -428,20 +430,24 @@ static void ttf_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc)
 {
     /*Init cache*/
-    dsc->glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_glyph_cache_data_t), dsc->cache_size,
+    dsc->glyph_cache = lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_glyph_cache_data_t),
+                                               dsc->cache_size,
     (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t)tiny_ttf_glyph_cache_compare_cb,
         .create_cb = (lv_cache_create_cb_t)tiny_ttf_glyph_cache_create_cb,
-        .free_cb = (lv_cache_free_cb_t)tiny_ttf_glyph_cache_free_cb
-    });
+        .free_cb = (lv_cache_free_cb_t)tiny_ttf_glyph_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)tiny_ttf_glyph_cache_hash_cb,
+    }, LV_CACHE_SHARD_CNT);
     lv_cache_set_name(dsc->glyph_cache, "TINY_TTF_GLYPH");
 
-    dsc->draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_cache_data_t), dsc->cache_size,
+    dsc->draw_data_cache = lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_cache_data_t),
+                                                   dsc->cache_size,
     (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t)tiny_ttf_draw_data_cache_compare_cb,
         .create_cb = (lv_cache_create_cb_t)tiny_ttf_draw_data_cache_create_cb,
         .free_cb = (lv_cache_free_cb_t)tiny_ttf_draw_data_cache_free_cb,
-    });
+        .hash_cb = (lv_cache_hash_cb_t)tiny_ttf_draw_data_cache_hash_cb,
+    }, LV_CACHE_SHARD_CNT);
     lv_cache_set_name(dsc->draw_data_cache, "TINY_TTF_DRAW_DATA");
 
     dsc->kerning_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_kerning_cache_data_t),
@@ -602,6 +608,11 @@ static lv_cache_compare_res_t tiny_ttf_glyph_cache_compare_cb(const tiny_ttf_gly
     return 0;
 }
 
+static uint32_t tiny_ttf_glyph_cache_hash_cb(const tiny_ttf_glyph_cache_data_t * key)
+{
+    return key->unicode;
+}
+
 static bool tiny_ttf_draw_data_cache_create_cb(tiny_ttf_cache_data_t * node, void * user_data)
 {
     int g1 = (int)node->glyph_index;
@@ -656,6 +667,11 @@ static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf
     return 0;
 }
 
+static uint32_t tiny_ttf_draw_data_cache_hash_cb(const tiny_ttf_cache_data_t * key)
+{
+    return key->glyph_index ^ (key->size << 16);
+}
+
 static bool tiny_ttf_kerning_cache_create_cb(tiny_ttf_kerning_cache_data_t * node, void * user_data)
 {
     tiny_ttf_kerning_cache_create_data_t * create_data = (tiny_ttf_kerning_cache_create_data_t *)user_data;
@@ -337,6 +337,38 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+const void * lv_fs_map(lv_fs_file_t * file_p, uint32_t * size)
+{
+    *size = 0;
+    if(file_p->drv == NULL) return NULL;
+
+    /*Files in a memory buffer are already mapped*/
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
+        *size = file_p->cache->end;
+        return file_p->cache->buffer;
+    }
+
+    if(file_p->drv->map_cb == NULL) return NULL;
+
+    LV_PROFILER_FS_BEGIN;
+    const void * buf = file_p->drv->map_cb(file_p->drv, file_p->file_d, size);
+    LV_PROFILER_FS_END;
+
+    if(buf == NULL) *size = 0;
+    return buf;
+}
+
+void lv_fs_unmap(lv_fs_file_t * file_p, const void * buf, uint32_t size)
+{
+    if(buf == NULL || file_p->drv == NULL) return;
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) return;
+    if(file_p->drv->unmap_cb == NULL) return;
+
+    LV_PROFILER_FS_BEGIN;
+    file_p->drv->unmap_cb(file_p->drv, file_p->file_d, buf, size);
+    LV_PROFILER_FS_END;
+}
+
 lv_fs_res_t lv_fs_get_size(lv_fs_file_t * file_p, uint32_t * size_res)
 {
     uint32_t original_pos;
@@ -18,6 +18,14 @@
 #include <unistd.h>
 #include <errno.h>
 
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define FS_POSIX_USE_MMAP 1
+#else
+    #define FS_POSIX_USE_MMAP 0
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -45,6 +53,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#if FS_POSIX_USE_MMAP
+    static const void * fs_map(lv_fs_drv_t * drv, void * file_p, uint32_t * size);
+    static void fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -84,6 +96,10 @@ void lv_fs_posix_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+#if FS_POSIX_USE_MMAP
+    fs_drv_p->map_cb = fs_map;
+    fs_drv_p->unmap_cb = fs_unmap;
+#endif
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -254,6 +270,52 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+#if FS_POSIX_USE_MMAP
+
+/**
+ * Map the content of an opened file to the memory
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param size      pointer to store the size of the file
+ * @return          pointer to the read only content or NULL on error
+ */
+static const void * fs_map(lv_fs_drv_t * drv, void * file_p, uint32_t * size)
+{
+    LV_UNUSED(drv);
+
+    int fd = FILEP2FD(file_p);
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) {
+        return NULL;
+    }
+
+    void * buf = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(buf == MAP_FAILED) {
+        LV_LOG_WARN("Could not map file: %d, errno: %d", fd, errno);
+        return NULL;
+    }
+
+    *size = (uint32_t)st.st_size;
+    return buf;
+}
+
+/**
+ * Unmap the content of a file mapped by `fs_map`
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param buf       the mapped content
+ * @param size      size of the mapped content
+ */
+static void fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+
+    munmap((void *)buf, size);
+}
+
+#endif /*FS_POSIX_USE_MMAP*/
+
 /**
  * Initialize a 'fs_read_dir_t' variable for directory reading
  * @param drv   pointer to a driver where this function belongs
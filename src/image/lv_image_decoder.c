@@ -50,6 +50,14 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
+/**
+ * Round the requested downscale factor down to 2, 4 or 8
+ * @param src       the image source
+ * @param downscale the `downscale` field of the decoder args
+ * @return          2, 4, 8 or 0 if the image shouldn't or can't be downscaled
+ */
+static uint8_t downscale_normalize(const void * src, uint8_t downscale);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -119,21 +127,42 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
+    /*Make a copy of args*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+        .flush_cache = false,
+        .use_get_area = false,
+        .downscale = 0,
+    };
+
+    /*The downscaled images are cached separately so decide it before checking the cache*/
+    if(dsc->args.downscale) {
+        dsc->args.downscale = downscale_normalize(src, dsc->args.downscale);
+    }
+
+    bool use_cache = lv_image_cache_is_enabled() && !dsc->args.no_cache;
+    if(lv_image_cache_is_enabled()) dsc->cache = img_cache_p;
+
+    /*
+     * Check the cache first
+     * If the image is found in the cache, just return it.
+     * The cache has its own lock so the cached images are not blocked by an
+     * other image being decoded, e.g. by the background decoder threads.*/
+    if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_OK;
+    }
+
     lv_mutex_lock(img_decoder_open_lock_p);
 
-    if(lv_image_cache_is_enabled()) {
-        dsc->cache = img_cache_p;
-        /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
-            /*
-            * Check the cache first
-            * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) {
-                lv_mutex_unlock(img_decoder_open_lock_p);
-                LV_PROFILER_DECODER_END;
-                return LV_RESULT_OK;
-            }
-        }
+    /*The same image might have been decoded while waiting for the lock*/
+    if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+        lv_mutex_unlock(img_decoder_open_lock_p);
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_OK;
     }
 
     /*Find the decoder that can open the image source, and get the header info in the same time.*/
@@ -144,15 +173,6 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
         return LV_RESULT_INVALID;
     }
 
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-        .flush_cache = false,
-    };
-
     /*
      * We assume that if a decoder can get the info, it can open the image.
      * If decoder open failed, free the source and return error.
@@ -206,7 +226,9 @@ void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc)
         return;
     }
 
-    lv_mutex_lock(img_decoder_open_lock_p);
+    /*Sessions served from the cache have nothing to free but the cache entry
+     *so they don't need to wait for an other image being decoded*/
+    if(!dsc->from_cache) lv_mutex_lock(img_decoder_open_lock_p);
 
     if(dsc->decoder->close_cb) {
         LV_PROFILER_DECODER_BEGIN_TAG(dsc->decoder->name);
@@ -219,7 +241,7 @@ void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc)
         lv_cache_release(dsc->cache, dsc->cache_entry, NULL);
     }
 
-    lv_mutex_unlock(img_decoder_open_lock_p);
+    if(!dsc->from_cache) lv_mutex_unlock(img_decoder_open_lock_p);
     LV_PROFILER_DECODER_END;
 }
 
@@ -278,6 +300,7 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  const lv_draw_buf_t * decoded, void * user_data)
 {
     LV_PROFILER_DECODER_BEGIN;
+    search_key->src_hash = lv_image_cache_src_hash(search_key->src, search_key->src_type);
     lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, search_key, NULL);
     if(cache_entry == NULL) {
         LV_PROFILER_DECODER_END;
@@ -290,7 +313,7 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
     /*Set the cache entry to decoder data*/
     cached_data->decoded = decoded;
     if(cached_data->src_type == LV_IMAGE_SRC_FILE) {
-        cached_data->src = lv_strdup(cached_data->src);
+        cached_data->src = lv_str_intern_hashed(cached_data->src, cached_data->src_hash);
     }
     cached_data->user_data = user_data; /*Need to free data on cache invalidate instead of decoder_close*/
     cached_data->decoder = decoder;
@@ -381,11 +404,13 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
     lv_image_decoder_t * decoder;
     bool is_header_cache_enabled = lv_image_header_cache_is_enabled();
+    uint32_t src_hash = is_header_cache_enabled ? lv_image_cache_src_hash(src, src_type) : 0;
 
     if(is_header_cache_enabled && src_type == LV_IMAGE_SRC_FILE) {
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
         search_key.src = src;
+        search_key.src_hash = src_hash;
 
         lv_cache_entry_t * entry = lv_cache_acquire(img_header_cache_p, &search_key, NULL);
 
@@ -415,6 +440,7 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         /*Info and Open callbacks are required*/
         if(decoder->info_cb && decoder->open_cb) {
             lv_fs_seek(&dsc->file, 0, LV_FS_SEEK_SET);
+            lv_memzero(header, sizeof(lv_image_header_t)); /*Don't leave random flags for the decoders*/
             LV_PROFILER_DECODER_BEGIN_TAG(decoder->name);
             lv_result_t res = decoder->info_cb(decoder, dsc, header);
             LV_PROFILER_DECODER_END_TAG(decoder->name);
@@ -443,13 +469,14 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
         lv_cache_entry_t * entry;
         lv_image_header_cache_data_t search_key;
         search_key.src_type = src_type;
-        search_key.src = lv_strdup(src);
+        search_key.src_hash = src_hash;
+        search_key.src = lv_str_intern_hashed(src, src_hash);
         search_key.decoder = decoder;
         search_key.header = *header;
         entry = lv_cache_add(img_header_cache_p, &search_key, NULL);
 
         if(entry == NULL) {
-            if(src_type == LV_IMAGE_SRC_FILE) lv_free((void *)search_key.src);
+            if(src_type == LV_IMAGE_SRC_FILE) lv_str_intern_release(search_key.src);
             LV_PROFILER_DECODER_END;
             return NULL;
         }
@@ -479,6 +506,8 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.src_hash = lv_image_cache_src_hash(dsc->src, dsc->src_type);
+    search_key.downscale = dsc->args.downscale;
 
     lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
 
@@ -487,6 +516,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
         dsc->decoded = cached_data->decoded;
         dsc->decoder = (lv_image_decoder_t *)cached_data->decoder;
         dsc->cache_entry = entry;     /*Save the cache to release it in decoder_close*/
+        dsc->from_cache = true;
         LV_PROFILER_DECODER_END;
         return LV_RESULT_OK;
     }
@@ -494,3 +524,16 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     LV_PROFILER_DECODER_END;
     return LV_RESULT_INVALID;
 }
+
+static uint8_t downscale_normalize(const void * src, uint8_t downscale)
+{
+    if(downscale < 2) return 0;
+
+    lv_image_header_t header;
+    if(lv_image_decoder_get_info(src, &header) != LV_RESULT_OK) return 0;
+    if(!(header.flags & LV_IMAGE_FLAGS_DOWNSCALABLE)) return 0;
+
+    if(downscale >= 8) return 8;
+    if(downscale >= 4) return 4;
+    return 2;
+}
@@ -0,0 +1,397 @@
+/**
+ * @file lv_image_decoder_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_image_decoder_async_private.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#if LV_USE_OS == LV_OS_NONE
+    #error "LV_USE_IMAGE_DECODER_ASYNC requires an OS (LV_USE_OS)"
+#endif
+
+#include "lv_image_decoder_private.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_str_intern_private.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/instance/lv_image_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define async_ctx (&LV_GLOBAL_DEFAULT()->img_decoder_async)
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+/*Low enough to be called about once per frame*/
+#define READY_TIMER_PERIOD  10
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    JOB_STATE_QUEUED,
+    JOB_STATE_RUNNING,
+    JOB_STATE_DONE,
+} job_state_t;
+
+typedef struct {
+    lv_image_decoder_async_ready_cb_t ready_cb;
+    void * user_data;
+} job_waiter_t;
+
+typedef struct {
+    const void * src;           /**< Interned if it's a file path*/
+    lv_image_src_t src_type;
+    job_state_t state;
+    lv_result_t res;
+    lv_array_t waiters;         /**< `job_waiter_t`s. Used only in the LVGL thread*/
+} job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void decoder_thread_cb(void * ptr);
+static void ready_timer_cb(lv_timer_t * t);
+static bool is_cached(const void * src, lv_image_src_t src_type);
+static job_t * job_find(const void * src, lv_image_src_t src_type);
+static job_t * job_add(const void * src, lv_image_src_t src_type);
+static void job_free(job_t * job);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_decoder_async_init(void)
+{
+    lv_image_decoder_async_t * ctx = async_ctx;
+    lv_memzero(ctx, sizeof(lv_image_decoder_async_t));
+
+    lv_ll_init(&ctx->job_ll, sizeof(job_t));
+    lv_mutex_init(&ctx->lock);
+    lv_thread_sync_init(&ctx->sync);
+
+    ctx->ready_timer = lv_timer_create(ready_timer_cb, READY_TIMER_PERIOD, NULL);
+    lv_timer_pause(ctx->ready_timer);
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_init(&ctx->threads[i], "imgdec", LV_THREAD_PRIO_LOW, decoder_thread_cb,
+                       LV_IMAGE_DECODER_ASYNC_STACK_SIZE, ctx);
+    }
+}
+
+void lv_image_decoder_async_deinit(void)
+{
+    lv_image_decoder_async_t * ctx = async_ctx;
+
+    lv_mutex_lock(&ctx->lock);
+    ctx->exit_status = true;
+    lv_mutex_unlock(&ctx->lock);
+
+    /*The exiting threads wake up each other*/
+    lv_thread_sync_signal(&ctx->sync);
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_delete(&ctx->threads[i]);
+    }
+
+    job_t * job = lv_ll_get_head(&ctx->job_ll);
+    while(job) {
+        job_t * job_next = lv_ll_get_next(&ctx->job_ll, job);
+        lv_ll_remove(&ctx->job_ll, job);
+        job_free(job);
+        job = job_next;
+    }
+
+    lv_timer_delete(ctx->ready_timer);
+    lv_thread_sync_delete(&ctx->sync);
+    lv_mutex_delete(&ctx->lock);
+}
+
+lv_result_t lv_image_decoder_prefetch(const void * src)
+{
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+    if(!lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    if(is_cached(src, src_type)) return LV_RESULT_OK;
+
+    lv_image_decoder_async_t * ctx = async_ctx;
+    lv_mutex_lock(&ctx->lock);
+    job_t * job = job_find(src, src_type);
+    lv_mutex_unlock(&ctx->lock);
+    if(job) return LV_RESULT_OK;
+
+    job = job_add(src, src_type);
+    return job ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+bool lv_image_decoder_async_request(const void * src, lv_image_decoder_async_ready_cb_t ready_cb, void * user_data)
+{
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return true;
+
+    /*Without cache the decoded image would be freed right after the decoding*/
+    if(!lv_image_cache_is_enabled()) return true;
+
+    /*Check the jobs first so that all the requesters of an image get it at the same time*/
+    lv_image_decoder_async_t * ctx = async_ctx;
+    lv_mutex_lock(&ctx->lock);
+    job_t * job = job_find(src, src_type);
+    lv_mutex_unlock(&ctx->lock);
+
+    if(job == NULL) {
+        if(is_cached(src, src_type)) return true;
+
+        job = job_add(src, src_type);
+        /*Fall back to drawing it directly*/
+        if(job == NULL) return true;
+    }
+
+    /*The waiters are used only in the LVGL thread so no need to lock*/
+    uint32_t i;
+    uint32_t waiter_cnt = lv_array_size(&job->waiters);
+    for(i = 0; i < waiter_cnt; i++) {
+        job_waiter_t * w = lv_array_at(&job->waiters, i);
+        if(w->ready_cb == ready_cb && w->user_data == user_data) return false;
+    }
+
+    job_waiter_t waiter = {ready_cb, user_data};
+    if(lv_array_push_back(&job->waiters, &waiter) != LV_RESULT_OK) return true;
+
+    return false;
+}
+
+void lv_image_decoder_async_cancel(lv_image_decoder_async_ready_cb_t ready_cb, void * user_data)
+{
+    lv_image_decoder_async_t * ctx = async_ctx;
+    job_t * job;
+    /*Only the LVGL thread adds and removes jobs so the list can be read without lock*/
+    LV_LL_READ(&ctx->job_ll, job) {
+        uint32_t i = 0;
+        while(i < lv_array_size(&job->waiters)) {
+            job_waiter_t * w = lv_array_at(&job->waiters, i);
+            if(w->ready_cb == ready_cb && w->user_data == user_data) {
+                lv_array_remove(&job->waiters, i);
+            }
+            else {
+                i++;
+            }
+        }
+    }
+}
+
+uint32_t lv_image_decoder_async_get_pending_count(void)
+{
+    return lv_ll_get_len(&async_ctx->job_ll);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Take the oldest queued job, decode its image into the image cache and mark the job as done.
+ * @param ptr   pointer to the `lv_image_decoder_async_t` context
+ */
+static void decoder_thread_cb(void * ptr)
+{
+    lv_image_decoder_async_t * ctx = ptr;
+
+    while(1) {
+        lv_mutex_lock(&ctx->lock);
+        bool exit_status = ctx->exit_status;
+        job_t * job = NULL;
+        bool more_queued = false;
+        if(!exit_status) {
+            job_t * j;
+            LV_LL_READ(&ctx->job_ll, j) {
+                if(j->state != JOB_STATE_QUEUED) continue;
+                if(job == NULL) {
+                    job = j;
+                    job->state = JOB_STATE_RUNNING;
+                }
+                else {
+                    more_queued = true;
+                    break;
+                }
+            }
+        }
+        lv_mutex_unlock(&ctx->lock);
+
+        if(exit_status) {
+            /*Wake up the next thread to exit too*/
+            lv_thread_sync_signal(&ctx->sync);
+            break;
+        }
+
+        if(job == NULL) {
+            lv_thread_sync_wait(&ctx->sync);
+            continue;
+        }
+
+        /*The signals of several jobs might be merged so let an other thread take the next one*/
+        if(more_queued) lv_thread_sync_signal(&ctx->sync);
+
+        /*The decoder puts the image into the cache and it stays there after closing*/
+        lv_image_decoder_dsc_t decoder_dsc;
+        lv_result_t res = lv_image_decoder_open(&decoder_dsc, job->src, NULL);
+        if(res == LV_RESULT_OK) {
+            if(decoder_dsc.cache_entry == NULL) {
+                LV_LOG_INFO("the decoder of %p didn't cache the image, it will be decoded again when drawn", job->src);
+            }
+            lv_image_decoder_close(&decoder_dsc);
+        }
+
+        lv_mutex_lock(&ctx->lock);
+        job->res = res;
+        job->state = JOB_STATE_DONE;
+        lv_mutex_unlock(&ctx->lock);
+    }
+
+    LV_LOG_INFO("exit image decoder thread");
+}
+
+/**
+ * Remove the finished jobs and call their `ready_cb`s in the LVGL thread
+ * @param t     pointer to the timer
+ */
+static void ready_timer_cb(lv_timer_t * t)
+{
+    lv_image_decoder_async_t * ctx = async_ctx;
+
+    while(1) {
+        lv_mutex_lock(&ctx->lock);
+        job_t * job;
+        LV_LL_READ(&ctx->job_ll, job) {
+            if(job->state == JOB_STATE_DONE) break;
+        }
+        if(job) lv_ll_remove(&ctx->job_ll, job);
+        lv_mutex_unlock(&ctx->lock);
+
+        if(job == NULL) break;
+
+        /*The callbacks can request other images and the jobs can't be freed while being used*/
+        uint32_t i;
+        for(i = 0; i < lv_array_size(&job->waiters); i++) {
+            job_waiter_t * w = lv_array_at(&job->waiters, i);
+            w->ready_cb(job->src, job->res, w->user_data);
+        }
+
+        job_free(job);
+    }
+
+    if(lv_ll_is_empty(&ctx->job_ll)) lv_timer_pause(t);
+}
+
+/**
+ * Check if an image is in the image cache without keeping it acquired
+ * @param src       the image source
+ * @param src_type  the type of `src`
+ * @return          true: the image is cached
+ */
+static bool is_cached(const void * src, lv_image_src_t src_type)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = src_type;
+    search_key.src = src;
+    search_key.src_hash = lv_image_cache_src_hash(src, src_type);
+    search_key.downscale = 0;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+/**
+ * Find the job of an image source. Call it with the lock taken.
+ * @param src       the image source
+ * @param src_type  the type of `src`
+ * @return          the job or NULL if not found
+ */
+static job_t * job_find(const void * src, lv_image_src_t src_type)
+{
+    job_t * job;
+    LV_LL_READ(&async_ctx->job_ll, job) {
+        if(job->src_type != src_type) continue;
+        if(src_type == LV_IMAGE_SRC_FILE) {
+            if(lv_strcmp(job->src, src) == 0) return job;
+        }
+        else if(job->src == src) {
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Queue a new job and wake up a decoder thread
+ * @param src       the image source
+ * @param src_type  the type of `src`
+ * @return          the new job or NULL on error
+ */
+static job_t * job_add(const void * src, lv_image_src_t src_type)
+{
+    lv_image_decoder_async_t * ctx = async_ctx;
+
+    /*The path might be freed before the job is done*/
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        src = lv_str_intern(src);
+        LV_ASSERT_MALLOC(src);
+        if(src == NULL) return NULL;
+    }
+
+    lv_mutex_lock(&ctx->lock);
+    job_t * job = lv_ll_ins_tail(&ctx->job_ll);
+    if(job) {
+        lv_memzero(job, sizeof(job_t));
+        job->src = src;
+        job->src_type = src_type;
+        job->state = JOB_STATE_QUEUED;
+        lv_array_init(&job->waiters, 1, sizeof(job_waiter_t));
+    }
+    lv_mutex_unlock(&ctx->lock);
+
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) {
+        if(src_type == LV_IMAGE_SRC_FILE) lv_str_intern_release(src);
+        return NULL;
+    }
+
+    lv_timer_resume(ctx->ready_timer);
+    lv_thread_sync_signal(&ctx->sync);
+
+    return job;
+}
+
+/**
+ * Free a job which is already removed from the job list
+ * @param job   pointer to the job
+ */
+static void job_free(job_t * job)
+{
+    if(job->src_type == LV_IMAGE_SRC_FILE) lv_str_intern_release(job->src);
+    lv_array_deinit(&job->waiters);
+    lv_free(job);
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -0,0 +1,65 @@
+/**
+ * @file lv_image_decoder_async_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+#define LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** State of the background image decoders*/
+struct _lv_image_decoder_async_t {
+    lv_thread_t threads[LV_IMAGE_DECODER_ASYNC_THREAD_CNT];
+    lv_thread_sync_t sync;      /**< Signaled when a job is queued or the threads should exit*/
+    lv_mutex_t lock;            /**< Protects `job_ll` and the state of the jobs*/
+    lv_ll_t job_ll;             /**< `lv_image_decoder_async_job_t`s in the order of the requests*/
+    lv_timer_t * ready_timer;   /**< Calls the `ready_cb`s of the finished jobs in the LVGL thread*/
+    bool exit_status;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start the background image decoder threads
+ */
+void lv_image_decoder_async_init(void);
+
+/**
+ * Stop the background image decoder threads and drop the pending jobs
+ */
+void lv_image_decoder_async_deinit(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_PRIVATE_H*/
@@ -39,6 +39,11 @@ struct _lv_image_decoder_args_t {
     bool no_cache;          /**< When set, decoded image won't be put to cache, and decoder open will also ignore cache. */
     bool use_indexed;       /**< Decoded indexed image as is. Convert to ARGB8888 if false. */
     bool flush_cache;       /**< Whether to flush the data cache after decoding */
+    bool use_get_area;      /**< If the image isn't cached let the decoder leave `decoded` NULL
+                             *   and decode only the drawn area in bands via `get_area_cb` */
+    uint8_t downscale;      /**< Decode the image at 1/2, 1/4 or 1/8 of its size (2, 4 or 8) as it will be drawn
+                             *   smaller anyway. The size is rounded up. 0: original size.
+                             *   Ignored if the image has no `LV_IMAGE_FLAGS_DOWNSCALABLE` flag.*/
 };
 
 struct _lv_image_decoder_t {
@@ -59,6 +64,8 @@ struct _lv_image_cache_data_t {
 
     const void * src;
     lv_image_src_t src_type;
+    uint32_t src_hash;          /**< `lv_image_cache_src_hash(src, src_type)`, compared before the source*/
+    uint8_t downscale;          /**< `lv_image_decoder_args_t::downscale` of the decoded image*/
 
     const lv_draw_buf_t * decoded;
     const lv_image_decoder_t * decoder;
@@ -68,6 +75,7 @@ struct _lv_image_cache_data_t {
 struct _lv_image_header_cache_data_t {
     const void * src;
     lv_image_src_t src_type;
+    uint32_t src_hash;          /**< `lv_image_cache_src_hash(src, src_type)`, compared before the source*/
 
     lv_image_header_t header;
     lv_image_decoder_t * decoder;
@@ -112,6 +120,9 @@ struct _lv_image_decoder_dsc_t {
     /**Point to cache entry information*/
     lv_cache_entry_t * cache_entry;
 
+    /**The image was found in the cache by `lv_image_decoder_open`, it wasn't decoded in this session*/
+    bool from_cache;
+
     /**Store any custom data here is required*/
     void * user_data;
 };
@@ -32,6 +32,7 @@
 #define ORIENTATION_TAG 0x112 /* Exif tag for orientation */
 #define APP1_MARKER JPEG_APP0 + 1  /* APP1 Marker code https://www.media.mit.edu/pia/Research/deepview/exif.html */
 #define MARKER_DATA_LIMIT 0xFFFF /* APP1 Marker limit */
+#define BAND_HEIGHT 16 /* Number of lines decoded at once by `decoder_get_area` */
 
 /**********************
  *      TYPEDEFS
@@ -68,14 +69,30 @@ typedef struct error_mgr_s {
     jmp_buf jb;
 } error_mgr_t;
 
+/* State of decoding the image in bands by `decoder_get_area` */
+typedef struct area_decoder_s {
+    struct jpeg_decompress_struct cinfo;
+    error_mgr_t jerr;
+    uint8_t * data;
+    uint32_t data_size;
+    uint8_t downscale;
+    lv_draw_buf_t * band;   /* The last decoded lines of the area */
+} area_decoder_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static void convert_size_with_orientation(image_orientation_t image_orientation, uint32_t * width, uint32_t * height);
-static lv_draw_buf_t * decode_jpeg_file(const char * filename);
+static lv_draw_buf_t * decode_jpeg_file(const char * filename, uint8_t downscale);
+static void jpeg_set_output_params(struct jpeg_decompress_struct * cinfo, uint8_t downscale);
+static area_decoder_t * area_decoder_create(const char * filename, uint8_t downscale);
+static void area_decoder_restart(area_decoder_t * ad);
+static void area_decoder_delete(area_decoder_t * ad);
 static bool get_jpeg_head_info(const char * filename, uint32_t * width, uint32_t * height);
 static bool get_jpeg_size(uint8_t * data, uint32_t data_size, uint32_t * width, uint32_t * height);
 static image_orientation_t get_jpeg_direction(uint8_t * data, uint32_t data_size);
@@ -112,6 +129,7 @@ void lv_libjpeg_turbo_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
@@ -176,6 +194,7 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         header->cf = LV_COLOR_FORMAT_RGB888;
         header->w = width;
         header->h = height;
+        header->flags |= LV_IMAGE_FLAGS_DOWNSCALABLE;   /*libjpeg can scale by 1/2, 1/4 and 1/8 while decoding*/
 
         return LV_RESULT_OK;
     }
@@ -196,7 +215,23 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     /*If it's a JPEG file...*/
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
-        lv_draw_buf_t * decoded = decode_jpeg_file(fn);
+
+        /*If the image won't be cached it's enough to decode only the drawn area*/
+        if(dsc->args.use_get_area && (dsc->args.no_cache || !lv_image_cache_is_enabled())) {
+            area_decoder_t * ad = area_decoder_create(fn, dsc->args.downscale);
+            if(ad) {
+                dsc->user_data = ad;
+                dsc->header.w = ad->cinfo.output_width;
+                dsc->header.h = ad->cinfo.output_height;
+                dsc->header.cf = ad->cinfo.out_color_space == JCS_CMYK ? LV_COLOR_FORMAT_XRGB8888 : LV_COLOR_FORMAT_RGB888;
+                dsc->header.stride = lv_draw_buf_width_to_stride(dsc->header.w, dsc->header.cf);
+                return LV_RESULT_OK;
+            }
+
+            /*E.g. rotated by the Exif orientation. Decode the whole image*/
+        }
+
+        lv_draw_buf_t * decoded = decode_jpeg_file(fn, dsc->args.downscale);
         if(decoded == NULL) {
             LV_LOG_WARN("decode jpeg file failed");
             return LV_RESULT_INVALID;
@@ -213,6 +248,7 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_image_cache_data_t search_key;
         search_key.src_type = dsc->src_type;
         search_key.src = dsc->src;
+        search_key.downscale = dsc->args.downscale;
         search_key.slot.size = decoded->data_size;
 
         lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(decoder, &search_key, decoded, NULL);
@@ -228,6 +264,77 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     return LV_RESULT_INVALID;    /*If not returned earlier then it failed*/
 }
 
+/**
+ * Decode the next few lines of an area of the image
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area of the image to decode
+ * @param decoded_area  the lines decoded in the previous call. Start with `y1 = LV_COORD_MIN`.
+ * @return LV_RESULT_OK: `decoded_area` is decoded to `dsc->decoded`; LV_RESULT_INVALID: ready or error
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder); /*Unused*/
+
+    area_decoder_t * ad = dsc->user_data;
+    if(ad == NULL) return LV_RESULT_INVALID;
+
+    struct jpeg_decompress_struct * cinfo = &ad->cinfo;
+
+    if(setjmp(ad->jerr.jb)) {
+        LV_LOG_WARN("decoding error");
+        return LV_RESULT_INVALID;
+    }
+
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        area_decoder_restart(ad);
+        jpeg_start_decompress(cinfo);
+
+        /* Decode only the columns of the area, rounded to iMCU boundaries by libjpeg */
+        JDIMENSION x = LV_MAX(full_area->x1, 0);
+        JDIMENSION w = LV_MIN(full_area->x2 + 1, (int32_t)cinfo->output_width) - x;
+        jpeg_crop_scanline(cinfo, &x, &w);
+        if(full_area->y1 > 0) jpeg_skip_scanlines(cinfo, full_area->y1);
+
+        lv_color_format_t cf = cinfo->out_color_space == JCS_CMYK ? LV_COLOR_FORMAT_XRGB8888 : LV_COLOR_FORMAT_RGB888;
+        if(ad->band && ad->band->header.w != cinfo->output_width) {
+            lv_draw_buf_destroy(ad->band);
+            ad->band = NULL;
+        }
+        if(ad->band == NULL) {
+            ad->band = lv_draw_buf_create(cinfo->output_width, BAND_HEIGHT, cf, LV_STRIDE_AUTO);
+            if(ad->band == NULL) return LV_RESULT_INVALID;
+        }
+
+        decoded_area->x1 = x;
+        decoded_area->x2 = x + cinfo->output_width - 1;
+    }
+
+    if(cinfo->output_scanline > (JDIMENSION)full_area->y2 || cinfo->output_scanline >= cinfo->output_height) {
+        return LV_RESULT_INVALID;
+    }
+
+    lv_draw_buf_t * band = ad->band;
+    uint32_t line_cnt = LV_MIN(BAND_HEIGHT, full_area->y2 + 1 - (int32_t)cinfo->output_scanline);
+    decoded_area->y1 = cinfo->output_scanline;
+
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        JSAMPROW row = band->data + i * band->header.stride;
+        jpeg_read_scanlines(cinfo, &row, 1);
+        if(cinfo->out_color_space == JCS_CMYK) {
+            jpeg_cmyk_to_bgrx(row, band->header.w);
+        }
+    }
+
+    decoded_area->y2 = decoded_area->y1 + line_cnt - 1;
+    band->header.h = line_cnt;
+    dsc->decoded = band;
+
+    return LV_RESULT_OK;
+}
+
 /**
  * Free the allocated resources
  */
@@ -235,6 +342,11 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->user_data) {
+        area_decoder_delete(dsc->user_data);
+        return;
+    }
+
     if(dsc->args.no_cache ||
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
 }
@@ -252,7 +364,7 @@ static void convert_size_with_orientation(image_orientation_t image_orientation,
     *height = tmp;
 }
 
-static lv_draw_buf_t * decode_jpeg_file(const char * filename)
+static lv_draw_buf_t * decode_jpeg_file(const char * filename, uint8_t downscale)
 {
     /* This struct contains the JPEG decompression parameters and pointers to
      * working space (which is allocated as needed by the JPEG library).
@@ -323,16 +435,7 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
      */
 
     /* set parameters for decompression */
-    if(cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK) {
-        cinfo.out_color_space = JCS_CMYK;
-    }
-    else {
-        cinfo.out_color_space = JCS_EXT_BGR;
-    }
-
-    /* In this example, we don't need to change any of the defaults set by
-     * jpeg_read_header(), so we do nothing here.
-     */
+    jpeg_set_output_params(&cinfo, downscale);
 
     /* Start decompressor */
     jpeg_start_decompress(&cinfo);
@@ -418,6 +521,82 @@ static lv_draw_buf_t * decode_jpeg_file(const char * filename)
     return decoded;
 }
 
+static void jpeg_set_output_params(struct jpeg_decompress_struct * cinfo, uint8_t downscale)
+{
+    if(cinfo->jpeg_color_space == JCS_CMYK || cinfo->jpeg_color_space == JCS_YCCK) {
+        cinfo->out_color_space = JCS_CMYK;
+    }
+    else {
+        cinfo->out_color_space = JCS_EXT_BGR;
+    }
+
+    /* The IDCT is done at lower resolution so it's faster too, not only smaller */
+    cinfo->scale_num = 1;
+    cinfo->scale_denom = downscale ? downscale : 1;
+}
+
+static area_decoder_t * area_decoder_create(const char * filename, uint8_t downscale)
+{
+    uint32_t data_size;
+    uint8_t * data = lv_fs_load_with_alloc(filename, &data_size);
+    if(data == NULL) {
+        LV_LOG_WARN("can't load file %s", filename);
+        return NULL;
+    }
+
+    /* The lines of a rotated image are not the lines of the JPEG */
+    image_orientation_t image_orientation = get_jpeg_direction(data, data_size);
+    if(image_orientation != IMAGE_CLOCKWISE_NONE && image_orientation != IMAGE_CLOCKWISE_0) {
+        lv_free(data);
+        return NULL;
+    }
+
+    area_decoder_t * ad = lv_malloc_zeroed(sizeof(area_decoder_t));
+    if(ad == NULL) {
+        lv_free(data);
+        return NULL;
+    }
+
+    ad->data = data;
+    ad->data_size = data_size;
+    ad->downscale = downscale;
+    ad->cinfo.err = jpeg_std_error(&ad->jerr.pub);
+    ad->jerr.pub.error_exit = error_exit;
+    jpeg_create_decompress(&ad->cinfo);
+
+    if(setjmp(ad->jerr.jb)) {
+        LV_LOG_WARN("read jpeg header failed");
+        area_decoder_delete(ad);
+        return NULL;
+    }
+
+    /* Read the header to know the size of the output */
+    area_decoder_restart(ad);
+
+    return ad;
+}
+
+/* The caller should handle the errors with `setjmp` */
+static void area_decoder_restart(area_decoder_t * ad)
+{
+    struct jpeg_decompress_struct * cinfo = &ad->cinfo;
+
+    /* Go back to the beginning of the data in any state */
+    jpeg_abort_decompress(cinfo);
+    jpeg_mem_src(cinfo, ad->data, ad->data_size);
+    jpeg_read_header(cinfo, TRUE);
+    jpeg_set_output_params(cinfo, ad->downscale);
+    jpeg_calc_output_dimensions(cinfo);
+}
+
+static void area_decoder_delete(area_decoder_t * ad)
+{
+    jpeg_destroy_decompress(&ad->cinfo);
+    if(ad->band) lv_draw_buf_destroy(ad->band);
+    lv_free(ad->data);
+    lv_free(ad);
+}
+
 static bool get_jpeg_head_info(const char * filename, uint32_t * width, uint32_t * height)
 {
     uint8_t * data = NULL;
@@ -24,17 +24,52 @@
 
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
+#define BAND_HEIGHT     16  /*Number of lines decoded at once by `decoder_get_area`*/
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Read a non-interlaced PNG line by line to decode it
+ * downscaled or only some of its lines with little memory
+ */
+typedef struct {
+    png_structp png;
+    png_infop info;
+    const uint8_t * png_data;
+    uint32_t png_data_size;
+    uint32_t png_data_pos;
+    bool png_data_allocated;
+
+    uint32_t src_w;         /**< Size of the PNG*/
+    uint32_t src_h;
+    uint32_t w;             /**< Size of the output*/
+    uint32_t h;
+    uint32_t downscale;     /**< Each output pixel is the average of `downscale` x `downscale` pixels*/
+    uint32_t next_line;     /**< Index of the next output line*/
+
+    uint8_t * row;          /**< A line of the PNG in BGRA format*/
+    uint32_t * sum;         /**< Sum of the alpha weighted colors of the output pixels*/
+    lv_draw_buf_t * band;   /**< The last decoded lines for `decoder_get_area`*/
+} line_decoder_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * src, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static lv_draw_buf_t * decode_png(lv_image_decoder_dsc_t * dsc);
+static lv_draw_buf_t * decode_png_downscaled(lv_image_decoder_dsc_t * dsc);
+static line_decoder_t * line_decoder_create(lv_image_decoder_dsc_t * dsc, uint32_t downscale);
+static bool line_decoder_restart(line_decoder_t * ld);
+static void line_decoder_read_line(line_decoder_t * ld, uint8_t * buf, uint32_t x1, uint32_t x2);
+static void line_decoder_delete(line_decoder_t * ld);
+static void png_read_data_cb(png_structp png, png_bytep data, size_t length);
+static void png_warning_cb(png_structp png, png_const_charp message);
 
 /**********************
  *  STATIC VARIABLES
@@ -56,6 +91,7 @@ void lv_libpng_init(void)
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
@@ -90,14 +126,16 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
 
     if(src_type == LV_IMAGE_SRC_FILE || src_type == LV_IMAGE_SRC_VARIABLE) {
         uint32_t * size;
+        const uint8_t * interlace;
         static const uint8_t magic[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
-        uint8_t buf[24];
+        uint8_t buf[29];
 
         /*If it's a PNG file...*/
         if(src_type == LV_IMAGE_SRC_FILE) {
             /* Read the width and height from the file. They have a constant location:
             * [16..19]: width
             * [20..23]: height
+            * [28]: interlace method
             */
             uint32_t rn;
             lv_fs_read(&dsc->file, buf, sizeof(buf), &rn);
@@ -107,14 +145,16 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
             if(lv_memcmp(buf, magic, sizeof(magic)) != 0) return LV_RESULT_INVALID;
 
             size = (uint32_t *)&buf[16];
+            interlace = &buf[28];
         }
         /*If it's a PNG file in a  C array...*/
         else {
             const lv_image_dsc_t * img_dsc = dsc->src;
             const uint32_t data_size = img_dsc->data_size;
             size = ((uint32_t *)img_dsc->data) + 4;
+            interlace = &img_dsc->data[28];
 
-            if(data_size < sizeof(magic)) return LV_RESULT_INVALID;
+            if(data_size < sizeof(buf)) return LV_RESULT_INVALID;
             if(lv_memcmp(img_dsc->data, magic, sizeof(magic)) != 0) return LV_RESULT_INVALID;
         }
 
@@ -124,6 +164,9 @@ static lv_result_t decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_d
         header->w = (int32_t)((size[0] & 0xff000000) >> 24) + ((size[0] & 0x00ff0000) >> 8);
         header->h = (int32_t)((size[1] & 0xff000000) >> 24) + ((size[1] & 0x00ff0000) >> 8);
 
+        /*The lines of the interlaced images are complete only at the end*/
+        if(*interlace == 0) header->flags |= LV_IMAGE_FLAGS_DOWNSCALABLE;
+
         return LV_RESULT_OK;
     }
 
@@ -140,8 +183,24 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    /*If the image won't be cached it's enough to decode only the drawn area*/
+    if(dsc->args.use_get_area && (dsc->args.no_cache || !lv_image_cache_is_enabled())) {
+        line_decoder_t * ld = line_decoder_create(dsc, dsc->args.downscale);
+        if(ld) {
+            dsc->user_data = ld;
+            dsc->header.w = ld->w;
+            dsc->header.h = ld->h;
+            dsc->header.cf = LV_COLOR_FORMAT_ARGB8888;
+            dsc->header.stride = lv_draw_buf_width_to_stride(ld->w, LV_COLOR_FORMAT_ARGB8888);
+            return LV_RESULT_OK;
+        }
+
+        /*E.g. interlaced. Decode the whole image*/
+    }
+
     lv_draw_buf_t * decoded;
-    decoded = decode_png(dsc);
+    if(dsc->args.downscale) decoded = decode_png_downscaled(dsc);
+    else decoded = decode_png(dsc);
 
     if(decoded == NULL) {
         return LV_RESULT_INVALID;
@@ -174,6 +233,7 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.downscale = dsc->args.downscale;
     search_key.slot.size = decoded->data_size;
 
     lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(decoder, &search_key, decoded, NULL);
@@ -187,6 +247,68 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     return LV_RESULT_OK;     /*The image is fully decoded. Return with its pointer*/
 }
 
+/**
+ * Decode the next few lines of an area of the image
+ * @param decoder       pointer to the decoder
+ * @param dsc           pointer to the decoder descriptor
+ * @param full_area     the area of the image to decode
+ * @param decoded_area  the lines decoded in the previous call. Start with `y1 = LV_COORD_MIN`.
+ * @return LV_RESULT_OK: `decoded_area` is decoded to `dsc->decoded`; LV_RESULT_INVALID: ready or error
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder); /*Unused*/
+
+    line_decoder_t * ld = dsc->user_data;
+    if(ld == NULL) return LV_RESULT_INVALID;
+
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        if(!line_decoder_restart(ld)) return LV_RESULT_INVALID;
+
+        decoded_area->x1 = LV_MAX(full_area->x1, 0);
+        decoded_area->x2 = LV_MIN(full_area->x2, (int32_t)ld->w - 1);
+
+        uint32_t w = lv_area_get_width(decoded_area);
+        if(ld->band && ld->band->header.w != w) {
+            lv_draw_buf_destroy(ld->band);
+            ld->band = NULL;
+        }
+        if(ld->band == NULL) {
+            ld->band = lv_draw_buf_create(w, BAND_HEIGHT, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+            if(ld->band == NULL) return LV_RESULT_INVALID;
+        }
+    }
+
+    if(setjmp(png_jmpbuf(ld->png))) {
+        LV_LOG_WARN("png decode failed");
+        return LV_RESULT_INVALID;
+    }
+
+    /*The lines above the area are decoded too but not stored*/
+    while(ld->next_line < (uint32_t)full_area->y1 && ld->next_line < ld->h) {
+        line_decoder_read_line(ld, NULL, 0, 0);
+    }
+
+    if(ld->next_line > (uint32_t)full_area->y2 || ld->next_line >= ld->h) return LV_RESULT_INVALID;
+
+    lv_draw_buf_t * band = ld->band;
+    uint32_t line_cnt = LV_MIN(BAND_HEIGHT, full_area->y2 + 1 - (int32_t)ld->next_line);
+    line_cnt = LV_MIN(line_cnt, ld->h - ld->next_line);
+    decoded_area->y1 = ld->next_line;
+    decoded_area->y2 = decoded_area->y1 + line_cnt - 1;
+
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        line_decoder_read_line(ld, band->data + i * band->header.stride, decoded_area->x1, decoded_area->x2);
+    }
+
+    band->header.h = line_cnt;
+    dsc->decoded = band;
+
+    return LV_RESULT_OK;
+}
+
 /**
  * Free the allocated resources
  */
@@ -194,6 +316,11 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->user_data) {
+        line_decoder_delete(dsc->user_data);
+        return;
+    }
+
     if(dsc->args.no_cache ||
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
 }
@@ -292,4 +419,225 @@ static lv_draw_buf_t * decode_png(lv_image_decoder_dsc_t * dsc)
     return decoded;
 }
 
+/**
+ * Decode the whole image at 1/`downscale` size
+ * @param dsc   pointer to the decoder descriptor
+ * @return      the decoded image or NULL on error
+ */
+static lv_draw_buf_t * decode_png_downscaled(lv_image_decoder_dsc_t * dsc)
+{
+    LV_PROFILER_DECODER_BEGIN;
+    line_decoder_t * ld = line_decoder_create(dsc, dsc->args.downscale);
+    if(ld == NULL) {
+        LV_PROFILER_DECODER_END;
+        return NULL;
+    }
+
+    lv_draw_buf_t * decoded;
+    decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, ld->w, ld->h, LV_COLOR_FORMAT_ARGB8888,
+                                    LV_STRIDE_AUTO);
+    if(decoded == NULL) {
+        LV_LOG_ERROR("alloc %" LV_PRIu32 "x%" LV_PRIu32 " image failed", ld->w, ld->h);
+        line_decoder_delete(ld);
+        LV_PROFILER_DECODER_END;
+        return NULL;
+    }
+
+    if(setjmp(png_jmpbuf(ld->png))) {
+        LV_LOG_ERROR("png decode failed");
+        lv_draw_buf_destroy(decoded);
+        line_decoder_delete(ld);
+        LV_PROFILER_DECODER_END;
+        return NULL;
+    }
+
+    uint32_t y;
+    for(y = 0; y < ld->h; y++) {
+        line_decoder_read_line(ld, decoded->data + y * decoded->header.stride, 0, ld->w - 1);
+    }
+
+    line_decoder_delete(ld);
+    LV_PROFILER_DECODER_END;
+    return decoded;
+}
+
+/**
+ * Load the PNG data and prepare reading its lines
+ * @param dsc       pointer to the decoder descriptor
+ * @param downscale 0, 2, 4 or 8
+ * @return          the line decoder or NULL if the image is interlaced or on error
+ */
+static line_decoder_t * line_decoder_create(lv_image_decoder_dsc_t * dsc, uint32_t downscale)
+{
+    line_decoder_t * ld = lv_malloc_zeroed(sizeof(line_decoder_t));
+    if(ld == NULL) return NULL;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        ld->png_data = lv_fs_load_with_alloc((const char *)dsc->src, &ld->png_data_size);
+        ld->png_data_allocated = true;
+        if(ld->png_data == NULL) {
+            LV_LOG_WARN("can't load file: %s", (const char *)dsc->src);
+            lv_free(ld);
+            return NULL;
+        }
+    }
+    else {
+        const lv_image_dsc_t * img_dsc = dsc->src;
+        ld->png_data = img_dsc->data;
+        ld->png_data_size = img_dsc->data_size;
+    }
+
+    ld->downscale = downscale ? downscale : 1;
+
+    if(!line_decoder_restart(ld)) {
+        line_decoder_delete(ld);
+        return NULL;
+    }
+
+    if(png_get_interlace_type(ld->png, ld->info) != PNG_INTERLACE_NONE) {
+        line_decoder_delete(ld);
+        return NULL;
+    }
+
+    ld->src_w = png_get_image_width(ld->png, ld->info);
+    ld->src_h = png_get_image_height(ld->png, ld->info);
+    ld->w = (ld->src_w + ld->downscale - 1) / ld->downscale;
+    ld->h = (ld->src_h + ld->downscale - 1) / ld->downscale;
+
+    ld->row = lv_malloc(png_get_rowbytes(ld->png, ld->info));
+    if(ld->downscale > 1) ld->sum = lv_malloc(ld->w * 4 * sizeof(uint32_t));
+    if(ld->row == NULL || (ld->downscale > 1 && ld->sum == NULL)) {
+        line_decoder_delete(ld);
+        return NULL;
+    }
+
+    return ld;
+}
+
+/**
+ * Start reading the PNG from its first line
+ * @param ld    pointer to the line decoder
+ * @return      true: ready to read the lines; false: error
+ */
+static bool line_decoder_restart(line_decoder_t * ld)
+{
+    if(ld->png) png_destroy_read_struct(&ld->png, &ld->info, NULL);
+
+    ld->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, png_warning_cb);
+    if(ld->png == NULL) return false;
+
+    ld->info = png_create_info_struct(ld->png);
+    if(ld->info == NULL) return false;
+
+    if(setjmp(png_jmpbuf(ld->png))) {
+        LV_LOG_WARN("png read header failed");
+        return false;
+    }
+
+    ld->png_data_pos = 0;
+    ld->next_line = 0;
+    png_set_read_fn(ld->png, ld, png_read_data_cb);
+    png_read_info(ld->png, ld->info);
+
+    /*Convert everything to BGRA8888 like `png_image_finish_read` does*/
+    png_set_expand(ld->png);
+    png_set_strip_16(ld->png);
+    png_set_gray_to_rgb(ld->png);
+    png_set_bgr(ld->png);
+    png_set_add_alpha(ld->png, 0xff, PNG_FILLER_AFTER);
+    png_set_gamma(ld->png, PNG_DEFAULT_sRGB, PNG_DEFAULT_sRGB);
+    png_read_update_info(ld->png, ld->info);
+
+    return true;
+}
+
+/**
+ * Decode the next output line. The caller should handle the errors with `setjmp`.
+ * When downscaled, the colors are weighted by their alpha so that
+ * the color of the transparent pixels doesn't bleed into the visible ones.
+ * @param ld    pointer to the line decoder
+ * @param buf   store the `x1`..`x2` pixels of the line here in ARGB8888 format. NULL to skip the line.
+ * @param x1    the first pixel to store
+ * @param x2    the last pixel to store
+ */
+static void line_decoder_read_line(line_decoder_t * ld, uint8_t * buf, uint32_t x1, uint32_t x2)
+{
+    uint32_t d = ld->downscale;
+    uint32_t src_y = ld->next_line * d;
+    uint32_t src_line_cnt = LV_MIN(d, ld->src_h - src_y);
+    ld->next_line++;
+
+    if(d == 1) {
+        png_read_row(ld->png, ld->row, NULL);
+        if(buf) lv_memcpy(buf, ld->row + x1 * 4, (x2 - x1 + 1) * 4);
+        return;
+    }
+
+    if(buf) lv_memzero(ld->sum, ld->w * 4 * sizeof(uint32_t));
+
+    uint32_t i;
+    uint32_t x;
+    for(i = 0; i < src_line_cnt; i++) {
+        png_read_row(ld->png, ld->row, NULL);
+        if(buf == NULL) continue;
+
+        const uint8_t * src = ld->row + x1 * d * 4;
+        uint32_t src_x_end = LV_MIN((x2 + 1) * d, ld->src_w);
+        for(x = x1 * d; x < src_x_end; x++) {
+            uint32_t * sum = &ld->sum[(x / d) * 4];
+            uint32_t a = src[3];
+            sum[0] += src[0] * a;
+            sum[1] += src[1] * a;
+            sum[2] += src[2] * a;
+            sum[3] += a;
+            src += 4;
+        }
+    }
+
+    if(buf == NULL) return;
+
+    for(x = x1; x <= x2; x++) {
+        const uint32_t * sum = &ld->sum[x * 4];
+        uint32_t px_cnt = src_line_cnt * LV_MIN(d, ld->src_w - x * d);
+        uint32_t a_sum = sum[3];
+        if(a_sum) {
+            buf[0] = (sum[0] + a_sum / 2) / a_sum;
+            buf[1] = (sum[1] + a_sum / 2) / a_sum;
+            buf[2] = (sum[2] + a_sum / 2) / a_sum;
+        }
+        else {
+            buf[0] = buf[1] = buf[2] = 0;
+        }
+        buf[3] = (a_sum + px_cnt / 2) / px_cnt;
+        buf += 4;
+    }
+}
+
+static void line_decoder_delete(line_decoder_t * ld)
+{
+    if(ld->png) png_destroy_read_struct(&ld->png, &ld->info, NULL);
+    if(ld->png_data_allocated) lv_free((void *)ld->png_data);
+    if(ld->band) lv_draw_buf_destroy(ld->band);
+    lv_free(ld->row);
+    lv_free(ld->sum);
+    lv_free(ld);
+}
+
+static void png_read_data_cb(png_structp png, png_bytep data, size_t length)
+{
+    line_decoder_t * ld = png_get_io_ptr(png);
+    if(length > ld->png_data_size - ld->png_data_pos) {
+        png_error(png, "read after the end of the data");
+    }
+
+    lv_memcpy(data, ld->png_data + ld->png_data_pos, length);
+    ld->png_data_pos += length;
+}
+
+static void png_warning_cb(png_structp png, png_const_charp message)
+{
+    LV_UNUSED(png);
+    LV_LOG_INFO("%s", message);
+}
+
 #endif /*LV_USE_LIBPNG*/
@@ -16,6 +16,7 @@
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_hit_index_private.h"
 
 #include "../misc/lv_timer_private.h"
 
@@ -69,6 +70,7 @@ static void indev_proc_release(lv_indev_t * indev);
 static lv_result_t indev_proc_short_click(lv_indev_t * indev);
 static void indev_proc_pointer_diff(lv_indev_t * indev);
 static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p);
+static lv_obj_t * search_children(lv_obj_t * obj, const lv_area_t * obj_coords, lv_point_t * point);
 static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(lv_indev_t * indev);
 static void indev_gesture(lv_indev_t * indev);
@@ -626,15 +628,9 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
     }
     if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
-        int32_t i;
-        uint32_t child_cnt = lv_obj_get_child_count(obj);
-
         /*If a child matches use it*/
-        for(i = child_cnt - 1; i >= 0; i--) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            found_p = lv_indev_search_obj(child, &p_trans);
-            if(found_p) return found_p;
-        }
+        found_p = search_children(obj, &obj_coords, &p_trans);
+        if(found_p) return found_p;
     }
 
     /*If not return earlier for a clicked child and this obj's hittest was ok use it
@@ -1670,6 +1666,42 @@ static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p)
     return indev_obj_act;
 }
 
+/**
+ * Search the topmost child of an object (or its children) on a point.
+ * With many children only the ones in the hit index's cell of the point are checked.
+ * @param obj           the parent object
+ * @param obj_coords    the area of `obj` where its children can be hit
+ * @param point         the point in the coordinate system of the children
+ * @return              the found object or NULL
+ */
+static lv_obj_t * search_children(lv_obj_t * obj, const lv_area_t * obj_coords, lv_point_t * point)
+{
+    lv_obj_t * found_p;
+    int32_t i;
+
+#if LV_USE_OBJ_HIT_INDEX
+    lv_obj_hit_index_iter_t iter;
+    if(lv_obj_hit_index_iter_init(obj, obj_coords, point, &iter)) {
+        while((i = lv_obj_hit_index_iter_next(&iter)) >= 0) {
+            found_p = lv_indev_search_obj(obj->spec_attr->children[i], point);
+            if(found_p) return found_p;
+        }
+        return NULL;
+    }
+#else
+    LV_UNUSED(obj_coords);
+#endif
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = child_cnt - 1; i >= 0; i--) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        found_p = lv_indev_search_obj(child, point);
+        if(found_p) return found_p;
+    }
+
+    return NULL;
+}
+
 /**
  * Process a new point from LV_INDEV_TYPE_BUTTON input device
  * @param i pointer to an input device
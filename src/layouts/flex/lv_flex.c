@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 
 #if LV_USE_FLEX
 
@@ -561,6 +562,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item->coords.y1 += diff_y;
             item->coords.y2 += diff_y;
             lv_obj_invalidate(item);
+            lv_obj_hit_index_invalidate(cont);
             lv_obj_move_children_by(item, diff_x, diff_y, false);
         }
 
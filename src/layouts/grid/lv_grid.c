@@ -12,6 +12,7 @@
 #if LV_USE_GRID
 
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 #include "../../core/lv_global.h"
 
 /*********************
@@ -647,6 +648,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
         item->coords.y1 += diff_y;
         item->coords.y2 += diff_y;
         lv_obj_invalidate(item);
+        lv_obj_hit_index_invalidate(item->parent);
         lv_obj_move_children_by(item, diff_x, diff_y, false);
     }
 }
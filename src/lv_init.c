@@ -123,11 +123,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -171,6 +166,10 @@ void lv_init(void)
 
     lv_mem_init();
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_init();
+#endif
+
     lv_draw_buf_init_handlers();
 
 #if LV_USE_SPAN != 0
@@ -265,6 +264,8 @@ void lv_init(void)
     lv_sysmon_builtin_init();
 #endif
 
+    lv_str_intern_init();
+    lv_font_fmt_txt_cache_init();
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
@@ -382,6 +383,11 @@ void lv_init(void)
     lv_svg_decoder_init();
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*After the decoders as the threads can start decoding right away*/
+    lv_image_decoder_async_init();
+#endif
+
 #if LV_USE_TRANSLATION
     lv_translation_init();
 #endif
@@ -435,7 +441,13 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_deinit();
+#endif
+
     lv_image_decoder_deinit();
+    lv_str_intern_deinit();
+    lv_font_fmt_txt_cache_deinit();
 
     lv_refr_deinit();
 
@@ -500,6 +512,10 @@ void lv_deinit(void)
 
     lv_fs_deinit();
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_deinit();
+#endif
+
     lv_mem_deinit();
 
     lv_initialized = false;
@@ -17,6 +17,7 @@
 #include "core/lv_obj_class_private.h"
 #include "core/lv_obj_draw_private.h"
 #include "core/lv_obj_event_private.h"
+#include "core/lv_obj_hit_index_private.h"
 #include "core/lv_obj_private.h"
 #include "core/lv_obj_scroll_private.h"
 #include "core/lv_obj_style_private.h"
@@ -130,6 +131,7 @@
 #include "font/lv_font_private.h"
 #include "fs/lv_fs_private.h"
 #include "image/lv_image_decoder_private.h"
+#include "image/lv_image_decoder_async_private.h"
 #include "indev/lv_indev_gesture_private.h"
 #include "indev/lv_indev_private.h"
 #include "indev/lv_indev_scroll.h"
@@ -156,6 +158,7 @@
 #include "misc/cache/lv_cache_entry_private.h"
 #include "misc/lv_anim_private.h"
 #include "misc/lv_anim_timeline_private.h"
+#include "misc/lv_anim_batch_private.h"
 #include "misc/lv_area_private.h"
 #include "misc/lv_bidi_private.h"
 #include "misc/lv_circle_buf_private.h"
@@ -164,6 +167,7 @@
 #include "misc/lv_lru.h"
 #include "misc/lv_pending.h"
 #include "misc/lv_rb_private.h"
+#include "misc/lv_str_intern_private.h"
 #include "misc/lv_text_ap.h"
 #include "misc/lv_text_private.h"
 #include "misc/lv_timer_private.h"
@@ -207,6 +211,7 @@
 #include "widgets/label/lv_label_private.h"
 #include "widgets/led/lv_led_private.h"
 #include "widgets/line/lv_line_private.h"
+#include "widgets/list/lv_list_private.h"
 #include "widgets/lottie/lv_lottie_private.h"
 #include "widgets/menu/lv_menu_private.h"
 #include "widgets/msgbox/lv_msgbox_private.h"
@@ -34,6 +34,7 @@
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -59,12 +60,13 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    img_cache_p = lv_cache_create_sharded(&lv_cache_class_lru_rb_size,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
-    });
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
+    }, LV_CACHE_SHARD_CNT);
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
     return img_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
@@ -95,8 +97,46 @@ void lv_image_cache_drop(const void * src)
         .src = src,
         .src_type = lv_image_src_get_type(src),
     };
+    search_key.src_hash = lv_image_cache_src_hash(search_key.src, search_key.src_type);
+
+    /*Drop the downscaled versions too*/
+    static const uint8_t downscales[] = {0, 2, 4, 8};
+    uint32_t i;
+    for(i = 0; i < sizeof(downscales); i++) {
+        search_key.downscale = downscales[i];
+        lv_cache_drop(img_cache_p, &search_key, NULL);
+    }
+}
+
+bool lv_image_cache_contains(const void * src, uint8_t downscale)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return false;
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+        .downscale = downscale,
+    };
+    search_key.src_hash = lv_image_cache_src_hash(search_key.src, search_key.src_type);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+uint32_t lv_image_cache_src_hash(const void * src, lv_image_src_t src_type)
+{
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        return lv_str_hash(src);
+    }
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        return (uint32_t)(lv_uintptr_t)src;
+    }
 
-    lv_cache_drop(img_cache_p, &search_key, NULL);
+    /*The other types are compared only by their type*/
+    return (uint32_t)src_type;
 }
 
 bool lv_image_cache_is_enabled(void)
@@ -125,10 +165,19 @@ void lv_image_cache_dump(void)
  **********************/
 
 inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs_src, lv_image_src_t lhs_src_type,
-                                                                const void * rhs_src, lv_image_src_t rhs_src_type)
+                                                                uint32_t lhs_src_hash,
+                                                                const void * rhs_src, lv_image_src_t rhs_src_type,
+                                                                uint32_t rhs_src_hash)
 {
     if(lhs_src_type == rhs_src_type) {
         if(lhs_src_type == LV_IMAGE_SRC_FILE) {
+            /*Order the file names by their hash and compare the strings only if the hashes are the same*/
+            if(lhs_src_hash != rhs_src_hash) {
+                return lhs_src_hash > rhs_src_hash ? 1 : -1;
+            }
+            if(lhs_src == rhs_src) {
+                return 0;
+            }
             int32_t cmp_res = lv_strcmp(lhs_src, rhs_src);
             if(cmp_res != 0) {
                 return cmp_res > 0 ? 1 : -1;
@@ -148,7 +197,18 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    lv_cache_compare_res_t res = image_cache_common_compare(lhs->src, lhs->src_type, lhs->src_hash,
+                                                            rhs->src, rhs->src_type, rhs->src_hash);
+    if(res != 0) return res;
+
+    /*The downscaled versions of the same source are different entries*/
+    if(lhs->downscale != rhs->downscale) return lhs->downscale > rhs->downscale ? 1 : -1;
+    return 0;
+}
+
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key)
+{
+    return key->src_hash;
 }
 
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
@@ -162,7 +222,7 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
     }
 
     /*Free the duplicated file name*/
-    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_str_intern_release(entry->src);
 }
 
 static void iter_inspect_cb(void * elem)
@@ -51,6 +51,23 @@ void lv_image_cache_resize(uint32_t new_size, bool evict_now);
  */
 void lv_image_cache_drop(const void * src);
 
+/**
+ * Check if an image source is decoded in the image cache
+ * @param src       pointer to an image source
+ * @param downscale the downscale factor it's decoded with, 0 if it's not downscaled
+ * @return          true: the decoded image is in the cache
+ */
+bool lv_image_cache_contains(const void * src, uint8_t downscale);
+
+/**
+ * Get the hash of an image source which is stored in the keys of the image and image header caches.
+ * File names are hashed by their content, other sources by their address.
+ * @param src       pointer to an image source
+ * @param src_type  type of the image source
+ * @return          the hash of the image source
+ */
+uint32_t lv_image_cache_src_hash(const void * src, lv_image_src_t src_type);
+
 /**
  * Return true if the image cache is enabled.
  * @return true: enabled, false: disabled.
@@ -32,6 +32,7 @@
 
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * key);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -57,12 +58,13 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    img_header_cache_p = lv_cache_create_sharded(&lv_cache_class_lru_rb_count,
     sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
         .create_cb = NULL,
-        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
-    });
+        .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
+    }, LV_CACHE_SHARD_CNT);
 
     lv_cache_set_name(img_header_cache_p, CACHE_NAME);
     return img_header_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
@@ -87,6 +89,7 @@ void lv_image_header_cache_drop(const void * src)
         .src = src,
         .src_type = lv_image_src_get_type(src),
     };
+    search_key.src_hash = lv_image_cache_src_hash(search_key.src, search_key.src_type);
 
     lv_cache_drop(img_header_cache_p, &search_key, NULL);
 }
@@ -117,10 +120,19 @@ void lv_image_header_cache_dump(void)
  **********************/
 
 inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs_src, lv_image_src_t lhs_src_type,
-                                                                const void * rhs_src, lv_image_src_t rhs_src_type)
+                                                                uint32_t lhs_src_hash,
+                                                                const void * rhs_src, lv_image_src_t rhs_src_type,
+                                                                uint32_t rhs_src_hash)
 {
     if(lhs_src_type == rhs_src_type) {
         if(lhs_src_type == LV_IMAGE_SRC_FILE) {
+            /*Order the file names by their hash and compare the strings only if the hashes are the same*/
+            if(lhs_src_hash != rhs_src_hash) {
+                return lhs_src_hash > rhs_src_hash ? 1 : -1;
+            }
+            if(lhs_src == rhs_src) {
+                return 0;
+            }
             int32_t cmp_res = lv_strcmp(lhs_src, rhs_src);
             if(cmp_res != 0) {
                 return cmp_res > 0 ? 1 : -1;
@@ -140,14 +152,19 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    return image_cache_common_compare(lhs->src, lhs->src_type, lhs->src_hash, rhs->src, rhs->src_type, rhs->src_hash);
+}
+
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * key)
+{
+    return key->src_hash;
 }
 
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data); /*Unused*/
 
-    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_str_intern_release(entry->src);
 }
 
 static void iter_inspect_cb(void * elem)
@@ -17,12 +17,21 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t shard_idx;
+    lv_iter_t * shard_iter;     /**< Iterator of the current shard, NULL if not created yet*/
+} shard_iter_ctx_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static inline lv_cache_t * shard_get(const lv_cache_t * cache, const void * key);
+static uint32_t shard_share(const lv_cache_t * cache, size_t total, uint32_t idx);
+static lv_result_t shard_iter_next_cb(void * instance, void * context, void * elem);
+static void shard_iter_destroy_cb(void * context);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -52,6 +61,8 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->shards = NULL;
+    cache->shard_cnt = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -64,10 +75,64 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     return cache;
 }
 
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt)
+{
+    if(shard_cnt <= 1) {
+        return lv_cache_create(cache_class, node_size, max_size, ops);
+    }
+
+    if(ops.hash_cb == NULL) {
+        LV_LOG_WARN("No hash_cb is set, creating a cache without shards");
+        return lv_cache_create(cache_class, node_size, max_size, ops);
+    }
+
+    lv_cache_t * cache = lv_malloc_zeroed(sizeof(lv_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) {
+        return NULL;
+    }
+
+    cache->shards = lv_malloc_zeroed(shard_cnt * sizeof(lv_cache_t *));
+    LV_ASSERT_MALLOC(cache->shards);
+    if(cache->shards == NULL) {
+        lv_free(cache);
+        return NULL;
+    }
+
+    /*The sharded cache only dispatches to the shards, it has no entries and lock of its own*/
+    cache->clz = cache_class;
+    cache->node_size = node_size;
+    cache->max_size = max_size;
+    cache->ops = ops;
+    cache->shard_cnt = shard_cnt;
+
+    for(uint32_t i = 0; i < shard_cnt; i++) {
+        cache->shards[i] = lv_cache_create(cache_class, node_size, shard_share(cache, max_size, i), ops);
+        if(cache->shards[i] == NULL) {
+            LV_LOG_ERROR("Cache shard %" LV_PRIu32 " init failed", i);
+            lv_cache_destroy(cache, NULL);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
 void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]) lv_cache_destroy(cache->shards[i], user_data);
+        }
+        lv_free(cache->shards);
+        lv_free(cache);
+        return;
+    }
+
     lv_mutex_lock(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
     lv_mutex_unlock(&cache->lock);
@@ -80,6 +145,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        return lv_cache_acquire(shard_get(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -104,6 +173,11 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 {
     LV_ASSERT_NULL(entry);
 
+    if(cache->shards) {
+        /*The entry knows its shard, no need to hash the key again*/
+        cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -122,6 +196,10 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        return lv_cache_add(shard_get(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -146,6 +224,10 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        return lv_cache_acquire_or_create(shard_get(cache, key), key, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -195,12 +277,25 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        /*Any shard can get the entry the space is reserved for, so reserve the full size in each.
+         *A shard can't hold more than its max size, so that means evicting everything from it.*/
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_t * shard = cache->shards[i];
+            lv_cache_reserve(shard, (uint32_t)LV_MIN(reserved_size, shard->max_size), user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
+    lv_mutex_lock(&cache->lock);
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
         reserve_cond_res == LV_CACHE_RESERVE_COND_NEED_VICTIM;
         reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data))
-        cache_evict_one_internal_no_lock(cache, user_data);
+        if(cache_evict_one_internal_no_lock(cache, user_data) == false)
+            break;
+    lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
 }
@@ -209,6 +304,11 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        lv_cache_drop(shard_get(cache, key), key, user_data);
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -221,6 +321,24 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        /*Evict from the fullest shard*/
+        lv_cache_t * victim_shard = NULL;
+        size_t victim_size = 0;
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_t * shard = cache->shards[i];
+            lv_mutex_lock(&shard->lock);
+            size_t size = shard->size;
+            lv_mutex_unlock(&shard->lock);
+
+            if(victim_shard == NULL || size > victim_size) {
+                victim_shard = shard;
+                victim_size = size;
+            }
+        }
+        return lv_cache_evict_one(victim_shard, user_data);
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -234,6 +352,13 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_drop_all(cache->shards[i], user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -245,8 +370,10 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 
 void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->max_size = max_size;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_max_size(cache->shards[i], shard_share(cache, max_size, i), user_data);
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -255,12 +382,26 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 }
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
+    if(cache->shards) {
+        size_t size = 0;
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            size += lv_cache_get_size(cache->shards[i], user_data);
+        }
+        return size;
+    }
+
     return cache->size;
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
+    if(cache->shards) {
+        size_t free_size = 0;
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            free_size += lv_cache_get_free_size(cache->shards[i], user_data);
+        }
+        return free_size;
+    }
+
     return cache->max_size - cache->size;
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
@@ -269,23 +410,32 @@ bool lv_cache_is_enabled(lv_cache_t * cache)
 }
 void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_compare_cb(cache->shards[i], compare_cb, user_data);
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_create_cb(cache->shards[i], alloc_cb, user_data);
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
-    LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_free_cb(cache->shards[i], free_cb, user_data);
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
     if(cache == NULL) return;
     cache->name = name;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_name(cache->shards[i], name);
+    }
 }
 const char * lv_cache_get_name(lv_cache_t * cache)
 {
@@ -296,6 +446,14 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
     if(cache == NULL || cache->clz->iter_create_cb == NULL) return NULL;
+
+    if(cache->shards) {
+        lv_iter_t * iter = lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(shard_iter_ctx_t),
+                                          shard_iter_next_cb);
+        if(iter) lv_iter_set_context_destroy_cb(iter, shard_iter_destroy_cb);
+        return iter;
+    }
+
     return cache->clz->iter_create_cb(cache);
 }
 
@@ -353,3 +511,66 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+/**
+ * Get the shard storing a key
+ * @param cache     a sharded cache
+ * @param key       the key to look for
+ * @return          one of the shards
+ */
+static inline lv_cache_t * shard_get(const lv_cache_t * cache, const void * key)
+{
+    /*Spread the hash with a multiplicative step (keys are often aligned pointers or small integers),
+     *then map its high bits to [0, shard_cnt)*/
+    uint32_t hash = cache->ops.hash_cb(key) * 0x9E3779B1U;
+    return cache->shards[((uint64_t)hash * cache->shard_cnt) >> 32];
+}
+
+/**
+ * Get the part of a size or count which belongs to a shard
+ * @param cache     a sharded cache
+ * @param total     the size or count of the whole cache
+ * @param idx       index of the shard
+ * @return          `total / shard_cnt`, but at least 1 if `total` is not 0
+ */
+static uint32_t shard_share(const lv_cache_t * cache, size_t total, uint32_t idx)
+{
+    if(total == 0) return 0;
+
+    size_t share = total / cache->shard_cnt;
+    if(idx < total % cache->shard_cnt) share++;
+
+    return share > 0 ? (uint32_t)share : 1;
+}
+
+static lv_result_t shard_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_t * cache = instance;
+    shard_iter_ctx_t * ctx = context;
+
+    /*Walk the shards one after the other, the iterator of the current one is kept in the context
+     *and destroyed by `shard_iter_destroy_cb` if the iteration is stopped early*/
+    while(ctx->shard_idx < cache->shard_cnt) {
+        if(ctx->shard_iter == NULL) {
+            ctx->shard_iter = lv_cache_iter_create(cache->shards[ctx->shard_idx]);
+            if(ctx->shard_iter == NULL) return LV_RESULT_INVALID;
+        }
+
+        if(lv_iter_next(ctx->shard_iter, elem) == LV_RESULT_OK) return LV_RESULT_OK;
+
+        lv_iter_destroy(ctx->shard_iter);
+        ctx->shard_iter = NULL;
+        ctx->shard_idx++;
+    }
+
+    return LV_RESULT_INVALID;
+}
+
+static void shard_iter_destroy_cb(void * context)
+{
+    shard_iter_ctx_t * ctx = context;
+    if(ctx->shard_iter) {
+        lv_iter_destroy(ctx->shard_iter);
+        ctx->shard_iter = NULL;
+    }
+}
@@ -47,6 +47,7 @@ typedef int32_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -119,6 +120,8 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys. Only sharded caches need it.
+                                          *   Keys which compare equal must have the same hash. */
 };
 
 /**
@@ -139,6 +142,10 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+    lv_cache_t ** shards;             /**< Independently locked caches the entries are distributed to by
+                                       *   `ops.hash_cb`. `NULL` if the cache is not sharded. */
+    uint32_t shard_cnt;               /**< Number of `shards` */
 };
 
 /**
@@ -202,6 +209,22 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
                              size_t node_size, size_t max_size,
                              lv_cache_ops_t ops);
 
+/**
+ * Create a cache object which is split into independently locked shards.
+ * The entries are distributed to the shards by the hash of their key, so threads using different keys
+ * rarely wait for each other. Each shard gets `max_size / shard_cnt` and evicts its own entries.
+ * @param cache_class   The class of the shards. See lv_cache_create().
+ * @param node_size     The node size is the size of the data stored in the cache.
+ * @param max_size      The max size of all the shards together.
+ * @param ops           A set of operations that can be performed on the cache. `ops.hash_cb` is required.
+ * @param shard_cnt     Number of shards. With 1 a normal cache is created.
+ * @return              Returns a pointer to the created cache object on success, `NULL` on error.
+ * @note                With a size-based class an entry must fit in the size of one shard.
+ */
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt);
+
 /**
  * Destroy a cache object.
  * @param cache         The cache object pointer to destroy.
@@ -254,6 +277,8 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
  * Reserve a certain amount of memory/count in the cache. This function is useful when you want to reserve a certain amount of memory/count in advance,
  * for example, when you know that you will need it later.
  * When the current cache size is max than the reserved size, the function will evict entries until the reserved size is reached.
+ * @note A sharded cache doesn't know which shard will store the entry, so the size is reserved in each shard,
+ *       limited to the max size of the shard.
  * @param cache         The cache object pointer to reserve.
  * @param reserved_size The amount of memory/count to reserve.
  * @param user_data     A user data pointer that will be passed to the free callback.
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_anim_private.h"
+#include "lv_anim_batch_private.h"
 
 #include "../core/lv_global.h"
 
@@ -64,6 +65,7 @@ static void remove_anim(void * a);
 void lv_anim_core_init(void)
 {
     lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    lv_ll_init(&state.batch_ll, sizeof(lv_anim_batch_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
     state.anim_list_changed = false;
@@ -73,6 +75,7 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+    lv_anim_batch_delete_all();
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -99,6 +102,33 @@ void lv_anim_enable_vsync_mode(bool enable)
     anim_mark_list_change();
 }
 
+void lv_anim_update_timer(void)
+{
+    if(lv_ll_get_head(anim_ll_p) == NULL && state.batch_running_cnt == 0) {
+        if(state.timer) {
+            lv_timer_pause(state.timer);
+            return;
+        }
+
+        if(state.anim_vsync_registered) {
+            lv_display_unregister_vsync_event(NULL, anim_vsync_event, NULL);
+            state.anim_vsync_registered = false;
+        }
+
+        return;
+    }
+
+    if(state.timer) {
+        lv_timer_resume(state.timer);
+        return;
+    }
+
+    if(!state.anim_vsync_registered) {
+        lv_display_register_vsync_event(NULL, anim_vsync_event, NULL);
+        state.anim_vsync_registered = true;
+    }
+}
+
 void lv_anim_init(lv_anim_t * a)
 {
     LV_CHECK_ARG(a != NULL, return);
@@ -200,6 +230,9 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
         a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
 
+    /*The variable might be deleted so the animation batches shouldn't use it anymore*/
+    if(var && exec_cb == NULL) lv_anim_batch_remove_var(var);
+
     return del_any;
 }
 
@@ -699,6 +732,7 @@ static void anim_timer(lv_timer_t * param)
             a = lv_ll_get_next(anim_ll_p, a);
     }
 
+    lv_anim_batch_handler();
 }
 
 /**
@@ -770,29 +804,7 @@ static void anim_vsync_event(lv_event_t * e)
 static void anim_mark_list_change(void)
 {
     state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL) {
-        if(state.timer) {
-            lv_timer_pause(state.timer);
-            return;
-        }
-
-        if(state.anim_vsync_registered) {
-            lv_display_unregister_vsync_event(NULL, anim_vsync_event, NULL);
-            state.anim_vsync_registered = false;
-        }
-
-        return;
-    }
-
-    if(state.timer) {
-        lv_timer_resume(state.timer);
-        return;
-    }
-
-    if(!state.anim_vsync_registered) {
-        lv_display_register_vsync_event(NULL, anim_vsync_event, NULL);
-        state.anim_vsync_registered = true;
-    }
+    lv_anim_update_timer();
 }
 
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
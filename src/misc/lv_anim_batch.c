@@ -0,0 +1,482 @@
+/**
+ * @file lv_anim_batch.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_anim_batch_private.h"
+#include "lv_anim_private.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define state LV_GLOBAL_DEFAULT()->anim_state
+#define batch_ll_p &(state.batch_ll)
+
+/**Number of `int32_t` arrays which are not per channel: act_time, delay, duration, repeat_left, step*/
+#define ITEM_INT_ARRAY_CNT  5
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool batch_reserve(lv_anim_batch_t * batch, uint32_t cnt);
+static void batch_step(lv_anim_batch_t * batch, uint32_t elaps);
+static void batch_set_running(lv_anim_batch_t * batch, bool en);
+static void path_lut_update(lv_anim_batch_t * batch);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_anim_batch_t * lv_anim_batch_create(uint32_t channel_cnt)
+{
+    LV_CHECK_ARG(channel_cnt >= 1 && channel_cnt <= LV_ANIM_BATCH_CHANNEL_MAX, return NULL);
+
+    lv_anim_batch_t * batch = lv_ll_ins_head(batch_ll_p);
+    LV_ASSERT_MALLOC(batch);
+    if(batch == NULL) return NULL;
+
+    lv_memzero(batch, sizeof(lv_anim_batch_t));
+    batch->channel_cnt = channel_cnt;
+    batch->path_cb = lv_anim_path_linear;
+    batch->repeat_cnt = 1;
+    batch->run_round = state.batch_run_round;
+    state.batch_list_changed = true;
+
+    return batch;
+}
+
+void lv_anim_batch_delete(lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+
+    batch_set_running(batch, false);
+    lv_ll_remove(batch_ll_p, batch);
+    state.batch_list_changed = true;
+
+    /*All the arrays are in the buffer of `var`*/
+    lv_free(batch->var);
+    lv_free(batch->path_lut);
+    lv_free(batch);
+}
+
+int32_t lv_anim_batch_add(lv_anim_batch_t * batch, void * var, uint32_t duration, uint32_t delay)
+{
+    LV_CHECK_ARG(batch != NULL, return -1);
+
+    if(!batch_reserve(batch, batch->cnt + 1)) return -1;
+
+    uint32_t i = batch->cnt;
+    batch->var[i] = var;
+    batch->delay[i] = (int32_t)delay;
+    batch->act_time[i] = -(int32_t)delay;
+    batch->duration[i] = (int32_t)duration;
+    batch->repeat_left[i] = LV_MAX(batch->repeat_cnt, 1);
+    batch->step[i] = 0;
+    batch->changed[i] = 1;
+
+    uint32_t c;
+    for(c = 0; c < batch->channel_cnt; c++) {
+        batch->start_value[c][i] = 0;
+        batch->end_value[c][i] = 0;
+        batch->current_value[c][i] = 0;
+    }
+
+    /*The next step will add the time elapsed since the last one*/
+    if(batch->is_running) batch->act_time[i] -= (int32_t)lv_tick_elaps(batch->last_run);
+
+    batch->cnt++;
+    batch->active_cnt++;
+
+    return (int32_t)i;
+}
+
+void lv_anim_batch_set_values(lv_anim_batch_t * batch, uint32_t index, uint32_t channel, int32_t start, int32_t end)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    LV_CHECK_ARG(index < batch->cnt, return);
+    LV_CHECK_ARG(channel < batch->channel_cnt, return);
+
+    batch->start_value[channel][index] = start;
+    batch->end_value[channel][index] = end;
+    batch->current_value[channel][index] = start;
+
+    /*Apply the values in the next step even if they are the same as before*/
+    batch->changed[index] = 1;
+}
+
+void lv_anim_batch_clear(lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+
+    batch->cnt = 0;
+    batch->active_cnt = 0;
+    batch_set_running(batch, false);
+}
+
+void lv_anim_batch_set_exec_cb(lv_anim_batch_t * batch, lv_anim_batch_exec_cb_t exec_cb)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->exec_cb = exec_cb;
+}
+
+void lv_anim_batch_set_path_cb(lv_anim_batch_t * batch, lv_anim_path_cb_t path_cb)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->path_cb = path_cb ? path_cb : lv_anim_path_linear;
+    path_lut_update(batch);
+}
+
+void lv_anim_batch_set_bezier3_param(lv_anim_batch_t * batch, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->bezier3.x1 = x1;
+    batch->bezier3.y1 = y1;
+    batch->bezier3.x2 = x2;
+    batch->bezier3.y2 = y2;
+
+    if(batch->path_cb == lv_anim_path_custom_bezier3) path_lut_update(batch);
+}
+
+void lv_anim_batch_set_repeat_count(lv_anim_batch_t * batch, uint32_t cnt)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->repeat_cnt = cnt;
+}
+
+void lv_anim_batch_set_repeat_delay(lv_anim_batch_t * batch, uint32_t delay)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->repeat_delay = delay;
+}
+
+void lv_anim_batch_set_completed_cb(lv_anim_batch_t * batch, lv_anim_batch_completed_cb_t completed_cb)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->completed_cb = completed_cb;
+}
+
+void lv_anim_batch_set_user_data(lv_anim_batch_t * batch, void * user_data)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch->user_data = user_data;
+}
+
+void lv_anim_batch_start(lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+
+    uint32_t repeat_cnt = LV_MAX(batch->repeat_cnt, 1);
+    uint32_t i;
+    for(i = 0; i < batch->cnt; i++) {
+        batch->act_time[i] = -batch->delay[i];
+        batch->repeat_left[i] = repeat_cnt;
+        batch->step[i] = 0;
+        batch->changed[i] = 1;
+    }
+
+    batch->active_cnt = batch->cnt;
+    batch->last_run = lv_tick_get();
+    batch_set_running(batch, true);
+
+    /*Apply the start values right away*/
+    batch_step(batch, 0);
+}
+
+void lv_anim_batch_stop(lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return);
+    batch_set_running(batch, false);
+}
+
+bool lv_anim_batch_is_running(const lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return false);
+    return batch->is_running;
+}
+
+uint32_t lv_anim_batch_get_count(const lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return 0);
+    return batch->cnt;
+}
+
+int32_t lv_anim_batch_get_value(const lv_anim_batch_t * batch, uint32_t index, uint32_t channel)
+{
+    LV_CHECK_ARG(batch != NULL, return 0);
+    LV_CHECK_ARG(index < batch->cnt, return 0);
+    LV_CHECK_ARG(channel < batch->channel_cnt, return 0);
+
+    return batch->current_value[channel][index];
+}
+
+void * lv_anim_batch_get_user_data(const lv_anim_batch_t * batch)
+{
+    LV_CHECK_ARG(batch != NULL, return NULL);
+    return batch->user_data;
+}
+
+void lv_anim_batch_handler(void)
+{
+    if(state.batch_running_cnt == 0) return;
+
+    /*Flip the run round*/
+    state.batch_run_round = !state.batch_run_round;
+
+    lv_anim_batch_t * batch = lv_ll_get_head(batch_ll_p);
+    while(batch) {
+        /*Set if a batch is created or deleted in a `completed_cb`*/
+        state.batch_list_changed = false;
+
+        if(batch->is_running && batch->run_round != state.batch_run_round) {
+            batch->run_round = state.batch_run_round; /*The list reading might restart so mark the batch as done*/
+
+            uint32_t elaps = lv_tick_elaps(batch->last_run);
+            batch->last_run = lv_tick_get();
+            batch_step(batch, elaps);
+        }
+
+        /*The batch might be deleted, it's not safe to continue from it*/
+        if(state.batch_list_changed) batch = lv_ll_get_head(batch_ll_p);
+        else batch = lv_ll_get_next(batch_ll_p, batch);
+    }
+}
+
+void lv_anim_batch_remove_var(void * var)
+{
+    lv_anim_batch_t * batch;
+    LV_LL_READ(batch_ll_p, batch) {
+        void ** vars = batch->var;
+        uint32_t i;
+        for(i = 0; i < batch->cnt; i++) {
+            if(vars[i] == var) vars[i] = NULL;
+        }
+    }
+}
+
+void lv_anim_batch_delete_all(void)
+{
+    lv_anim_batch_t * batch;
+    while((batch = lv_ll_get_head(batch_ll_p)) != NULL) {
+        lv_anim_batch_delete(batch);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Make sure the arrays of a batch can store a given number of items
+ * @param batch     pointer to an animation batch
+ * @param cnt       the required number of items
+ * @return          true: there is enough space; false: out of memory
+ */
+static bool batch_reserve(lv_anim_batch_t * batch, uint32_t cnt)
+{
+    if(cnt <= batch->capacity) return true;
+
+    uint32_t capacity = batch->capacity ? batch->capacity : 8;
+    while(capacity < cnt) capacity *= 2;
+
+    /*Allocate all the arrays in one buffer. The pointers are the first to keep the others aligned too.*/
+    uint32_t int_array_cnt = ITEM_INT_ARRAY_CNT + 3 * batch->channel_cnt;
+    size_t size = capacity * (sizeof(void *) + int_array_cnt * sizeof(int32_t) + sizeof(uint8_t));
+    uint8_t * buf = lv_malloc(size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return false;
+
+    lv_anim_batch_t old = *batch;
+    int32_t * p = (int32_t *)(buf + capacity * sizeof(void *));
+    batch->var = (void **)buf;
+    batch->act_time = p;
+    p += capacity;
+    batch->delay = p;
+    p += capacity;
+    batch->duration = p;
+    p += capacity;
+    batch->repeat_left = (uint32_t *)p;
+    p += capacity;
+    batch->step = p;
+    p += capacity;
+
+    uint32_t c;
+    for(c = 0; c < batch->channel_cnt; c++) {
+        batch->start_value[c] = p;
+        p += capacity;
+        batch->end_value[c] = p;
+        p += capacity;
+        batch->current_value[c] = p;
+        p += capacity;
+    }
+    batch->changed = (uint8_t *)p;
+    batch->capacity = capacity;
+
+    if(old.var == NULL) return true;
+
+    uint32_t n = batch->cnt;
+    lv_memcpy(batch->var, old.var, n * sizeof(void *));
+    lv_memcpy(batch->act_time, old.act_time, n * sizeof(int32_t));
+    lv_memcpy(batch->delay, old.delay, n * sizeof(int32_t));
+    lv_memcpy(batch->duration, old.duration, n * sizeof(int32_t));
+    lv_memcpy(batch->repeat_left, old.repeat_left, n * sizeof(uint32_t));
+    lv_memcpy(batch->step, old.step, n * sizeof(int32_t));
+    for(c = 0; c < batch->channel_cnt; c++) {
+        lv_memcpy(batch->start_value[c], old.start_value[c], n * sizeof(int32_t));
+        lv_memcpy(batch->end_value[c], old.end_value[c], n * sizeof(int32_t));
+        lv_memcpy(batch->current_value[c], old.current_value[c], n * sizeof(int32_t));
+    }
+    lv_memcpy(batch->changed, old.changed, n);
+    lv_free(old.var);
+
+    return true;
+}
+
+/**
+ * Evaluate all the items of a batch, apply the changed values and handle the completed items.
+ * The items are processed in separate simple loops over the arrays so that the compiler can vectorize them.
+ * @param batch     pointer to a running animation batch
+ * @param elaps     milliseconds elapsed since the last step
+ */
+static void batch_step(lv_anim_batch_t * batch, uint32_t elaps)
+{
+    uint32_t cnt = batch->cnt;
+    int32_t * act_time = batch->act_time;
+    const int32_t * duration = batch->duration;
+    const uint32_t * repeat_left = batch->repeat_left;
+    int32_t * step = batch->step;
+    uint8_t * changed = batch->changed;
+    uint32_t i;
+
+    /*Advance the time of the not completed items, map it to [0..LV_BEZIER_VAL_MAX] like `lv_map()`
+     *and apply the path. The delayed items keep their step, i.e. the start value before the first play
+     *and the end value before repeating, as `lv_anim_t` does.*/
+    const int16_t * lut = batch->path_lut;
+    for(i = 0; i < cnt; i++) {
+        if(repeat_left[i] == 0) continue;
+
+        int32_t t = act_time[i] + (int32_t)elaps;
+        int32_t d = duration[i];
+        act_time[i] = t;
+        if(t < 0) continue;
+
+        int32_t s = t >= d ? LV_BEZIER_VAL_MAX : (t * LV_BEZIER_VAL_MAX) / d;
+        step[i] = lut ? lut[s] : s;
+    }
+
+    /*Calculate the values as `lv_anim_path_...` would do*/
+    uint32_t c;
+    for(c = 0; c < batch->channel_cnt; c++) {
+        const int32_t * start = batch->start_value[c];
+        const int32_t * end = batch->end_value[c];
+        int32_t * current = batch->current_value[c];
+        for(i = 0; i < cnt; i++) {
+            int32_t v = ((step[i] * (end[i] - start[i])) >> LV_BEZIER_VAL_SHIFT) + start[i];
+            changed[i] |= v != current[i];
+            current[i] = v;
+        }
+    }
+
+    /*Apply the values and restart or complete the items. Read the arrays from `batch`
+     *as `exec_cb` might add new items.*/
+    for(i = 0; i < batch->cnt; i++) {
+        if(batch->changed[i]) {
+            batch->changed[i] = 0;
+            if(batch->exec_cb && batch->var[i]) {
+                int32_t values[LV_ANIM_BATCH_CHANNEL_MAX];
+                for(c = 0; c < batch->channel_cnt; c++) {
+                    values[c] = batch->current_value[c][i];
+                }
+                batch->exec_cb(batch, i, batch->var[i], values);
+            }
+        }
+
+        if(batch->repeat_left[i] == 0 || batch->act_time[i] < batch->duration[i]) continue;
+
+        if(batch->repeat_left[i] != LV_ANIM_REPEAT_INFINITE) batch->repeat_left[i]--;
+
+        if(batch->repeat_left[i] == 0) {
+            batch->active_cnt--;
+        }
+        else {
+            /*Restart the item. If the time is over a little compensate it.*/
+            int32_t over_time = batch->act_time[i] - batch->duration[i];
+            if(over_time >= batch->duration[i]) over_time = 0;
+            batch->act_time[i] = over_time - (int32_t)batch->repeat_delay;
+        }
+    }
+
+    if(batch->active_cnt == 0) {
+        batch_set_running(batch, false);
+        /*The batch might be deleted here*/
+        if(batch->completed_cb) batch->completed_cb(batch);
+    }
+}
+
+/**
+ * Start or stop a batch and update the animation timer
+ * @param batch     pointer to an animation batch
+ * @param en        true: running; false: stopped
+ */
+static void batch_set_running(lv_anim_batch_t * batch, bool en)
+{
+    if(batch->is_running == en) return;
+
+    batch->is_running = en;
+    if(en) state.batch_running_cnt++;
+    else state.batch_running_cnt--;
+
+    lv_anim_update_timer();
+}
+
+/**
+ * Sample the path of a batch into a look up table. Use an animation from 0 to `LV_BEZIER_VAL_MAX`
+ * in `LV_BEZIER_VAL_MAX` milliseconds so that each sample is exactly the `step` the path would use.
+ * @param batch     pointer to an animation batch
+ */
+static void path_lut_update(lv_anim_batch_t * batch)
+{
+    if(batch->path_cb == lv_anim_path_linear) {
+        lv_free(batch->path_lut);
+        batch->path_lut = NULL;
+        return;
+    }
+
+    if(batch->path_lut == NULL) {
+        batch->path_lut = lv_malloc((LV_BEZIER_VAL_MAX + 1) * sizeof(int16_t));
+        LV_ASSERT_MALLOC(batch->path_lut);
+        if(batch->path_lut == NULL) {
+            LV_LOG_WARN("Couldn't allocate the path, using linear path");
+            batch->path_cb = lv_anim_path_linear;
+            return;
+        }
+    }
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, LV_BEZIER_VAL_MAX);
+    lv_anim_set_duration(&a, LV_BEZIER_VAL_MAX);
+    a.parameter.bezier3 = batch->bezier3;
+
+    int32_t t;
+    for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+        a.act_time = t;
+        int32_t v = batch->path_cb(&a);
+        batch->path_lut[t] = (int16_t)LV_CLAMP(INT16_MIN, v, INT16_MAX);
+    }
+}
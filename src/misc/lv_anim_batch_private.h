@@ -0,0 +1,87 @@
+/**
+ * @file lv_anim_batch_private.h
+ *
+ */
+
+#ifndef LV_ANIM_BATCH_PRIVATE_H
+#define LV_ANIM_BATCH_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Animations stored as arrays: one element for each item, one array for each channel*/
+struct _lv_anim_batch_t {
+    void ** var;                /**< The variables to animate, NULL if it was deleted*/
+    int32_t * act_time;         /**< Elapsed time of the items, negative while delayed*/
+    int32_t * delay;            /**< Delay of the items before starting*/
+    int32_t * duration;         /**< Duration of the items*/
+    uint32_t * repeat_left;     /**< Number of remaining plays, 0 if completed*/
+    int32_t * step;             /**< The progress of the items on the path in the current animation step*/
+    uint8_t * changed;          /**< Set if any value of the item changed in the current animation step*/
+    int32_t * start_value[LV_ANIM_BATCH_CHANNEL_MAX];
+    int32_t * end_value[LV_ANIM_BATCH_CHANNEL_MAX];
+    int32_t * current_value[LV_ANIM_BATCH_CHANNEL_MAX];
+    uint32_t cnt;               /**< Number of items*/
+    uint32_t capacity;          /**< Allocated length of the arrays*/
+    uint32_t channel_cnt;
+    uint32_t active_cnt;        /**< Number of not completed items*/
+
+    lv_anim_path_cb_t path_cb;
+    lv_anim_bezier3_para_t bezier3;
+    int16_t * path_lut;         /**< `path_cb` sampled in `LV_BEZIER_VAL_MAX + 1` points, NULL for linear path*/
+
+    lv_anim_batch_exec_cb_t exec_cb;
+    lv_anim_batch_completed_cb_t completed_cb;
+    void * user_data;
+    uint32_t repeat_cnt;
+    uint32_t repeat_delay;
+    uint32_t last_run;          /**< Tick of the last animation step*/
+    uint8_t is_running : 1;
+    uint8_t run_round : 1;      /**< Indicates the batch has run in this round*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Run an animation step of the running animation batches. Called by the animation timer.
+ */
+void lv_anim_batch_handler(void);
+
+/**
+ * Forget a variable in all the animation batches, e.g. because it's deleted.
+ * Its items keep running but their `exec_cb` is not called anymore.
+ * @param var       pointer to the variable
+ */
+void lv_anim_batch_remove_var(void * var);
+
+/**
+ * Delete all the animation batches
+ */
+void lv_anim_batch_delete_all(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ANIM_BATCH_PRIVATE_H*/
@@ -30,6 +30,10 @@ typedef struct {
     bool anim_vsync_registered;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
+    lv_ll_t batch_ll;               /**< The created `lv_anim_batch_t`s*/
+    uint32_t batch_running_cnt;     /**< Number of running animation batches, the timer runs if not zero*/
+    bool batch_list_changed;
+    bool batch_run_round;
 } lv_anim_state_t;
 
 /**********************
@@ -52,6 +56,11 @@ void lv_anim_core_deinit(void);
  */
 void lv_anim_enable_vsync_mode(bool enable);
 
+/**
+ * Resume or pause the animation timer depending on whether there is anything to animate
+ */
+void lv_anim_update_timer(void);
+
 /**********************
  *      MACROS
  **********************/
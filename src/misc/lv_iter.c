@@ -31,6 +31,7 @@ struct _lv_iter_t {
 
     /* Callbacks */
     lv_iter_next_cb next_cb;  /**< Callback to get the next element */
+    lv_iter_context_destroy_cb context_destroy_cb;  /**< Callback to release the resources of the context */
 };
 
 /**********************
@@ -86,11 +87,20 @@ void * lv_iter_get_context(const lv_iter_t * iter)
     return iter ? iter->context : NULL;
 }
 
+void lv_iter_set_context_destroy_cb(lv_iter_t * iter, lv_iter_context_destroy_cb destroy_cb)
+{
+    LV_ASSERT_NULL(iter);
+    if(iter == NULL) return;
+
+    iter->context_destroy_cb = destroy_cb;
+}
+
 void lv_iter_destroy(lv_iter_t * iter)
 {
     LV_ASSERT_NULL(iter);
     if(iter == NULL) return;
 
+    if(iter->context_destroy_cb) iter->context_destroy_cb(iter->context);
     if(iter->context_size > 0) lv_free(iter->context);
     if(iter->peek_buf != NULL) lv_circle_buf_destroy(iter->peek_buf);
 
@@ -28,6 +28,7 @@ extern "C" {
 typedef struct _lv_iter_t lv_iter_t;
 typedef lv_result_t (*lv_iter_next_cb)(void * instance, void * context, void * elem);
 typedef void (*lv_iter_inspect_cb)(void * elem);
+typedef void (*lv_iter_context_destroy_cb)(void * context);
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -52,8 +53,15 @@ lv_iter_t * lv_iter_create(void * instance, uint32_t elem_size, uint32_t context
 void * lv_iter_get_context(const lv_iter_t * iter);
 
 /**
- * Destroy the iterator object, and release the context. Other resources allocated by the user are not released.
- * The user needs to release it by itself.
+ * Set a callback to release the resources referenced by the context when the iterator is destroyed.
+ * @param iter          `lv_iter_t` object create before
+ * @param destroy_cb    called with the context in `lv_iter_destroy`, before the context is freed
+ */
+void lv_iter_set_context_destroy_cb(lv_iter_t * iter, lv_iter_context_destroy_cb destroy_cb);
+
+/**
+ * Destroy the iterator object, and release the context. Other resources allocated by the user are not released
+ * unless a context destroy callback is set with `lv_iter_set_context_destroy_cb`.
  * @param iter          `lv_iter_t` object create before
  */
 void lv_iter_destroy(lv_iter_t * iter);
@@ -0,0 +1,180 @@
+/**
+ * @file lv_str_intern.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_str_intern_private.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define str_intern (LV_GLOBAL_DEFAULT()->str_intern)
+
+#define FNV_OFFSET_BASIS    2166136261U
+#define FNV_PRIME           16777619U
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_str_intern_node_t {
+    lv_str_intern_node_t * next;
+    uint32_t hash;
+    uint32_t ref_cnt;
+    char str[];
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline lv_str_intern_node_t * get_node(const char * str);
+static inline lv_str_intern_node_t ** get_bucket(uint32_t hash);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#if LV_USE_OS
+    #define INTERN_LOCK     lv_mutex_lock(&str_intern.lock)
+    #define INTERN_UNLOCK   lv_mutex_unlock(&str_intern.lock)
+#else
+    #define INTERN_LOCK
+    #define INTERN_UNLOCK
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_str_intern_init(void)
+{
+    lv_memzero(&str_intern, sizeof(str_intern));
+#if LV_USE_OS
+    lv_mutex_init(&str_intern.lock);
+#endif
+}
+
+void lv_str_intern_deinit(void)
+{
+    if(str_intern.str_cnt) {
+        LV_LOG_INFO("%" LV_PRIu32 " interned strings are still referenced", str_intern.str_cnt);
+    }
+
+    for(uint32_t i = 0; i < LV_STR_INTERN_BUCKET_CNT; i++) {
+        lv_str_intern_node_t * node = str_intern.buckets[i];
+        while(node) {
+            lv_str_intern_node_t * next = node->next;
+            lv_free(node);
+            node = next;
+        }
+        str_intern.buckets[i] = NULL;
+    }
+    str_intern.str_cnt = 0;
+
+#if LV_USE_OS
+    lv_mutex_delete(&str_intern.lock);
+#endif
+}
+
+const char * lv_str_intern(const char * str)
+{
+    LV_ASSERT_NULL(str);
+    return lv_str_intern_hashed(str, lv_str_hash(str));
+}
+
+const char * lv_str_intern_hashed(const char * str, uint32_t hash)
+{
+    LV_ASSERT_NULL(str);
+
+    INTERN_LOCK;
+
+    lv_str_intern_node_t ** bucket = get_bucket(hash);
+    lv_str_intern_node_t * node;
+    for(node = *bucket; node; node = node->next) {
+        /*The string may be the interned one itself, e.g. when an image is set again*/
+        if(node->hash == hash && (node->str == str || lv_strcmp(node->str, str) == 0)) {
+            node->ref_cnt++;
+            INTERN_UNLOCK;
+            return node->str;
+        }
+    }
+
+    size_t len = lv_strlen(str);
+    node = lv_malloc(sizeof(lv_str_intern_node_t) + len + 1);
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) {
+        INTERN_UNLOCK;
+        return NULL;
+    }
+
+    node->hash = hash;
+    node->ref_cnt = 1;
+    lv_memcpy(node->str, str, len + 1);
+    node->next = *bucket;
+    *bucket = node;
+    str_intern.str_cnt++;
+
+    INTERN_UNLOCK;
+    return node->str;
+}
+
+void lv_str_intern_release(const char * str)
+{
+    if(str == NULL) return;
+
+    lv_str_intern_node_t * node = get_node(str);
+
+    INTERN_LOCK;
+
+    LV_ASSERT(node->ref_cnt > 0);
+    node->ref_cnt--;
+    if(node->ref_cnt == 0) {
+        lv_str_intern_node_t ** prev = get_bucket(node->hash);
+        while(*prev != node) prev = &(*prev)->next;
+        *prev = node->next;
+        str_intern.str_cnt--;
+        lv_free(node);
+    }
+
+    INTERN_UNLOCK;
+}
+
+uint32_t lv_str_intern_get_hash(const char * str)
+{
+    return get_node(str)->hash;
+}
+
+uint32_t lv_str_hash(const char * str)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for(const uint8_t * c = (const uint8_t *)str; *c != '\0'; c++) {
+        hash = (hash ^ *c) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline lv_str_intern_node_t * get_node(const char * str)
+{
+    return (lv_str_intern_node_t *)(str - offsetof(lv_str_intern_node_t, str));
+}
+
+static inline lv_str_intern_node_t ** get_bucket(uint32_t hash)
+{
+    /*The low bits of FNV-1a are mixed well enough*/
+    return &str_intern.buckets[hash & (LV_STR_INTERN_BUCKET_CNT - 1)];
+}
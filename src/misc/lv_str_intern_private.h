@@ -0,0 +1,103 @@
+/**
+ * @file lv_str_intern_private.h
+ *
+ */
+
+#ifndef LV_STR_INTERN_PRIVATE_H
+#define LV_STR_INTERN_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of hash buckets of the interned strings. Must be a power of 2.*/
+#define LV_STR_INTERN_BUCKET_CNT    64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_str_intern_node_t lv_str_intern_node_t;
+
+/**
+ * Table of the interned strings.
+ * Each different string is stored only once and shared with reference counting.
+ */
+typedef struct {
+    lv_str_intern_node_t * buckets[LV_STR_INTERN_BUCKET_CNT];
+    uint32_t str_cnt;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_str_intern_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the interned string table
+ */
+void lv_str_intern_init(void);
+
+/**
+ * Free all the interned strings
+ */
+void lv_str_intern_deinit(void);
+
+/**
+ * Get the shared copy of a string. If it's not interned yet a copy is created.
+ * @param str       the string to intern
+ * @return          the interned string which must be given back with ::lv_str_intern_release,
+ *                  or NULL on out of memory
+ */
+const char * lv_str_intern(const char * str);
+
+/**
+ * Same as ::lv_str_intern but with an already computed hash
+ * @param str       the string to intern
+ * @param hash      `lv_str_hash(str)`
+ * @return          the interned string or NULL on out of memory
+ */
+const char * lv_str_intern_hashed(const char * str, uint32_t hash);
+
+/**
+ * Give back an interned string. It's freed when it was the last reference to it.
+ * @param str       a string returned by ::lv_str_intern or NULL
+ */
+void lv_str_intern_release(const char * str);
+
+/**
+ * Get the hash of an interned string without reading the string
+ * @param str       a string returned by ::lv_str_intern
+ * @return          the same as `lv_str_hash(str)`
+ */
+uint32_t lv_str_intern_get_hash(const char * str);
+
+/**
+ * Hash a string with FNV-1a
+ * @param str       a '\0' terminated string
+ * @return          the 32 bit hash
+ */
+uint32_t lv_str_hash(const char * str);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_STR_INTERN_PRIVATE_H*/
@@ -256,6 +256,43 @@ void lv_style_merge(lv_style_t * dst, const lv_style_t * src)
     }
 }
 
+void lv_style_freeze(lv_style_t * style)
+{
+    LV_CHECK_ARG(style != NULL && LV_STYLE_SENTINEL_OK(style), return);
+
+    if(lv_style_is_const(style)) {
+        LV_LOG_WARN("Constant styles can not be frozen");
+        return;
+    }
+
+    if(style->frozen) return;
+    if(style->prop_cnt == 0) {
+        style->frozen = 1;
+        return;
+    }
+
+    LV_PROFILER_STYLE_BEGIN;
+
+    /*Insertion sort as styles have only a few (typically < 30) properties*/
+    lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+    int32_t i;
+    for(i = 1; i < style->prop_cnt; i++) {
+        lv_style_prop_t prop = props[i];
+        lv_style_value_t value = values[i];
+        int32_t j;
+        for(j = i; j > 0 && props[j - 1] > prop; j--) {
+            props[j] = props[j - 1];
+            values[j] = values[j - 1];
+        }
+        props[j] = prop;
+        values[j] = value;
+    }
+
+    style->frozen = 1;
+    LV_PROFILER_STYLE_END;
+}
+
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
 {
     if(lv_style_custom_prop_flag_lookup_table == NULL) {
@@ -391,9 +428,16 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
 
-    /*Set the new property and value*/
-    props[style->prop_cnt - 1] = prop;
-    values[style->prop_cnt - 1] = value;
+    /*Set the new property and value. Keep the properties sorted in frozen styles.*/
+    i = style->prop_cnt - 1;
+    if(style->frozen) {
+        for(; i > 0 && props[i - 1] > prop; i--) {
+            props[i] = props[i - 1];
+            values[i] = values[i - 1];
+        }
+    }
+    props[i] = prop;
+    values[i] = value;
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
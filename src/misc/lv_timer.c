@@ -26,9 +26,16 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static bool heap_reserve(uint32_t cnt);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_sift_up(uint32_t index);
+static void heap_sift_down(uint32_t index);
+static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b);
 
 /**********************
  *  STATIC VARIABLES
@@ -85,44 +92,23 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+    /*Run the ready timers in the order of their next run. The timers created or deleted
+     *by the callbacks are added to or removed from the heap so the loop can simply go on.*/
+    state_p->run_round++;
+    while(state_p->heap_size > 0) {
+        lv_timer_t * timer = state_p->heap[0];
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+        /*A timer with a short period might be ready again if the tick hasn't changed,
+         *but run every timer only once in a round to return in time*/
+        if(timer->run_round == state_p->run_round) break;
+        if(lv_timer_time_remaining(timer) != 0) break;
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+        lv_timer_exec(timer);
     }
 
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_size > 0) time_until_next = lv_timer_time_remaining(state_p->heap[0]);
+
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -161,6 +147,9 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Make room for the new timer in the heap first so that resuming a timer can't fail later*/
+    if(!heap_reserve(state.timer_cnt + 1)) return NULL;
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -176,8 +165,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->ext_data.free_cb = NULL;
     new_timer->ext_data.data = NULL;
 #endif
+    new_timer->run_round = state.run_round - 1;
+    new_timer->create_id = state.create_cnt++;
 
-    state.timer_created = true;
+    state.timer_cnt++;
+    heap_insert(new_timer);
 
     lv_timer_handler_resume();
 
@@ -194,7 +186,9 @@ void lv_timer_delete(lv_timer_t * timer)
 {
     if(timer == NULL) return;
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    heap_remove(timer);
+    state.timer_cnt--;
+    if(state.timer_exec == timer) state.timer_exec = NULL;
 
 #if LV_USE_EXT_DATA
     if(timer->ext_data.free_cb) {
@@ -210,12 +204,16 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_CHECK_ARG(timer != NULL, return);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_CHECK_ARG(timer != NULL, return);
-    timer->paused = false;
+    if(timer->paused) {
+        timer->paused = false;
+        heap_insert(timer);
+    }
     lv_timer_handler_resume();
 }
 
@@ -223,6 +221,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_CHECK_ARG(timer != NULL, return);
     timer->period = period;
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -230,6 +229,7 @@ void lv_timer_ready(lv_timer_t * timer)
 {
     LV_CHECK_ARG(timer != NULL, return);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -255,6 +255,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_CHECK_ARG(timer != NULL, return);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -269,6 +270,12 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_size = 0;
+    state.heap_capacity = 0;
+    state.timer_cnt = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -324,55 +331,49 @@ void lv_timer_set_external_data(lv_timer_t * timer, void * data, void (* free_cb
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
- * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
+ * Execute a ready timer and move it to its new place in the heap
+ * @param timer pointer to a not paused lv_timer whose remaining time is zero
  */
-static bool lv_timer_exec(lv_timer_t * timer)
-{
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) {
-            LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
-            timer->timer_cb(timer);
-            LV_PROFILER_TIMER_END_TAG("timer_cb");
-        }
-
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+static void lv_timer_exec(lv_timer_t * timer)
+{
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer deletes itself `if(timer->repeat_count == 0)` is not executed below*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->run_round = state.run_round;
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
+
+    state.timer_exec = timer;
+    if(timer->timer_cb && original_repeat_count != 0) {
+        LV_PROFILER_TIMER_BEGIN_TAG("timer_cb");
+        timer->timer_cb(timer);
+        LV_PROFILER_TIMER_END_TAG("timer_cb");
+    }
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(state.timer_exec == NULL) {
+        LV_TRACE_TIMER("timer callback finished, the timer is deleted");
+        return;
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            if(timer->auto_delete) {
-                LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_delete(timer);
-            }
-            else {
-                LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_pause(timer);
-            }
+    state.timer_exec = NULL;
+    LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*Not done before the callback as most one-shot timers are deleted anyway.
+     *Meanwhile the heap is still valid with the old place of the timer.*/
+    heap_update(timer);
+
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        if(timer->auto_delete) {
+            LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_delete(timer);
+        }
+        else {
+            LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_pause(timer);
         }
     }
-
-    return exec;
 }
 
 /**
@@ -406,3 +407,137 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Make sure the heap can store a given number of timers
+ * @param cnt       the required capacity
+ * @return          true: there is enough space; false: out of memory
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= state.heap_capacity) return true;
+
+    uint32_t new_capacity = state.heap_capacity ? state.heap_capacity * 2 : 8;
+    lv_timer_t ** new_heap = lv_realloc(state.heap, new_capacity * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    state.heap = new_heap;
+    state.heap_capacity = new_capacity;
+    return true;
+}
+
+/**
+ * Add a timer to the heap. There is always space for it as it's reserved when the timer is created.
+ * @param timer     pointer to a timer which is not in the heap
+ */
+static void heap_insert(lv_timer_t * timer)
+{
+    LV_ASSERT(state.heap_size < state.heap_capacity);
+
+    uint32_t index = state.heap_size;
+    state.heap_size++;
+    state.heap[index] = timer;
+    timer->heap_index = index;
+    heap_sift_up(index);
+}
+
+/**
+ * Remove a timer from the heap
+ * @param timer     pointer to a timer. Nothing happens if it's not in the heap.
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index == LV_TIMER_HEAP_INDEX_NONE) return;
+    timer->heap_index = LV_TIMER_HEAP_INDEX_NONE;
+
+    state.heap_size--;
+    if(index == state.heap_size) return;
+
+    /*Move the last timer to the freed place and restore the order from there*/
+    lv_timer_t * last = state.heap[state.heap_size];
+    state.heap[index] = last;
+    last->heap_index = index;
+    heap_update(last);
+}
+
+/**
+ * Move a timer to its place in the heap after its period or last run has changed
+ * @param timer     pointer to a timer. Nothing happens if it's not in the heap.
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index == LV_TIMER_HEAP_INDEX_NONE) return;
+
+    heap_sift_up(index);
+    if(timer->heap_index == index) heap_sift_down(index);
+}
+
+/**
+ * Move a timer towards the root of the heap while it should run before its parent
+ * @param index     index of the timer in the heap
+ */
+static void heap_sift_up(uint32_t index)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[index];
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if(!heap_is_before(timer, heap[parent])) break;
+
+        heap[index] = heap[parent];
+        heap[index]->heap_index = index;
+        index = parent;
+    }
+
+    heap[index] = timer;
+    timer->heap_index = index;
+}
+
+/**
+ * Move a timer towards the leaves of the heap while one of its children should run before it
+ * @param index     index of the timer in the heap
+ */
+static void heap_sift_down(uint32_t index)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[index];
+    uint32_t size = state.heap_size;
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= size) break;
+        if(child + 1 < size && heap_is_before(heap[child + 1], heap[child])) child++;
+        if(!heap_is_before(heap[child], timer)) break;
+
+        heap[index] = heap[child];
+        heap[index]->heap_index = index;
+        index = child;
+    }
+
+    heap[index] = timer;
+    timer->heap_index = index;
+}
+
+/**
+ * Check if a timer should run before an other one
+ * @param a         pointer to a timer
+ * @param b         pointer to an other timer
+ * @return          true: `a`'s next run is earlier. At the same time the one which ran in an earlier round
+ *                  is the first, then the newer one as the timers were run from the newest earlier.
+ */
+static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*Compare the next runs relative to each other to handle the overflow of the tick.
+     *The periods are limited to keep the difference in the range of `int32_t`.*/
+    uint32_t period_a = LV_MIN(a->period, INT32_MAX);
+    uint32_t period_b = LV_MIN(b->period, INT32_MAX);
+    int32_t diff = (int32_t)((a->last_run + period_a) - (b->last_run + period_b));
+    if(diff != 0) return diff < 0;
+
+    diff = (int32_t)(a->run_round - b->run_round);
+    if(diff != 0) return diff < 0;
+
+    return (int32_t)(a->create_id - b->create_id) > 0;
+}
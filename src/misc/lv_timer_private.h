@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** `heap_index` of the timers which are not in the heap (paused)*/
+#define LV_TIMER_HEAP_INDEX_NONE    UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -38,15 +41,26 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t heap_index;       /**< Index in the heap of the running timers or `LV_TIMER_HEAP_INDEX_NONE` */
+    uint32_t run_round;        /**< `run_round` of the timer handler when the timer was executed last time */
+    uint32_t create_id;        /**< Order of creation, timers ready at the same time run from the newest one */
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
 
+    /** Binary min-heap of the not paused timers ordered by their next run,
+     *  so the handler touches only the timers which are ready*/
+    lv_timer_t ** heap;
+    uint32_t heap_size;
+    uint32_t heap_capacity;
+    uint32_t timer_cnt;        /**< Number of timers in `timer_ll`, the heap can hold all of them */
+    uint32_t run_round;        /**< Incremented on each `lv_timer_handler()` call */
+    uint32_t create_cnt;       /**< Number of the created timers, used as `create_id` */
+    lv_timer_t * timer_exec;   /**< The timer whose callback is running, NULL if it deleted itself */
+
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     volatile uint32_t timer_time_until_next;
 
     bool already_running;
@@ -7,6 +7,7 @@
  *********************/
 #include "../lvgl_public.h"
 #include "../core/lv_global.h"
+#include "lv_mem_slab_private.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
     #include <pthread.h>
@@ -22,6 +23,16 @@
 
 #define zero_mem LV_GLOBAL_DEFAULT()->memory_zero
 
+#if LV_USE_MEM_SLAB
+    #define mem_alloc(size)             lv_mem_slab_alloc(size)
+    #define mem_realloc(p, new_size)    lv_mem_slab_realloc(p, new_size)
+    #define mem_free(p)                 lv_mem_slab_free(p)
+#else
+    #define mem_alloc(size)             lv_malloc_core(size)
+    #define mem_realloc(p, new_size)    lv_realloc_core(p, new_size)
+    #define mem_free(p)                 lv_free_core(p)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -64,7 +75,7 @@ void * lv_malloc(size_t size)
         return &zero_mem;
     }
 
-    void * alloc = lv_malloc_core(size);
+    void * alloc = mem_alloc(size);
 
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
@@ -94,7 +105,7 @@ void * lv_malloc_zeroed(size_t size)
         return &zero_mem;
     }
 
-    void * alloc = lv_malloc_core(size);
+    void * alloc = mem_alloc(size);
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
@@ -130,7 +141,7 @@ void lv_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
-    lv_free_core(data);
+    mem_free(data);
 }
 
 void * lv_reallocf(void * data_p, size_t new_size)
@@ -153,7 +164,7 @@ void * lv_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_malloc(new_size);
 
-    void * new_p = lv_realloc_core(data_p, new_size);
+    void * new_p = mem_realloc(data_p, new_size);
 
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't reallocate memory");
@@ -178,6 +189,14 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     lv_mem_monitor_core(mon_p);
+
+    lv_draw_task_arena_t * arena = &LV_GLOBAL_DEFAULT()->draw_info.task_arena;
+    mon_p->draw_task_arena_size = (size_t)arena->chunk_cnt * LV_DRAW_TASK_ARENA_CHUNK_SIZE;
+    mon_p->draw_task_arena_alloc_cnt = arena->alloc_cnt_last;
+
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_monitor(mon_p);
+#endif
 }
 
 /**********************
@@ -0,0 +1,584 @@
+/**
+ * @file lv_mem_slab.c
+ *
+ * Small object front-end of `lv_malloc()`.
+ *
+ * Every block has a `LV_MEM_SLAB_ALIGN` byte header in front of the returned pointer which tells
+ * whether the block belongs to a size class or was allocated by `lv_malloc_core()`.
+ * The small blocks are carved from spans taken from the heap. Each thread keeps its free blocks
+ * in its own cache and exchanges them in batches with a shared list, so the common case
+ * needs no locking. The cache of an exiting thread is given back to the shared lists if the OS
+ * lets us know about it. The spans are given back to the heap only by `lv_mem_slab_deinit()`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_slab_private.h"
+
+#if LV_USE_MEM_SLAB
+
+#include "../core/lv_global.h"
+
+#if defined(__SANITIZE_ADDRESS__)
+    #define SLAB_USE_ASAN 1
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define SLAB_USE_ASAN 1
+    #endif
+#endif
+
+#ifdef SLAB_USE_ASAN
+    #include <sanitizer/asan_interface.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define state LV_GLOBAL_DEFAULT()->mem_slab
+
+#define HEADER_SIZE     sizeof(slab_header_t)
+
+/*A thread cache gives back `BATCH_CNT` blocks if it has more than `CACHE_LIMIT` of a class*/
+#define BATCH_CNT       32
+#define CACHE_LIMIT     64
+
+/*Only the OSes whose threads are known to support compiler level thread local storage*/
+#if LV_USE_OS == LV_OS_PTHREAD || LV_USE_OS == LV_OS_WINDOWS
+    #if defined(_MSC_VER)
+        #define SLAB_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__)
+        #define SLAB_THREAD_LOCAL __thread
+    #endif
+#endif
+
+/*Without thread local storage all threads use `state.shared_cache` under the lock*/
+#ifdef SLAB_THREAD_LOCAL
+    #define SLAB_USE_TLS        1
+    #define SLAB_LOCK_CACHE     0
+    #define SLAB_LOCK_SHARED    1
+#else
+    #define SLAB_USE_TLS        0
+    #define SLAB_LOCK_CACHE     LV_USE_OS
+    #define SLAB_LOCK_SHARED    0
+#endif
+
+/*With pthread a key's destructor tells when a thread exits*/
+#if SLAB_USE_TLS && LV_USE_OS == LV_OS_PTHREAD
+    #define SLAB_USE_TLS_DESTRUCTOR 1
+#else
+    #define SLAB_USE_TLS_DESTRUCTOR 0
+#endif
+
+#if LV_MEM_SLAB_SPAN_SIZE < 4 * (LV_MEM_SLAB_MAX_SIZE + LV_MEM_SLAB_ALIGN) + 2 * LV_MEM_SLAB_ALIGN
+    #error "LV_MEM_SLAB_SPAN_SIZE is too small, it should fit at least 4 blocks of the largest size class"
+#endif
+
+/*`class_size` and `class_lut` are made for this alignment*/
+#if LV_MEM_SLAB_ALIGN != 16
+    #error "Update the size classes for the new LV_MEM_SLAB_ALIGN"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Stored in front of every block returned by `lv_mem_slab_alloc()`.
+ * The first word of the spans uses the same type to link the spans.
+ */
+typedef union {
+    uint32_t cls;       /**< 0: allocated by `lv_malloc_core()`, else index of the size class + 1*/
+    void * next_span;
+    uint8_t align[LV_MEM_SLAB_ALIGN];   /**< Keep the pointers after the header aligned*/
+} slab_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * core_alloc(size_t size);
+static lv_mem_slab_cache_t * cache_get(void);
+static void * cache_pop(lv_mem_slab_cache_t * cache, uint32_t cls);
+static void cache_push(lv_mem_slab_cache_t * cache, uint32_t cls, void * p);
+static bool cache_refill(lv_mem_slab_cache_t * cache, uint32_t cls);
+static void cache_flush(lv_mem_slab_cache_t * cache, uint32_t cls);
+static void span_add(uint32_t cls);
+static uint32_t histogram_bin(size_t size);
+#if SLAB_USE_TLS_DESTRUCTOR
+    static void cache_release_cb(void * p);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Multiples of `LV_MEM_SLAB_ALIGN` so that all the blocks of a span stay aligned*/
+static const uint16_t class_size[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 80, 96, 128, 160, 192, 256};
+
+/*Size class of the sizes rounded up to 16 bytes, indexed by `(size + 15) / 16`*/
+static const uint8_t class_lut[LV_MEM_SLAB_MAX_SIZE / 16 + 1] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 6, 7, 7, 8, 8, 9, 9, 9, 9
+};
+
+#if SLAB_USE_TLS
+/*Incremented on every init so that the caches of a previous `lv_init()` are not used*/
+static uint32_t generation;
+static SLAB_THREAD_LOCAL lv_mem_slab_cache_t * tls_cache;
+static SLAB_THREAD_LOCAL uint32_t tls_generation;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+#ifdef SLAB_USE_ASAN
+    #define SLAB_POISON(p, size)    ASAN_POISON_MEMORY_REGION(p, size)
+    #define SLAB_UNPOISON(p, size)  ASAN_UNPOISON_MEMORY_REGION(p, size)
+#else
+    #define SLAB_POISON(p, size)
+    #define SLAB_UNPOISON(p, size)
+#endif
+
+#if SLAB_LOCK_CACHE
+    #define CACHE_LOCK()    lv_mutex_lock(&state.lock)
+    #define CACHE_UNLOCK()  lv_mutex_unlock(&state.lock)
+#else
+    #define CACHE_LOCK()
+    #define CACHE_UNLOCK()
+#endif
+
+#if SLAB_LOCK_SHARED
+    #define SHARED_LOCK()   lv_mutex_lock(&state.lock)
+    #define SHARED_UNLOCK() lv_mutex_unlock(&state.lock)
+#else
+    #define SHARED_LOCK()
+    #define SHARED_UNLOCK()
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_slab_init(void)
+{
+    lv_memzero(&state, sizeof(state));
+#if LV_USE_OS
+    lv_mutex_init(&state.lock);
+#endif
+    state.cache_head = &state.shared_cache;
+#if SLAB_USE_TLS
+    generation++;
+#endif
+#if SLAB_USE_TLS_DESTRUCTOR
+    if(pthread_key_create(&state.cache_key, cache_release_cb) != 0) {
+        LV_LOG_WARN("couldn't create the thread key, the caches of the exited threads are kept");
+    }
+#endif
+    state.inited = true;
+}
+
+void lv_mem_slab_deinit(void)
+{
+    if(!state.inited) return;
+    state.inited = false;
+
+#if SLAB_USE_TLS_DESTRUCTOR
+    /*The caches are freed below, so don't call the destructor when the threads exit*/
+    pthread_key_delete(state.cache_key);
+#endif
+
+    slab_header_t * span = state.span_head;
+    while(span) {
+        slab_header_t * next = span->next_span;
+        SLAB_UNPOISON(span, LV_MEM_SLAB_SPAN_SIZE);
+        lv_free_core(span);
+        span = next;
+    }
+
+    lv_mem_slab_cache_t * cache = state.cache_head;
+    while(cache) {
+        lv_mem_slab_cache_t * next = cache->next;
+        if(cache != &state.shared_cache) lv_free_core(cache);
+        cache = next;
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&state.lock);
+#endif
+    lv_memzero(&state, sizeof(state));
+}
+
+void * lv_mem_slab_alloc(size_t size)
+{
+    if(!state.inited) return core_alloc(size);
+
+    lv_mem_slab_cache_t * cache = cache_get();
+    if(cache == NULL) return core_alloc(size);
+
+    void * p = NULL;
+    CACHE_LOCK();
+    cache->size_histogram[histogram_bin(size)]++;
+    if(size <= LV_MEM_SLAB_MAX_SIZE) p = cache_pop(cache, class_lut[(size + 15) >> 4]);
+    CACHE_UNLOCK();
+
+    /*Too large or no memory for a new span*/
+    if(p == NULL) return core_alloc(size);
+
+    /*Leave the unused end of the block poisoned*/
+    SLAB_UNPOISON(p, size);
+    return p;
+}
+
+void lv_mem_slab_free(void * p)
+{
+    /*The spans are already given back to the heap, so the header might be freed memory too.
+     *The heap is deinitialized right after the slabs, so just leave the block.*/
+    if(!state.inited) return;
+
+    slab_header_t * header = (slab_header_t *)p - 1;
+    if(header->cls == 0) {
+        lv_free_core(header);
+        return;
+    }
+
+    uint32_t cls = header->cls - 1;
+    LV_ASSERT_MSG(cls < LV_MEM_SLAB_CLASS_CNT, "Corrupted memory block header");
+
+    lv_mem_slab_cache_t * cache = cache_get();
+    if(cache == NULL) {
+        /*The thread has no cache, give it to the shared list directly*/
+        SHARED_LOCK();
+        cache_push(NULL, cls, p);
+        SHARED_UNLOCK();
+        return;
+    }
+
+    CACHE_LOCK();
+    cache_push(cache, cls, p);
+    if(cache->free_cnt[cls] > CACHE_LIMIT) cache_flush(cache, cls);
+    CACHE_UNLOCK();
+}
+
+void * lv_mem_slab_realloc(void * p, size_t new_size)
+{
+    if(p == NULL) return lv_mem_slab_alloc(new_size);
+
+    slab_header_t * header = (slab_header_t *)p - 1;
+    if(header->cls == 0) {
+        if(new_size > SIZE_MAX - HEADER_SIZE) return NULL;
+        slab_header_t * new_header = lv_realloc_core(header, new_size + HEADER_SIZE);
+        if(new_header == NULL) return NULL;
+        return new_header + 1;
+    }
+
+    uint32_t cls = header->cls - 1;
+    if(new_size <= class_size[cls]) {
+        SLAB_POISON(p, class_size[cls]);
+        SLAB_UNPOISON(p, new_size);
+        return p;
+    }
+
+    void * new_p = lv_mem_slab_alloc(new_size);
+    if(new_p == NULL) return NULL;
+
+    /*The original size is not known, so copy the whole block*/
+    SLAB_UNPOISON(p, class_size[cls]);
+    lv_memcpy(new_p, p, class_size[cls]);
+    lv_mem_slab_free(p);
+    return new_p;
+}
+
+void lv_mem_slab_monitor(lv_mem_monitor_t * mon_p)
+{
+    if(!state.inited) return;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.lock);
+#endif
+
+    size_t free_size = 0;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        free_size += (size_t)state.free_cnt[i] * class_size[i];
+    }
+
+    /*The counters of the other threads are read without their knowledge, so they are approximate*/
+    lv_mem_slab_cache_t * cache;
+    for(cache = state.cache_head; cache; cache = cache->next) {
+        for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+            free_size += (size_t)cache->free_cnt[i] * class_size[i];
+        }
+        for(i = 0; i < LV_MEM_SIZE_HISTOGRAM_CNT; i++) {
+            mon_p->size_histogram[i] += cache->size_histogram[i];
+        }
+    }
+
+    mon_p->slab_size = state.span_cnt * LV_MEM_SLAB_SPAN_SIZE;
+    mon_p->slab_free_size = free_size;
+
+#if LV_USE_OS
+    lv_mutex_unlock(&state.lock);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Allocate a block with a header from the heap
+ * @param size      the requested size
+ * @return          the block after the header or NULL on failure
+ */
+static void * core_alloc(size_t size)
+{
+    if(size > SIZE_MAX - HEADER_SIZE) return NULL;
+
+    slab_header_t * header = lv_malloc_core(size + HEADER_SIZE);
+    if(header == NULL) return NULL;
+
+    header->cls = 0;
+    return header + 1;
+}
+
+/**
+ * Get the cache of the current thread and create it on the first call
+ * @return          the cache or NULL if it couldn't be allocated
+ */
+static lv_mem_slab_cache_t * cache_get(void)
+{
+#if SLAB_USE_TLS
+    if(tls_cache && tls_generation == generation) return tls_cache;
+
+    lv_mem_slab_cache_t * cache = lv_malloc_core(sizeof(lv_mem_slab_cache_t));
+    if(cache == NULL) return NULL;
+    lv_memzero(cache, sizeof(lv_mem_slab_cache_t));
+
+    lv_mutex_lock(&state.lock);
+    cache->next = state.cache_head;
+    state.cache_head = cache;
+    lv_mutex_unlock(&state.lock);
+
+    tls_cache = cache;
+    tls_generation = generation;
+#if SLAB_USE_TLS_DESTRUCTOR
+    pthread_setspecific(state.cache_key, cache);
+#endif
+    return cache;
+#else
+    return &state.shared_cache;
+#endif
+}
+
+/**
+ * Read the link of a free block
+ * @param p         pointer to a free block
+ * @return          the next free block
+ */
+static inline void * block_get_next(void * p)
+{
+    SLAB_UNPOISON(p, sizeof(void *));
+    void * next = *(void **)p;
+    SLAB_POISON(p, sizeof(void *));
+    return next;
+}
+
+/**
+ * Set the link of a free block
+ * @param p         pointer to a free block
+ * @param next      the next free block
+ */
+static inline void block_set_next(void * p, void * next)
+{
+    SLAB_UNPOISON(p, sizeof(void *));
+    *(void **)p = next;
+    SLAB_POISON(p, sizeof(void *));
+}
+
+/**
+ * Take a free block of a size class from a cache
+ * @param cache     the cache of the thread
+ * @param cls       index of the size class
+ * @return          the block or NULL if no new span could be allocated
+ */
+static void * cache_pop(lv_mem_slab_cache_t * cache, uint32_t cls)
+{
+    if(cache->free_head[cls] == NULL && !cache_refill(cache, cls)) return NULL;
+
+    void * p = cache->free_head[cls];
+    cache->free_head[cls] = block_get_next(p);
+    cache->free_cnt[cls]--;
+    return p;
+}
+
+/**
+ * Put a block into the free list of a cache
+ * @param cache     the cache of the thread or NULL to use the shared list
+ * @param cls       index of the size class
+ * @param p         the block to free
+ */
+static void cache_push(lv_mem_slab_cache_t * cache, uint32_t cls, void * p)
+{
+    void ** head = cache ? &cache->free_head[cls] : &state.free_head[cls];
+    uint32_t * cnt = cache ? &cache->free_cnt[cls] : &state.free_cnt[cls];
+
+    SLAB_POISON(p, class_size[cls]);
+    block_set_next(p, *head);
+    *head = p;
+    (*cnt)++;
+}
+
+/**
+ * Move a batch of free blocks from the shared list to an empty cache
+ * @param cache     the cache of the thread
+ * @param cls       index of the size class
+ * @return          true if at least one block was moved
+ */
+static bool cache_refill(lv_mem_slab_cache_t * cache, uint32_t cls)
+{
+    SHARED_LOCK();
+    if(state.free_head[cls] == NULL) span_add(cls);
+
+    void * first = state.free_head[cls];
+    if(first) {
+        void * last = first;
+        uint32_t cnt = 1;
+        while(cnt < BATCH_CNT) {
+            void * next = block_get_next(last);
+            if(next == NULL) break;
+            last = next;
+            cnt++;
+        }
+
+        state.free_head[cls] = block_get_next(last);
+        state.free_cnt[cls] -= cnt;
+        block_set_next(last, cache->free_head[cls]);
+        cache->free_head[cls] = first;
+        cache->free_cnt[cls] += cnt;
+    }
+    SHARED_UNLOCK();
+
+    return first != NULL;
+}
+
+/**
+ * Give a batch of free blocks from a cache back to the shared list
+ * @param cache     the cache of the thread, having more than `BATCH_CNT` blocks
+ * @param cls       index of the size class
+ */
+static void cache_flush(lv_mem_slab_cache_t * cache, uint32_t cls)
+{
+    /*Keep the most recently freed block as it's likely to be used again soon*/
+    void * head = cache->free_head[cls];
+    void * first = block_get_next(head);
+    void * last = first;
+    uint32_t i;
+    for(i = 1; i < BATCH_CNT; i++) {
+        last = block_get_next(last);
+    }
+
+    block_set_next(head, block_get_next(last));
+    cache->free_cnt[cls] -= BATCH_CNT;
+
+    SHARED_LOCK();
+    block_set_next(last, state.free_head[cls]);
+    state.free_head[cls] = first;
+    state.free_cnt[cls] += BATCH_CNT;
+    SHARED_UNLOCK();
+}
+
+/**
+ * Allocate a new span and divide it into free blocks of a size class on the shared list
+ * @param cls       index of the size class
+ */
+static void span_add(uint32_t cls)
+{
+    uint8_t * span = lv_malloc_core(LV_MEM_SLAB_SPAN_SIZE);
+    if(span == NULL) {
+        LV_LOG_WARN("couldn't allocate a %d bytes span", LV_MEM_SLAB_SPAN_SIZE);
+        return;
+    }
+
+    ((slab_header_t *)span)->next_span = state.span_head;
+    state.span_head = span;
+    state.span_cnt++;
+
+    /*The first block comes after the link of the spans and its header,
+     *aligned even if the heap returns less aligned memory*/
+    uint8_t * first = (uint8_t *)LV_ALIGN_UP((lv_uintptr_t)span + 2 * HEADER_SIZE, LV_MEM_SLAB_ALIGN);
+    uint32_t stride = class_size[cls] + HEADER_SIZE;
+    uint32_t cnt = (uint32_t)(span + LV_MEM_SLAB_SPAN_SIZE - (first - HEADER_SIZE)) / stride;
+
+    /*Link the blocks in address order*/
+    void * head = state.free_head[cls];
+    uint32_t i;
+    for(i = cnt; i > 0; i--) {
+        void * p = first + (i - 1) * stride;
+        slab_header_t * header = (slab_header_t *)p - 1;
+        header->cls = cls + 1;
+        *(void **)p = head;
+        SLAB_POISON(p, class_size[cls]);
+        head = p;
+    }
+
+    state.free_head[cls] = head;
+    state.free_cnt[cls] += cnt;
+}
+
+/**
+ * Get the bin of the size histogram
+ * @param size      the requested size
+ * @return          index of the bin
+ */
+static uint32_t histogram_bin(size_t size)
+{
+    uint32_t bin = 0;
+    size_t limit = 16;
+    while(size > limit && bin < LV_MEM_SIZE_HISTOGRAM_CNT - 1) {
+        limit <<= 1;
+        bin++;
+    }
+    return bin;
+}
+
+#if SLAB_USE_TLS_DESTRUCTOR
+/**
+ * Give the free blocks of an exiting thread back to the shared lists and free its cache.
+ * Called by pthread as the destructor of `state.cache_key`.
+ * @param p         the cache of the exiting thread
+ */
+static void cache_release_cb(void * p)
+{
+    lv_mem_slab_cache_t * cache = p;
+
+    lv_mutex_lock(&state.lock);
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        void * first = cache->free_head[i];
+        if(first == NULL) continue;
+
+        void * last = first;
+        void * next;
+        while((next = block_get_next(last)) != NULL) last = next;
+
+        block_set_next(last, state.free_head[i]);
+        state.free_head[i] = first;
+        state.free_cnt[i] += cache->free_cnt[i];
+    }
+
+    /*Keep the statistics of the thread*/
+    for(i = 0; i < LV_MEM_SIZE_HISTOGRAM_CNT; i++) {
+        state.shared_cache.size_histogram[i] += cache->size_histogram[i];
+    }
+
+    lv_mem_slab_cache_t ** link = &state.cache_head;
+    while(*link != cache) link = &(*link)->next;
+    *link = cache->next;
+    lv_mutex_unlock(&state.lock);
+
+    lv_free_core(cache);
+
+    /*The thread might still free memory in other destructors*/
+    tls_cache = NULL;
+}
+#endif
+
+#endif /*LV_USE_MEM_SLAB*/
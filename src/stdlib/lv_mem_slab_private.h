@@ -0,0 +1,119 @@
+/**
+ * @file lv_mem_slab_private.h
+ *
+ */
+
+#ifndef LV_MEM_SLAB_PRIVATE_H
+#define LV_MEM_SLAB_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lvgl_public.h"
+
+#if LV_USE_MEM_SLAB
+
+#include "../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of size classes. The largest class is `LV_MEM_SLAB_MAX_SIZE` bytes*/
+#define LV_MEM_SLAB_CLASS_CNT   10
+
+/** Larger allocations are passed to `lv_malloc_core()`*/
+#define LV_MEM_SLAB_MAX_SIZE    256
+
+/** Alignment of the returned pointers. The block headers and the size classes are its multiples.*/
+#define LV_MEM_SLAB_ALIGN       16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Free blocks and statistics of a thread.
+ * The owner thread uses it without locking.
+ */
+typedef struct _lv_mem_slab_cache_t {
+    struct _lv_mem_slab_cache_t * next;             /**< All caches are linked to collect the statistics*/
+    void * free_head[LV_MEM_SLAB_CLASS_CNT];        /**< Free blocks of each size class*/
+    uint32_t free_cnt[LV_MEM_SLAB_CLASS_CNT];
+    uint32_t size_histogram[LV_MEM_SIZE_HISTOGRAM_CNT];
+} lv_mem_slab_cache_t;
+
+typedef struct {
+    bool inited;
+#if LV_USE_OS
+    lv_mutex_t lock;                                /**< Protects the shared lists below*/
+#endif
+    void * free_head[LV_MEM_SLAB_CLASS_CNT];        /**< Free blocks given back by the thread caches*/
+    uint32_t free_cnt[LV_MEM_SLAB_CLASS_CNT];
+    void * span_head;                               /**< Memory taken from the heap, linked through their first word*/
+    size_t span_cnt;
+    lv_mem_slab_cache_t * cache_head;
+    lv_mem_slab_cache_t shared_cache;               /**< Used by all threads if there is no thread local storage*/
+#if LV_USE_OS == LV_OS_PTHREAD
+    pthread_key_t cache_key;                        /**< Its destructor gives back the cache of an exiting thread*/
+#endif
+} lv_mem_slab_state_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the small object allocator. Before it, all allocations are passed to the heap.
+ */
+void lv_mem_slab_init(void);
+
+/**
+ * Give all the memory of the small object allocator back to the heap.
+ * The small blocks must not be used after it.
+ */
+void lv_mem_slab_deinit(void);
+
+/**
+ * Allocate from a size class or if it's too large from the heap
+ * @param size      size in bytes, not 0
+ * @return          the allocated memory or NULL on failure
+ */
+void * lv_mem_slab_alloc(size_t size);
+
+/**
+ * Free a memory allocated by ::lv_mem_slab_alloc
+ * @param p         pointer to the memory
+ */
+void lv_mem_slab_free(void * p);
+
+/**
+ * Reallocate a memory allocated by ::lv_mem_slab_alloc
+ * @param p         pointer to the memory or NULL to allocate a new one
+ * @param new_size  the new size in bytes, not 0
+ * @return          the reallocated memory or NULL on failure (`p` is kept)
+ */
+void * lv_mem_slab_realloc(void * p, size_t new_size);
+
+/**
+ * Add the statistics of the small object allocator
+ * @param mon_p     store the statistics here
+ */
+void lv_mem_slab_monitor(lv_mem_monitor_t * mon_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SLAB_PRIVATE_H*/
@@ -615,6 +615,13 @@ static void style_init(my_theme_t * theme)
     lv_style_set_arc_width(&theme->styles.scale, LV_DPX_CALC(theme->disp_dpi, 2));
     lv_style_set_length(&theme->styles.scale, LV_DPX_CALC(theme->disp_dpi, 6));
 #endif
+
+    /*The theme styles are read very often, so sort their properties for faster lookups*/
+    lv_style_t * theme_styles = (lv_style_t *)(&(theme->styles));
+    uint32_t i;
+    for(i = 0; i < sizeof(my_theme_styles_t) / sizeof(lv_style_t); i++) {
+        lv_style_freeze(theme_styles + i);
+    }
 }
 
 /**********************
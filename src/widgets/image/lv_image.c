@@ -12,6 +12,7 @@
 
 #include "../../misc/lv_area_private.h"
 #include "../../misc/lv_text_private.h"
+#include "../../misc/lv_str_intern_private.h"
 #include "../../draw/lv_draw_image_private.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_obj_event_private.h"
@@ -40,6 +41,13 @@ static void scale_update(lv_obj_t * obj, int32_t scale_x, int32_t scale_y);
 static void update_align(lv_obj_t * obj);
 static void reset_image_attributes(lv_obj_t * obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static bool decode_async_check(lv_obj_t * obj);
+    static void decode_async_reset(lv_obj_t * obj);
+    static void decode_ready_cb(const void * src, lv_result_t res, void * user_data);
+    static void placeholder_draw(lv_obj_t * obj, lv_layer_t * layer, lv_draw_image_dsc_t * draw_dsc);
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 #if LV_USE_OBSERVER
     static void image_src_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
 #endif /*LV_USE_OBSERVER*/
@@ -150,6 +158,10 @@ void lv_image_set_src(lv_obj_t * obj, const void * src)
 
     lv_obj_invalidate(obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    decode_async_reset(obj);
+#endif
+
     lv_image_src_t src_type = lv_image_src_get_type(src);
     lv_image_t * img = (lv_image_t *)obj;
 
@@ -200,28 +212,28 @@ void lv_image_set_src(lv_obj_t * obj, const void * src)
             }
         }
 
-        /*If memory was allocated because of the previous `src_type` then free it*/
+        /*If the string was interned because of the previous `src_type` then release it*/
         if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_SYMBOL) {
-            lv_free((void *)img->src);
+            lv_str_intern_release(img->src);
         }
         img->src = src;
     }
     else if(src_type == LV_IMAGE_SRC_FILE || src_type == LV_IMAGE_SRC_SYMBOL) {
         /*If the new and the old src are the same then it was only a refresh.*/
         if(img->src != src) {
-            const void * old_src = NULL;
-            /*If memory was allocated because of the previous `src_type` then save its pointer and free after allocation.
-             *It's important to allocate first to be sure the new data will be on a new address.
-             *Else `img_cache` wouldn't see the change in source.*/
+            const char * old_src = NULL;
+            /*If the string was interned because of the previous `src_type` then save its pointer and release it
+             *only after interning the new one. This way a string used by both is not freed in between.
+             *Images using the same path share one copy of it.*/
             if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_SYMBOL) {
                 old_src = img->src;
             }
-            char * new_str = lv_strdup(src);
+            const char * new_str = lv_str_intern(src);
             LV_ASSERT_MALLOC(new_str);
             if(new_str == NULL) return;
             img->src = new_str;
 
-            if(old_src) lv_free((void *)old_src);
+            lv_str_intern_release(old_src);
         }
     }
 
@@ -482,6 +494,31 @@ void lv_image_set_bitmap_map_src(lv_obj_t * obj, const lv_image_dsc_t * src)
     lv_obj_invalidate(obj);
 }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+void lv_image_set_decode_async(lv_obj_t * obj, bool en)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->decode_async == (uint32_t)en) return;
+
+    decode_async_reset(obj);
+    img->decode_async = en;
+    lv_obj_invalidate(obj);
+}
+
+void lv_image_set_placeholder_src(lv_obj_t * obj, const lv_image_dsc_t * src)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->placeholder_src == src) return;
+
+    img->placeholder_src = src;
+    if(lv_image_is_decode_pending(obj)) lv_obj_invalidate(obj);
+}
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /*=====================
  * Getter functions
  *====================*/
@@ -647,6 +684,42 @@ const lv_image_dsc_t * lv_image_get_bitmap_map_src(lv_obj_t * obj)
     return img->bitmap_mask_src;
 }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+bool lv_image_get_decode_async(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return false);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->decode_async;
+}
+
+const lv_image_dsc_t * lv_image_get_placeholder_src(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return NULL);
+
+    lv_image_t * img = (lv_image_t *)obj;
+
+    return img->placeholder_src;
+}
+
+bool lv_image_is_decode_pending(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return false);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    if(!img->decode_async || img->decode_ready) return false;
+
+    /*Plain C arrays are used as they are, only the encoded ones (e.g. PNG arrays) are decoded*/
+    if(img->src_type == LV_IMAGE_SRC_FILE) return true;
+    if(img->src_type == LV_IMAGE_SRC_VARIABLE) {
+        return img->cf == LV_COLOR_FORMAT_RAW || img->cf == LV_COLOR_FORMAT_RAW_ALPHA;
+    }
+
+    return false;
+}
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 
 #if LV_USE_OBSERVER
 lv_observer_t * lv_image_bind_src(lv_obj_t * obj, lv_subject_t * subject)
@@ -699,8 +772,13 @@ static void lv_image_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_image_t * img = (lv_image_t *)obj;
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    decode_async_reset(obj);
+#endif
+
     if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_SYMBOL) {
-        lv_free((void *)img->src);
+        lv_str_intern_release(img->src);
         img->src      = NULL;
         img->src_type = LV_IMAGE_SRC_UNKNOWN;
     }
@@ -805,6 +883,14 @@ static void draw_image(lv_event_t * e)
             return;
         }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+        /*Only the placeholder might be drawn*/
+        if(lv_image_is_decode_pending(obj)) {
+            info->res = LV_COVER_RES_NOT_COVER;
+            return;
+        }
+#endif
+
         /*Non true color format might have "holes"*/
         if(lv_color_format_has_alpha(img->cf)) {
             info->res = LV_COVER_RES_NOT_COVER;
@@ -914,6 +1000,14 @@ static void draw_image(lv_event_t * e)
                 coords = draw_dsc.image_area;
             }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+            if(!decode_async_check(obj)) {
+                placeholder_draw(obj, layer, &draw_dsc);
+                layer->_clip_area = clip_area_ori;
+                return;
+            }
+#endif
+
             lv_draw_image(layer, &draw_dsc, &coords);
             layer->_clip_area = clip_area_ori;
         }
@@ -1041,7 +1135,7 @@ static void reset_image_attributes(lv_obj_t * obj)
 {
     lv_image_t * img = (lv_image_t *)obj;
     if(img->src_type == LV_IMAGE_SRC_SYMBOL || img->src_type == LV_IMAGE_SRC_FILE) {
-        lv_free((void *)img->src);
+        lv_str_intern_release(img->src);
     }
     img->src = NULL;
     img->src_type = LV_IMAGE_SRC_UNKNOWN;
@@ -1052,6 +1146,94 @@ static void reset_image_attributes(lv_obj_t * obj)
 }
 
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Check if the image can be drawn and request its decoding in the background if not.
+ * @param obj   pointer to an image object
+ * @return      true: draw the image; false: draw the placeholder
+ */
+static bool decode_async_check(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(!lv_image_is_decode_pending(obj)) return true;
+
+    if(lv_image_decoder_async_request(img->src, decode_ready_cb, obj)) {
+        img->decode_ready = 1;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Forget the result of the background decoding, e.g. because the source has changed.
+ * @param obj   pointer to an image object
+ */
+static void decode_async_reset(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(!img->decode_async) return;
+
+    lv_image_decoder_async_cancel(decode_ready_cb, obj);
+    img->decode_ready = 0;
+}
+
+/**
+ * Called when the image of an image object is decoded in the background
+ * @param src       the decoded image source
+ * @param res       the result of the decoding. On error the error is shown when drawn directly.
+ * @param user_data pointer to the image object
+ */
+static void decode_ready_cb(const void * src, lv_result_t res, void * user_data)
+{
+    LV_UNUSED(src);
+    LV_UNUSED(res);
+
+    lv_obj_t * obj = user_data;
+    lv_image_t * img = (lv_image_t *)obj;
+    img->decode_ready = 1;
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Draw the placeholder image stretched to the area and transformation of the image
+ * @param obj       pointer to an image object
+ * @param layer     the layer to draw to
+ * @param draw_dsc  the draw descriptor of the image. Modified to draw the placeholder.
+ */
+static void placeholder_draw(lv_obj_t * obj, lv_layer_t * layer, lv_draw_image_dsc_t * draw_dsc)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    const lv_image_dsc_t * ph = img->placeholder_src;
+    if(ph == NULL || draw_dsc->tile) return;
+
+    int32_t ph_w = ph->header.w;
+    int32_t ph_h = ph->header.h;
+    if(ph_w <= 0 || ph_h <= 0) return;
+
+    /*Scale the placeholder to the size of the image and move it to keep the pivot
+     *at the same place. This way the rotation and scaling of the image is applied too.*/
+    lv_point_t pivot = draw_dsc->pivot;
+    draw_dsc->pivot.x = pivot.x * ph_w / img->w;
+    draw_dsc->pivot.y = pivot.y * ph_h / img->h;
+    draw_dsc->scale_x = draw_dsc->scale_x * img->w / ph_w;
+    draw_dsc->scale_y = draw_dsc->scale_y * img->h / ph_h;
+
+    lv_area_t coords;
+    coords.x1 = draw_dsc->image_area.x1 + pivot.x - draw_dsc->pivot.x;
+    coords.y1 = draw_dsc->image_area.y1 + pivot.y - draw_dsc->pivot.y;
+    coords.x2 = coords.x1 + ph_w - 1;
+    coords.y2 = coords.y1 + ph_h - 1;
+
+    draw_dsc->image_area = coords;
+    draw_dsc->src = ph;
+    draw_dsc->bitmap_mask_src = NULL;
+    lv_draw_image(layer, draw_dsc, &coords);
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 #if LV_USE_OBSERVER
 
 static void image_src_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
@@ -30,6 +30,7 @@
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_BEGIN_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_LINE_CACHE_MIN_LINES 8 /*Store the line breaks of texts with at least this many lines*/
 
 /**********************
  *      TYPEDEFS
@@ -800,6 +801,9 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_free(&label->lines);
+#endif
 #if LV_USE_TRANSLATION
     if(label->translation_tag) lv_free(label->translation_tag);
     label->translation_tag = NULL;
@@ -982,6 +986,20 @@ static void draw_main(lv_event_t * e)
         txt_coords.y2 = obj->coords.y2;
     }
 
+#if LV_LABEL_LINE_CACHE
+    /*Wrap long texts only when they change and not in every frame. The hint is not needed then.*/
+    int32_t line_height = lv_font_get_line_height(label_draw_dsc.font) + label_draw_dsc.line_space;
+    if(label->text_size.y >= line_height * LV_LABEL_LINE_CACHE_MIN_LINES) {
+        if(lv_draw_label_lines_update(&label->lines, &label_draw_dsc, &txt_coords)) {
+            label_draw_dsc.lines = &label->lines;
+            label_draw_dsc.hint = NULL;
+        }
+    }
+    else if(label->lines.lines) {
+        lv_draw_label_lines_free(&label->lines);
+    }
+#endif
+
     /*Clip to the text in some cases to avoid ugly overflows*/
     if(label->long_mode == LV_LABEL_LONG_MODE_SCROLL ||
        label->long_mode == LV_LABEL_LONG_MODE_SCROLL_CIRCULAR ||
@@ -1115,6 +1133,9 @@ static void lv_label_mark_need_refr_text(lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
     if(label->text == NULL) return;
     label->invalid_size_cache = true;
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines);
+#endif
 
     lv_obj_invalidate(obj);
 
@@ -1158,6 +1179,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines); /*The text might be modified in place*/
+#endif
 
     lv_area_t txt_coords;
     lv_text_attributes_t attributes = {0};
@@ -42,6 +42,10 @@ struct _lv_label_t {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_t lines;        /**< Line breaks of long texts calculated when the text changes*/
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
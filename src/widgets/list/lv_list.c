@@ -8,7 +8,7 @@
  *********************/
 
 
-#include "../../lvgl_public.h"
+#include "lv_list_private.h"
 
 #if LV_USE_LIST
 
@@ -21,6 +21,9 @@
 #define MY_CLASS_BUTTON (&lv_list_button_class)
 #define MY_CLASS_TEXT   (&lv_list_text_class)
 
+/*Number of item widgets to keep ready above and below the visible area*/
+#define OVERSCAN_ITEM_CNT   2
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -28,10 +31,21 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void update_items(lv_obj_t * obj, bool rebind_all);
+static bool create_items(lv_obj_t * obj, uint32_t cnt);
+static void delete_items(lv_obj_t * obj);
+static void remove_deleted_items(lv_obj_t * obj);
+static int32_t get_item_stride(lv_obj_t * obj);
+
 const lv_obj_class_t lv_list_class = {
+    .destructor_cb = lv_list_destructor,
+    .event_cb = lv_list_event,
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
     .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_list_t),
     .name = "lv_list",
 };
 
@@ -132,6 +146,105 @@ void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt)
     }
 }
 
+void lv_list_set_item_cb(lv_obj_t * obj, lv_list_item_create_cb_t create_cb, lv_list_item_bind_cb_t bind_cb)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*The item widgets might be created differently, so start again*/
+    delete_items(obj);
+    list->item_create_cb = create_cb;
+    list->item_bind_cb = bind_cb;
+    list->item_h_act = list->item_h;
+
+    if(bind_cb) lv_obj_set_layout(obj, LV_LAYOUT_NONE);
+    else lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
+
+    update_items(obj, true);
+    lv_obj_refresh_self_size(obj);
+}
+
+void lv_list_set_item_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    if(list->item_cnt == cnt) return;
+    list->item_cnt = cnt;
+
+    update_items(obj, false);
+    lv_obj_refresh_self_size(obj);
+
+    /*Don't stay scrolled below the last item, like when children are deleted*/
+    obj->readjust_scroll_after_layout = 1;
+    lv_obj_mark_layout_as_dirty(obj);
+}
+
+void lv_list_set_item_height(lv_obj_t * obj, int32_t h)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    list->item_h = LV_MAX(h, 0);
+    list->item_h_act = list->item_h;
+
+    if(list->item_h > 0) {
+        uint32_t i;
+        for(i = 0; i < list->item_obj_cnt; i++) {
+            lv_obj_set_height(list->items[i], list->item_h);
+        }
+    }
+
+    update_items(obj, true);
+    lv_obj_refresh_self_size(obj);
+}
+
+void lv_list_refresh_items(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    update_items(obj, true);
+}
+
+uint32_t lv_list_get_item_count(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return 0);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    return list->item_cnt;
+}
+
+uint32_t lv_list_get_item_index(lv_obj_t * obj, lv_obj_t * item)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return LV_LIST_ITEM_NONE);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*Find the item widget if a child of it was passed, e.g. the target of an event*/
+    while(item && lv_obj_get_parent(item) != obj) {
+        item = lv_obj_get_parent(item);
+    }
+    if(item == NULL) return LV_LIST_ITEM_NONE;
+
+    uint32_t i;
+    for(i = 0; i < list->item_obj_cnt; i++) {
+        if(list->items[i] == item) return list->item_ids[i];
+    }
+
+    return LV_LIST_ITEM_NONE;
+}
+
+lv_obj_t * lv_list_get_item(lv_obj_t * obj, uint32_t index)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return NULL);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    if(list->item_obj_cnt == 0 || index >= list->item_cnt) return NULL;
+
+    /*The item widgets are used in a ring: item `i` can be shown only by widget `i % item_obj_cnt`*/
+    uint32_t slot = index % list->item_obj_cnt;
+    return list->item_ids[slot] == index ? list->items[slot] : NULL;
+}
+
 #if LV_USE_TRANSLATION
 
 lv_obj_t * lv_list_add_translation_tag(lv_obj_t * list, const char * tag)
@@ -172,4 +285,241 @@ void lv_list_set_button_translation_tag(lv_obj_t * list, lv_obj_t * btn, const c
  *   STATIC FUNCTIONS
  **********************/
 
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*The item widgets are deleted with the other children*/
+    lv_free(list->items);
+    lv_free(list->item_ids);
+    list->items = NULL;
+    list->item_ids = NULL;
+    list->item_obj_cnt = 0;
+}
+
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->item_bind_cb == NULL) return;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*The content is as high as if all the items were created*/
+        lv_point_t * p = lv_event_get_param(e);
+        if(list->item_cnt > 0 && list->item_h_act > 0) {
+            int32_t h = (int32_t)list->item_cnt * get_item_stride(obj) - lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+            p->y = LV_MAX(p->y, h);
+        }
+    }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        update_items(obj, false);
+    }
+    else if(code == LV_EVENT_CHILD_DELETED) {
+        remove_deleted_items(obj);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        /*The gap between the items might be changed*/
+        update_items(obj, true);
+        lv_obj_refresh_self_size(obj);
+    }
+}
+
+/**
+ * Show the items in the visible area of a virtual list, create item widgets if required,
+ * and reuse the item widgets of the items scrolled out.
+ * @param obj           pointer to a list
+ * @param rebind_all    true: show the items again even if they are already shown in the same widget
+ */
+static void update_items(lv_obj_t * obj, bool rebind_all)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->item_bind_cb == NULL || list->item_cnt == 0) {
+        uint32_t i;
+        for(i = 0; i < list->item_obj_cnt; i++) {
+            lv_obj_set_hidden(list->items[i], true);
+            list->item_ids[i] = LV_LIST_ITEM_NONE;
+        }
+        return;
+    }
+
+    LV_PROFILER_BEGIN;
+
+    /*Measure the first item if the height of the items is not set*/
+    if(list->item_h_act <= 0) {
+        if(list->item_obj_cnt == 0 && !create_items(obj, 1)) {
+            LV_PROFILER_END;
+            return;
+        }
+
+        lv_obj_t * item = list->items[0];
+        lv_obj_set_y(item, 0);
+        lv_obj_set_hidden(item, false);
+        list->item_ids[0] = 0;
+        list->item_bind_cb(obj, item, 0);
+        lv_obj_update_layout(item);
+        list->item_h_act = lv_obj_get_height(item);
+
+        /*Can't be measured during layout update, it will be tried again on the next event*/
+        if(list->item_h_act <= 0) {
+            LV_PROFILER_END;
+            return;
+        }
+
+        lv_obj_refresh_self_size(obj);
+    }
+
+    int32_t stride = get_item_stride(obj);
+
+    /*Cover the visible area even if the items are scrolled by almost a whole item*/
+    uint32_t needed = (uint32_t)(lv_obj_get_content_height(obj) / stride) + 2 + 2 * OVERSCAN_ITEM_CNT;
+    needed = LV_MIN(needed, list->item_cnt);
+    if(needed > list->item_obj_cnt) {
+        if(!create_items(obj, needed - list->item_obj_cnt)) {
+            LV_PROFILER_END;
+            return;
+        }
+        /*The item widgets are assigned to other items*/
+        rebind_all = true;
+    }
+
+    /*Show `item_obj_cnt` items starting a little above the visible area*/
+    uint32_t obj_cnt = list->item_obj_cnt;
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+    uint32_t first = scroll_y > 0 ? (uint32_t)(scroll_y / stride) : 0;
+    first = first > OVERSCAN_ITEM_CNT ? first - OVERSCAN_ITEM_CNT : 0;
+    if(list->item_cnt > obj_cnt) first = LV_MIN(first, list->item_cnt - obj_cnt);
+    else first = 0;
+
+    uint32_t slot;
+    for(slot = 0; slot < obj_cnt; slot++) {
+        /*The only item in the range which can be shown by this widget*/
+        uint32_t index = first + (slot + obj_cnt - first % obj_cnt) % obj_cnt;
+        lv_obj_t * item = list->items[slot];
+
+        if(index >= list->item_cnt) {
+            lv_obj_set_hidden(item, true);
+            list->item_ids[slot] = LV_LIST_ITEM_NONE;
+        }
+        else if(rebind_all || list->item_ids[slot] != index) {
+            list->item_ids[slot] = index;
+            lv_obj_set_y(item, (int32_t)index * stride);
+            lv_obj_set_hidden(item, false);
+            list->item_bind_cb(obj, item, index);
+        }
+    }
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Create new item widgets for a virtual list
+ * @param obj       pointer to a list
+ * @param cnt       number of widgets to create
+ * @return          true: success; false: out of memory
+ */
+static bool create_items(lv_obj_t * obj, uint32_t cnt)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    uint32_t new_cnt = list->item_obj_cnt + cnt;
+    lv_obj_t ** items = lv_realloc(list->items, new_cnt * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(items);
+    if(items == NULL) return false;
+    list->items = items;
+
+    uint32_t * item_ids = lv_realloc(list->item_ids, new_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(item_ids);
+    if(item_ids == NULL) return false;
+    list->item_ids = item_ids;
+
+    uint32_t i;
+    for(i = list->item_obj_cnt; i < new_cnt; i++) {
+        lv_obj_t * item = list->item_create_cb ? list->item_create_cb(obj) : lv_list_add_button(obj, NULL, "");
+        LV_ASSERT_NULL(item);
+        if(item == NULL) return false;
+        LV_ASSERT_MSG(lv_obj_get_parent(item) == obj, "The item widgets need to be the children of the list");
+
+        if(list->item_h > 0) lv_obj_set_height(item, list->item_h);
+        lv_obj_set_hidden(item, true);
+        list->items[i] = item;
+        list->item_ids[i] = LV_LIST_ITEM_NONE;
+        list->item_obj_cnt = i + 1;
+    }
+
+    return true;
+}
+
+/**
+ * Delete the item widgets of a virtual list
+ * @param obj       pointer to a list
+ */
+static void delete_items(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*Forget the widgets first to not handle their `LV_EVENT_CHILD_DELETED`*/
+    lv_obj_t ** items = list->items;
+    uint32_t item_obj_cnt = list->item_obj_cnt;
+    lv_free(list->item_ids);
+    list->items = NULL;
+    list->item_ids = NULL;
+    list->item_obj_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < item_obj_cnt; i++) {
+        lv_obj_delete(items[i]);
+    }
+    lv_free(items);
+}
+
+/**
+ * Forget the item widgets which were deleted from a virtual list, e.g. by `lv_obj_clean`
+ * @param obj       pointer to a list
+ */
+static void remove_deleted_items(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+
+    /*Only compare the pointers as the deleted widgets can't be accessed*/
+    uint32_t i;
+    uint32_t kept_cnt = 0;
+    for(i = 0; i < list->item_obj_cnt; i++) {
+        uint32_t c;
+        for(c = 0; c < child_cnt; c++) {
+            if(obj->spec_attr->children[c] == list->items[i]) break;
+        }
+        if(c == child_cnt) continue;
+
+        list->items[kept_cnt] = list->items[i];
+        list->item_ids[kept_cnt] = list->item_ids[i];
+        kept_cnt++;
+    }
+
+    if(kept_cnt == list->item_obj_cnt) return;
+
+    /*The ring of the item widgets has changed*/
+    list->item_obj_cnt = kept_cnt;
+    update_items(obj, true);
+}
+
+/**
+ * Get the distance between the top of the neighboring items of a virtual list
+ * @param obj       pointer to a list
+ * @return          the distance
+ */
+static int32_t get_item_stride(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    return LV_MAX(list->item_h_act + lv_obj_get_style_pad_row(obj, LV_PART_MAIN), 1);
+}
+
 #endif /*LV_USE_LIST*/
@@ -0,0 +1,58 @@
+/**
+ * @file lv_list_private.h
+ *
+ */
+
+#ifndef LV_LIST_PRIVATE_H
+#define LV_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../core/lv_obj_private.h"
+#include "../../lvgl_public.h"
+
+#if LV_USE_LIST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Data of list */
+struct _lv_list_t {
+    lv_obj_t obj;
+    lv_list_item_create_cb_t item_create_cb;    /**< Creates the item widgets in virtual mode */
+    lv_list_item_bind_cb_t item_bind_cb;        /**< Shows an item in an item widget, not NULL in virtual mode */
+    lv_obj_t ** items;                          /**< The created item widgets */
+    uint32_t * item_ids;                        /**< Index of the item shown by each item widget */
+    uint32_t item_obj_cnt;                      /**< Number of the created item widgets */
+    uint32_t item_cnt;                          /**< Number of items in virtual mode */
+    int32_t item_h;                             /**< Height of the items set by the user, 0: height of the first item */
+    int32_t item_h_act;                         /**< Height of the items in use, 0: not known yet */
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_LIST != 0 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LIST_PRIVATE_H*/
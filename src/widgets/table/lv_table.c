@@ -45,6 +45,14 @@ static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
 static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t * area);
 static void scroll_to_selected_cell(lv_obj_t * obj);
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row);
+static int32_t get_row_h(lv_obj_t * obj, uint32_t row);
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y, int32_t * row_y);
+static void virtual_rows_reset(lv_obj_t * obj);
+static void virtual_rows_resize(lv_obj_t * obj, uint32_t old_row_cnt);
+static void measure_visible_rows(lv_obj_t * obj);
+static int32_t row_h_tree_sum(const int32_t * tree, uint32_t row_cnt);
+static void row_h_tree_fill(int32_t * tree, uint32_t start, uint32_t end, int32_t h);
 
 static inline bool is_cell_empty(void * cell)
 {
@@ -109,6 +117,10 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
     LV_ASSERT_NULL(txt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        LV_LOG_WARN("the cells can't be modified in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -144,6 +156,10 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        LV_LOG_WARN("the cells can't be modified in virtual mode");
+        return;
+    }
     if(col >= table->col_cnt) {
         lv_table_set_column_count(obj, col + 1);
     }
@@ -227,6 +243,11 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
+    if(table->cell_text_cb) {
+        virtual_rows_resize(obj, old_row_cnt);
+        return;
+    }
+
     table->row_h = lv_realloc(table->row_h, table->row_cnt * sizeof(table->row_h[0]));
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
@@ -266,6 +287,20 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
     uint32_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
+    if(table->cell_text_cb) {
+        table->col_w = lv_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
+        LV_ASSERT_MALLOC(table->col_w);
+        if(table->col_w == NULL) return;
+
+        uint32_t col;
+        for(col = old_col_cnt; col < col_cnt; col++) {
+            table->col_w[col] = LV_DPI_DEF;
+        }
+
+        refr_size_form_row(obj, 0);
+        return;
+    }
+
     lv_table_cell_t ** new_cell_data = lv_malloc(table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     LV_ASSERT_MALLOC(new_cell_data);
     if(new_cell_data == NULL) return;
@@ -328,6 +363,10 @@ void lv_table_set_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     LV_CHECK_OBJ(obj, MY_CLASS, return);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        LV_LOG_WARN("the cells can't be modified in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -354,6 +393,10 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     LV_CHECK_OBJ(obj, MY_CLASS, return);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        LV_LOG_WARN("the cells can't be modified in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -379,6 +422,10 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     LV_CHECK_OBJ(obj, MY_CLASS, return);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        LV_LOG_WARN("the cells can't be modified in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_column_count(obj, col + 1);
@@ -399,6 +446,55 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     table->cell_data[cell]->user_data = user_data;
 }
 
+void lv_table_set_cell_text_cb(lv_obj_t * obj, lv_table_cell_text_cb_t cb)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(cb && table->cell_text_cb == NULL) {
+        /*The texts and row heights are not stored in virtual mode*/
+        uint32_t i;
+        for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+            lv_free(table->cell_data[i]);
+        }
+        lv_free(table->cell_data);
+        lv_free(table->row_h);
+        table->cell_data = NULL;
+        table->row_h = NULL;
+    }
+    else if(cb == NULL && table->cell_text_cb) {
+        lv_free(table->row_h_tree);
+        lv_free(table->row_measured);
+        table->row_h_tree = NULL;
+        table->row_measured = NULL;
+
+        /*Allocate at least one element to have a valid pointer even without cells*/
+        table->cell_data = lv_zalloc(LV_MAX(table->row_cnt * table->col_cnt, 1) * sizeof(lv_table_cell_t *));
+        LV_ASSERT_MALLOC(table->cell_data);
+        table->row_h = lv_malloc(LV_MAX(table->row_cnt, 1) * sizeof(table->row_h[0]));
+        LV_ASSERT_MALLOC(table->row_h);
+        if(table->cell_data == NULL || table->row_h == NULL) {
+            /*Not allocated cells can't be handled, so remove the rows*/
+            table->row_cnt = 0;
+        }
+    }
+
+    table->cell_text_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_set_virtual_row_height(lv_obj_t * obj, int32_t h, bool fixed)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    table->virtual_row_h = h;
+    table->virtual_row_h_fixed = fixed;
+
+    if(table->cell_text_cb) refr_size_form_row(obj, 0);
+}
+
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return);
@@ -432,6 +528,12 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
+
+    if(table->cell_text_cb) {
+        const char * txt = table->cell_text_cb(obj, row, col);
+        return txt ? txt : "";
+    }
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return "";
@@ -439,6 +541,14 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
     return table->cell_data[cell]->txt;
 }
 
+lv_table_cell_text_cb_t lv_table_get_cell_text_cb(lv_obj_t * obj)
+{
+    LV_CHECK_OBJ(obj, MY_CLASS, return NULL);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_text_cb;
+}
+
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
 {
     LV_CHECK_OBJ(obj, MY_CLASS, return 0);
@@ -478,6 +588,8 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
         LV_LOG_WARN("invalid row or column");
         return false;
     }
+    if(table->cell_text_cb) return false;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return false;
@@ -500,6 +612,8 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return NULL;
     }
+    if(table->cell_text_cb) return NULL;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return NULL;
@@ -537,17 +651,21 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
     /*Free the cell texts*/
-    uint32_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            lv_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
+    if(table->cell_data) {
+        uint32_t i;
+        for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+            if(table->cell_data[i]) {
+                lv_free(table->cell_data[i]);
+                table->cell_data[i] = NULL;
+            }
         }
     }
 
     if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
     if(table->col_w) lv_free(table->col_w);
+    if(table->row_h_tree) lv_free(table->row_h_tree);
+    if(table->row_measured) lv_free(table->row_measured);
 }
 
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -573,12 +691,14 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = get_row_y(obj, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
     }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        measure_visible_rows(obj);
+    }
     else if(code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
         uint32_t col;
         uint32_t row;
@@ -710,17 +830,22 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Start from the first visible row*/
+    int32_t row_y;
+    int32_t y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    row = get_row_at_y(obj, clip_area.y1 - y_ofs, &row_y);
+    uint32_t cell = row * table->col_cnt;
+
+    cell_area.y2 = y_ofs + row_y - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
-        int32_t h_row = table->row_h[row];
+    for(; row < table->row_cnt; row++) {
+        int32_t h_row = get_row_h(obj, row);
 
         cell_area.y1 = cell_area.y2 + 1;
         cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -731,8 +856,10 @@ static void draw_main(lv_event_t * e)
         else cell_area.x2 = obj->coords.x1 + bg_left - 1 - scroll_x + border_width;
 
         for(col = 0; col < table->col_cnt; col++) {
+            /*In virtual mode there are no stored cells, so there is nothing to merge or crop*/
+            lv_table_cell_t * cell_data = table->cell_data ? table->cell_data[cell] : NULL;
             lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell]->ctrl;
+            if(cell_data) ctrl = cell_data->ctrl;
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -744,7 +871,7 @@ static void draw_main(lv_event_t * e)
             }
 
             uint32_t col_merge = 0;
-            for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
+            for(col_merge = 0; cell_data && col_merge + col < table->col_cnt - 1; col_merge++) {
                 lv_table_cell_t * next_cell_data = table->cell_data[cell + col_merge];
 
                 if(is_cell_empty(next_cell_data)) break;
@@ -818,7 +945,17 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = NULL;
+            if(table->cell_text_cb) {
+                txt = table->cell_text_cb(obj, row, col);
+                /*The callback can reuse its buffer for the next cell*/
+                label_dsc_act.text_local = 1;
+            }
+            else if(cell_data) {
+                txt = cell_data->txt;
+            }
+
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -844,7 +981,7 @@ static void draw_main(lv_event_t * e)
                     label_dsc_act.flag |= LV_TEXT_FLAG_EXPAND;
                 }
 
-                lv_text_get_size_attributes(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font, &attributes);
+                lv_text_get_size_attributes(&txt_size, txt, label_dsc_def.font, &attributes);
 
                 /*Align the content to the middle if not cropped*/
                 if(!crop) {
@@ -857,7 +994,7 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -874,6 +1011,16 @@ static void draw_main(lv_event_t * e)
 /* Refreshes size of the table starting from @start_row row */
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 {
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_text_cb) {
+        /*Measure only the visible rows, the others are measured when they are scrolled in*/
+        virtual_rows_reset(obj);
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+        measure_visible_rows(obj);
+        return;
+    }
+
     const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
     const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
     const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -886,7 +1033,6 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
-    lv_table_t * table = (lv_table_t *)obj;
     uint32_t i;
     for(i = start_row; i < table->row_cnt; i++) {
         int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
@@ -947,6 +1093,20 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     attributes.line_space = line_space;
     attributes.text_flags = LV_TEXT_FLAG_NONE;
 
+    if(table->cell_text_cb) {
+        uint32_t col;
+        for(col = 0; col < table->col_cnt; col++) {
+            const char * txt = table->cell_text_cb(obj, row_id, col);
+            if(txt == NULL) continue;
+
+            lv_point_t txt_size;
+            attributes.max_width = table->col_w[col] - cell_left - cell_right;
+            lv_text_get_size_attributes(&txt_size, txt, font, &attributes);
+            h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
+        }
+        return h_max;
+    }
+
     /* Traverse the cells in the row_id row */
     uint32_t cell;
     uint32_t col;
@@ -1046,16 +1206,8 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
-            }
-        }
+        *row = get_row_at_y(obj, y, NULL);
+        is_click_on_valid_row = *row < table->row_cnt;
     }
 
     /* If the click was on valid column AND row then return valid result, return invalid otherwise */
@@ -1105,7 +1257,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
      * exit the traversal when the current cell control is not LV_TABLE_CELL_CTRL_MERGE_RIGHT */
     uint32_t col_merge = 0;
     int32_t offset = 0;
-    for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
+    for(col_merge = 0; table->cell_data && col_merge + col < table->col_cnt - 1; col_merge++) {
         lv_table_cell_t * next_cell_data = table->cell_data[row * table->col_cnt + col_merge];
 
         if(is_cell_empty(next_cell_data)) break;
@@ -1131,15 +1283,10 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + (table->col_w[col] + offset) - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = get_row_y(obj, row);
     area->y1 += lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
     area->y1 -= lv_obj_get_scroll_y(obj);
-    area->y2 = area->y1 + table->row_h[row] - 1;
+    area->y2 = area->y1 + get_row_h(obj, row) - 1;
 
 }
 
@@ -1164,4 +1311,258 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/**
+ * Get the position of a row
+ * @param obj       pointer to a Table object
+ * @param row       id of a row [0 .. row_cnt]
+ * @return          the total height of the rows before `row`
+ */
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_text_cb == NULL) {
+        int32_t y = 0;
+        uint32_t r;
+        for(r = 0; r < row; r++) {
+            y += table->row_h[r];
+        }
+        return y;
+    }
+
+    if(table->row_h_tree == NULL) return (int32_t)row * table->row_h_def;
+
+    return row_h_tree_sum(table->row_h_tree, row);
+}
+
+/**
+ * Get the height of a row
+ * @param obj       pointer to a Table object
+ * @param row       id of a row [0 .. row_cnt -1]
+ * @return          the height of the row
+ */
+static int32_t get_row_h(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(table->cell_text_cb == NULL) return table->row_h[row];
+    if(table->row_h_tree == NULL) return table->row_h_def;
+
+    return row_h_tree_sum(table->row_h_tree, row + 1) - row_h_tree_sum(table->row_h_tree, row);
+}
+
+/**
+ * Find the row at a position
+ * @param obj       pointer to a Table object
+ * @param y         a position relative to the top of the first row
+ * @param row_y     store the position of the found row here (can be NULL)
+ * @return          id of the row, the first row if `y` is above it,
+ *                  `row_cnt` if `y` is below the last row
+ */
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y, int32_t * row_y)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    uint32_t row;
+    int32_t y_act;
+
+    if(table->cell_text_cb == NULL) {
+        y_act = 0;
+        for(row = 0; row < table->row_cnt; row++) {
+            if(y < y_act + table->row_h[row]) break;
+            y_act += table->row_h[row];
+        }
+    }
+    else if(table->row_h_tree == NULL) {
+        row = (y > 0 && table->row_h_def > 0) ? (uint32_t)(y / table->row_h_def) : 0;
+        if(row > table->row_cnt) row = table->row_cnt;
+        y_act = (int32_t)row * table->row_h_def;
+    }
+    else {
+        /*Descend in the tree to find the last row which starts at or above `y`*/
+        uint32_t step = 1;
+        while(step * 2 <= table->row_cnt) step *= 2;
+
+        row = 0;
+        y_act = 0;
+        for(; step > 0; step >>= 1) {
+            if(row + step <= table->row_cnt && y_act + table->row_h_tree[row + step] <= y) {
+                row += step;
+                y_act += table->row_h_tree[row];
+            }
+        }
+    }
+
+    if(row_y) *row_y = y_act;
+    return row;
+}
+
+/**
+ * Set the default height of the rows in virtual mode and forget the measured heights
+ * @param obj       pointer to a Table object
+ */
+static void virtual_rows_reset(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    int32_t h = table->virtual_row_h;
+    if(h <= 0) {
+        const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+        h = lv_font_get_line_height(font) + lv_obj_get_style_pad_top(obj, LV_PART_ITEMS) +
+            lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+        h = LV_CLAMP(lv_obj_get_style_min_height(obj, LV_PART_ITEMS), h, lv_obj_get_style_max_height(obj, LV_PART_ITEMS));
+    }
+    table->row_h_def = h;
+
+    lv_free(table->row_h_tree);
+    lv_free(table->row_measured);
+    table->row_h_tree = NULL;
+    table->row_measured = NULL;
+    if(table->virtual_row_h_fixed) return;
+
+    virtual_rows_resize(obj, 0);
+}
+
+/**
+ * Add or remove rows of a virtual table with default height.
+ * @param obj           pointer to a Table object
+ * @param old_row_cnt   the number of rows the tree was built for
+ */
+static void virtual_rows_resize(lv_obj_t * obj, uint32_t old_row_cnt)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(!table->virtual_row_h_fixed) {
+        int32_t * tree = lv_realloc(table->row_h_tree, (table->row_cnt + 1) * sizeof(int32_t));
+        LV_ASSERT_MALLOC(tree);
+        uint8_t * measured = lv_realloc(table->row_measured, table->row_cnt / 8 + 1);
+        LV_ASSERT_MALLOC(measured);
+        if(tree == NULL || measured == NULL) {
+            /*Fall back to fixed row heights*/
+            lv_free(tree ? tree : table->row_h_tree);
+            lv_free(measured ? measured : table->row_measured);
+            table->row_h_tree = NULL;
+            table->row_measured = NULL;
+        }
+        else {
+            table->row_h_tree = tree;
+            table->row_measured = measured;
+
+            /*Shrinking keeps the tree valid, only the new rows need to be added*/
+            if(old_row_cnt == 0) tree[0] = 0;
+            if(old_row_cnt < table->row_cnt) {
+                row_h_tree_fill(tree, old_row_cnt, table->row_cnt, table->row_h_def);
+
+                uint32_t byte_id = old_row_cnt / 8;
+                measured[byte_id] &= (1 << (old_row_cnt % 8)) - 1;
+                lv_memzero(&measured[byte_id + 1], table->row_cnt / 8 - byte_id);
+            }
+        }
+    }
+
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+    measure_visible_rows(obj);
+}
+
+/**
+ * Measure the not yet measured rows of a virtual table which are visible now.
+ * @param obj       pointer to a Table object
+ */
+static void measure_visible_rows(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->row_h_tree == NULL || table->row_cnt == 0) return;
+
+    lv_area_t visible_area = obj->coords;
+    if(!lv_obj_area_is_visible(obj, &visible_area)) return;
+
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    /*The same as the top of the first row in `draw_main`*/
+    int32_t y_ofs = obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN) - lv_obj_get_scroll_y(obj) +
+                    lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+
+    int32_t row_y;
+    uint32_t row = get_row_at_y(obj, visible_area.y1 - y_ofs, &row_y);
+    bool changed = false;
+    for(; row < table->row_cnt; row++) {
+        /*The position of the rows changes while measuring*/
+        if(y_ofs + row_y > visible_area.y2) break;
+
+        int32_t h = get_row_h(obj, row);
+        uint8_t mask = 1 << (row % 8);
+        if((table->row_measured[row / 8] & mask) == 0) {
+            table->row_measured[row / 8] |= mask;
+
+            int32_t h_new = get_row_height(obj, row, font, letter_space, line_space,
+                                           cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            h_new = LV_CLAMP(minh, h_new, maxh);
+            if(h_new != h) {
+                uint32_t i;
+                for(i = row + 1; i <= table->row_cnt; i += i & (~i + 1)) {
+                    table->row_h_tree[i] += h_new - h;
+                }
+                h = h_new;
+                changed = true;
+            }
+        }
+
+        row_y += h;
+    }
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/**
+ * Get the total height of the first rows from a Fenwick tree
+ * @param tree      the tree of the row heights. `tree[i]` is the total height of the rows
+ *                  `(i - lowest set bit of i) .. i - 1`
+ * @param row_cnt   number of rows to add
+ * @return          the total height
+ */
+static int32_t row_h_tree_sum(const int32_t * tree, uint32_t row_cnt)
+{
+    int32_t sum = 0;
+    while(row_cnt > 0) {
+        sum += tree[row_cnt];
+        row_cnt &= row_cnt - 1;
+    }
+    return sum;
+}
+
+/**
+ * Add rows with the same height to the end of a Fenwick tree
+ * @param tree      the tree of the row heights, it already contains `start` rows
+ * @param start     id of the first new row
+ * @param end       number of rows after adding the new ones
+ * @param h         height of the new rows
+ */
+static void row_h_tree_fill(int32_t * tree, uint32_t start, uint32_t end, int32_t h)
+{
+    uint32_t i;
+    for(i = start + 1; i <= end; i++) {
+        /*Add the nodes covering the previous rows in the range of this node*/
+        uint32_t range_start = i - (i & (~i + 1));
+        uint32_t j;
+        tree[i] = h;
+        for(j = i - 1; j > range_start; j &= j - 1) {
+            tree[i] += tree[j];
+        }
+    }
+}
+
 #endif
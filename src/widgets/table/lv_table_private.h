@@ -44,6 +44,13 @@ struct _lv_table_t {
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_cell_text_cb_t cell_text_cb;   /**< Provides the texts in virtual mode */
+    int32_t * row_h_tree;                   /**< Fenwick tree of the row heights in virtual mode,
+                                                 NULL if the rows are not measured */
+    uint8_t * row_measured;                 /**< A bit for each row which is already measured */
+    int32_t virtual_row_h;                  /**< Height of the rows set in virtual mode, 0: one line of text */
+    int32_t row_h_def;                      /**< Height of the not measured rows in virtual mode */
+    uint8_t virtual_row_h_fixed : 1;        /**< 1: all the rows have the default height */
 };
 
 
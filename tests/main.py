@@ -33,8 +33,11 @@ if platform.system() != 'Windows':
 test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
+    'OPTIONS_TEST_MEM_SLAB': 'Test config, system heap with the small object slabs, 32 bit color depth',
+    'OPTIONS_TEST_DRAW_UNITS': 'Test config, system heap, 4 software draw units, 32 bit color depth',
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
     'OPTIONS_TEST_RISCV_V': 'RISC-V Vector emulation with full config, 32 bit color depth',
+    'OPTIONS_TEST_X86_AVX2': 'x86 SSE2/AVX2 blending with full config, 32 bit color depth',
 }
 
 
@@ -138,7 +138,12 @@ def lvgl_test_src(name: str) -> str:
     return os.path.join(lvgl_test_dir, "src", name)
 
 
-LVGL_TEST_FILES = [lvgl_test_src("lv_test_init.c"), lvgl_test_src("lv_test_init.h")]
+LVGL_TEST_FILES = [
+    lvgl_test_src("lv_test_init.c"),
+    lvgl_test_src("lv_test_init.h"),
+    lvgl_test_src("lv_test_perf.c"),
+    lvgl_test_src("lv_test_perf.h"),
+]
 
 
 def options_abbrev(options_name: str) -> str:
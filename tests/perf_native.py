@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+
+"""
+Build and run the performance tests natively on the host.
+
+Unlike `perf.py` it doesn't need Docker or an emulator: the tests of `src/test_cases_perf` and
+`src/test_cases_perf_native` are built with the `OPTIONS_TEST_PERF_NATIVE` config and run on a headless
+test display. The results are collected as JSON so that they can be compared between commits.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+lvgl_test_dir = os.path.dirname(os.path.realpath(__file__))
+OPTIONS_NAME = "OPTIONS_TEST_PERF_NATIVE"
+DEFAULT_BUILD_DIR = os.path.join(lvgl_test_dir, "build_test_perf_native")
+
+
+def build(build_dir: str, clean: bool) -> None:
+    """Configure and build the native performance tests"""
+    if clean and os.path.exists(build_dir):
+        shutil.rmtree(build_dir)
+
+    if not os.path.isdir(build_dir):
+        os.mkdir(build_dir)
+        args = ["cmake", "-S", lvgl_test_dir, "-B", build_dir,
+                "-DCMAKE_BUILD_TYPE=Release", f"-D{OPTIONS_NAME}=1"]
+        if shutil.which("ninja"):
+            args.append("-GNinja")
+        subprocess.check_call(args)
+
+    subprocess.check_call(["cmake", "--build", build_dir, "--parallel", str(os.cpu_count())])
+
+
+def git_commit() -> str:
+    try:
+        return subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=lvgl_test_dir, text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def run(build_dir: str, test_suite: str | None, output: str) -> dict:
+    """
+    Run the tests one after the other and collect the JSON lines they write
+    to `LV_TEST_PERF_JSON` into a single JSON file
+    """
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        lines_path = os.path.join(tmp_dir, "results.jsonl")
+        env = dict(os.environ, LV_TEST_PERF_JSON=lines_path)
+
+        args = ["ctest", "--test-dir", build_dir, "--timeout", "600", "--output-on-failure"]
+        if test_suite is not None:
+            args.extend(["--tests-regex", test_suite])
+        subprocess.check_call(args, env=env)
+
+        results = []
+        if os.path.exists(lines_path):
+            with open(lines_path) as f:
+                results = [json.loads(line) for line in f if line.strip()]
+
+    report = {"commit": git_commit(), "results": results}
+    with open(output, "w") as f:
+        json.dump(report, f, indent=2)
+
+    print(f"{len(results)} results written to {output}")
+    return report
+
+
+def result_key(result: dict) -> str:
+    return f'{result["suite"]}/{result["test"]}/{result["name"]}'
+
+
+def compare(base: dict, current: dict, threshold: float) -> bool:
+    """
+    Print the change of the median times and return `True` if any of them
+    got slower by more than `threshold` percent
+    """
+    base_results = {result_key(r): r for r in base["results"]}
+    regression = False
+
+    print(f'Comparing {current["commit"][:10]} to {base["commit"][:10]}')
+    print(f'{"measurement":<70} {"base":>10} {"current":>10} {"change":>8}')
+    for r in current["results"]:
+        key = result_key(r)
+        b = base_results.get(key)
+        if b is None or b["median_ns"] == 0:
+            print(f'{key:<70} {"-":>10} {r["median_ns"] / 1000:>8.1f}us {"new":>8}')
+            continue
+
+        change = (r["median_ns"] - b["median_ns"]) * 100.0 / b["median_ns"]
+        mark = ""
+        if change > threshold:
+            mark = " <-- slower"
+            regression = True
+        print(f'{key:<70} {b["median_ns"] / 1000:>8.1f}us {r["median_ns"] / 1000:>8.1f}us '
+              f'{change:>+7.1f}%{mark}')
+
+    return regression
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Build and run the LVGL performance tests natively")
+    parser.add_argument("--build-dir", default=DEFAULT_BUILD_DIR, help="The CMake build directory")
+    parser.add_argument("--clean", action="store_true", help="Delete the build directory before building")
+    parser.add_argument("--test-suite", default=None, help="Run only the tests matching this regex")
+    parser.add_argument("--output", default="perf_native.json", help="Write the results to this JSON file")
+    parser.add_argument("--compare", metavar="BASE_JSON", default=None,
+                        help="Compare the results with an earlier output of this script")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Fail the comparison if a median got slower by more than this many percent")
+    parser.add_argument("actions", nargs="*", choices=["build", "test"], default=["build", "test"])
+    args = parser.parse_args()
+
+    if "build" in args.actions:
+        build(args.build_dir, args.clean)
+
+    if "test" in args.actions:
+        report = run(args.build_dir, args.test_suite, args.output)
+        if args.compare:
+            with open(args.compare) as f:
+                base = json.load(f)
+            if compare(base, report, args.threshold):
+                sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
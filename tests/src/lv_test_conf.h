@@ -22,7 +22,15 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_VALUE_CACHE    1
+#define LV_USE_OBJ_HIT_INDEX        1
+#define LV_OBJ_HIT_INDEX_MIN_CHILDREN 2   /* Use the index nearly everywhere to test it */
+#define LV_BINFONT_ZERO_COPY        1
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (16 * 1024)
+#define LV_FONT_FMT_TXT_GID_CACHE_CNT 64
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
+#define LV_USE_IMAGE_DECODER_ASYNC  1
+#define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (64 * 1024) /*Larger because of the sanitizers*/
 #define LV_DRAW_BUF_STRIDE_ALIGN    64  /* Use a large value to be sure any issues will cause crash */
 #endif
 
@@ -31,6 +39,7 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_VALUE_CACHE 0
 #define LV_BIN_DECODER_RAM_LOAD 0
 #define LV_USE_MEM_MONITOR      1
 #endif
@@ -3,7 +3,7 @@
 #define LV_CHECK_ARG_LOG_MODE LV_CHECK_ARG_LOG_MODE_VERBOSE
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    64
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -0,0 +1,230 @@
+#if defined(LV_BUILD_TEST_PERF) && LV_BUILD_TEST_PERF
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE    /*For syscall() and clock_gettime()*/
+#endif
+
+#include "lv_test_perf.h"
+#include "../unity/unity.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/perf_event.h>)
+        #include <linux/perf_event.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+        #define LV_TEST_PERF_USE_PERF_EVENT 1
+    #endif
+#endif
+
+#ifndef LV_TEST_PERF_USE_PERF_EVENT
+    #define LV_TEST_PERF_USE_PERF_EVENT 0
+#endif
+
+#define INSTRUCTIONS_NOT_OPENED     -2
+#define INSTRUCTIONS_NOT_AVAILABLE  -1
+
+static uint64_t time_ns_get(void);
+static int64_t instructions_get(void);
+static int compare_u64(const void * a, const void * b);
+static int compare_i64(const void * a, const void * b);
+static const char * file_name_get(const char * path);
+static void json_string_write(FILE * f, const char * str);
+
+#if LV_TEST_PERF_USE_PERF_EVENT
+    static int instructions_fd = INSTRUCTIONS_NOT_OPENED;
+#endif
+
+void lv_test_perf_samples_init(lv_test_perf_samples_t * samples, const char * name)
+{
+    memset(samples, 0, sizeof(lv_test_perf_samples_t));
+    samples->name = name;
+}
+
+void lv_test_perf_sample_begin(lv_test_perf_samples_t * samples)
+{
+    samples->begin_instructions = instructions_get();
+    samples->begin_ns = time_ns_get();
+}
+
+void lv_test_perf_sample_end(lv_test_perf_samples_t * samples)
+{
+    uint64_t end_ns = time_ns_get();
+    int64_t end_instructions = instructions_get();
+
+    int64_t instructions = -1;
+    if(end_instructions >= 0 && samples->begin_instructions >= 0) {
+        instructions = end_instructions - samples->begin_instructions;
+    }
+
+    lv_test_perf_sample_add(samples, end_ns - samples->begin_ns, instructions);
+}
+
+void lv_test_perf_sample_add(lv_test_perf_samples_t * samples, uint64_t time_ns, int64_t instructions)
+{
+    if(samples->cnt == samples->capacity) {
+        samples->capacity = samples->capacity ? samples->capacity * 2 : 64;
+        samples->time_ns = realloc(samples->time_ns, samples->capacity * sizeof(uint64_t));
+        samples->instructions = realloc(samples->instructions, samples->capacity * sizeof(int64_t));
+        TEST_ASSERT_NOT_NULL(samples->time_ns);
+        TEST_ASSERT_NOT_NULL(samples->instructions);
+    }
+
+    samples->time_ns[samples->cnt] = time_ns;
+    samples->instructions[samples->cnt] = instructions;
+    samples->cnt++;
+}
+
+void lv_test_perf_samples_report(lv_test_perf_samples_t * samples, lv_test_perf_stats_t * stats)
+{
+    lv_test_perf_stats_t s;
+    memset(&s, 0, sizeof(s));
+    s.sample_cnt = samples->cnt;
+    s.median_instructions = -1;
+
+    if(samples->cnt) {
+        uint32_t n = samples->cnt;
+        qsort(samples->time_ns, n, sizeof(uint64_t), compare_u64);
+        qsort(samples->instructions, n, sizeof(int64_t), compare_i64);
+
+        uint64_t sum = 0;
+        uint32_t i;
+        for(i = 0; i < n; i++) sum += samples->time_ns[i];
+
+        s.min_ns = samples->time_ns[0];
+        s.median_ns = samples->time_ns[n / 2];
+        s.p95_ns = samples->time_ns[(n * 95 + 99) / 100 - 1];
+        s.mean_ns = sum / n;
+        /*They are sorted so if the smallest is valid all are valid*/
+        if(samples->instructions[0] >= 0) s.median_instructions = samples->instructions[n / 2];
+    }
+
+    TEST_PRINTF("%s: median %u us, p95 %u us, %u samples", samples->name,
+                (unsigned int)(s.median_ns / 1000), (unsigned int)(s.p95_ns / 1000), (unsigned int)s.sample_cnt);
+
+    const char * json_path = getenv("LV_TEST_PERF_JSON");
+    if(json_path && json_path[0] != '\0') {
+        FILE * f = fopen(json_path, "a");
+        TEST_ASSERT_NOT_NULL_MESSAGE(f, "Couldn't open the file set in LV_TEST_PERF_JSON");
+        fprintf(f, "{\"suite\": ");
+        json_string_write(f, file_name_get(Unity.TestFile));
+        fprintf(f, ", \"test\": ");
+        json_string_write(f, Unity.CurrentTestName);
+        fprintf(f, ", \"name\": ");
+        json_string_write(f, samples->name);
+        fprintf(f, ", \"samples\": %" PRIu32 ", \"min_ns\": %" PRIu64 ", \"median_ns\": %" PRIu64
+                ", \"p95_ns\": %" PRIu64 ", \"mean_ns\": %" PRIu64 ", \"instructions\": ",
+                s.sample_cnt, s.min_ns, s.median_ns, s.p95_ns, s.mean_ns);
+        if(s.median_instructions >= 0) fprintf(f, "%" PRId64 "}\n", s.median_instructions);
+        else fprintf(f, "null}\n");
+        fclose(f);
+    }
+
+    free(samples->time_ns);
+    free(samples->instructions);
+    memset(samples, 0, sizeof(lv_test_perf_samples_t));
+
+    if(stats) *stats = s;
+}
+
+void lv_test_perf_run(const char * name, void (*cb)(void * user_data), void * user_data, uint32_t iterations,
+                      lv_test_perf_stats_t * stats)
+{
+    /*Warm up the caches*/
+    cb(user_data);
+
+    lv_test_perf_samples_t samples;
+    lv_test_perf_samples_init(&samples, name);
+
+    uint32_t i;
+    for(i = 0; i < iterations; i++) {
+        lv_test_perf_sample_begin(&samples);
+        cb(user_data);
+        lv_test_perf_sample_end(&samples);
+    }
+
+    lv_test_perf_samples_report(&samples, stats);
+}
+
+static uint64_t time_ns_get(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return (uint64_t)clock() * 1000000000ULL / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * Get the number of instructions executed by this thread in user space
+ * @return the instruction count or -1 if not available (e.g. no permission for perf_event)
+ */
+static int64_t instructions_get(void)
+{
+#if LV_TEST_PERF_USE_PERF_EVENT
+    if(instructions_fd == INSTRUCTIONS_NOT_OPENED) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        instructions_fd = fd >= 0 ? fd : INSTRUCTIONS_NOT_AVAILABLE;
+    }
+
+    if(instructions_fd >= 0) {
+        uint64_t cnt;
+        if(read(instructions_fd, &cnt, sizeof(cnt)) == sizeof(cnt)) return (int64_t)cnt;
+    }
+#endif
+
+    return -1;
+}
+
+static int compare_u64(const void * a, const void * b)
+{
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return va < vb ? -1 : va > vb ? 1 : 0;
+}
+
+static int compare_i64(const void * a, const void * b)
+{
+    int64_t va = *(const int64_t *)a;
+    int64_t vb = *(const int64_t *)b;
+    return va < vb ? -1 : va > vb ? 1 : 0;
+}
+
+static const char * file_name_get(const char * path)
+{
+    if(path == NULL) return "";
+    const char * name = strrchr(path, '/');
+    return name ? name + 1 : path;
+}
+
+/**
+ * Write a string as a quoted JSON string, escaping the quotes, backslashes and control characters
+ */
+static void json_string_write(FILE * f, const char * str)
+{
+    fputc('"', f);
+    if(str) {
+        for(; *str; str++) {
+            unsigned char c = (unsigned char)*str;
+            if(c == '"' || c == '\\') fprintf(f, "\\%c", c);
+            else if(c < 0x20) fprintf(f, "\\u%04x", c);
+            else fputc(c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+#endif
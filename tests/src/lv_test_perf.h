@@ -0,0 +1,73 @@
+#ifndef LV_TEST_PERF_H
+#define LV_TEST_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * Statistics of the samples of a measurement. All times are in nanoseconds.
+ */
+typedef struct {
+    uint32_t sample_cnt;
+    uint64_t min_ns;
+    uint64_t median_ns;
+    uint64_t p95_ns;
+    uint64_t mean_ns;
+    int64_t median_instructions;    /**< -1 if the instructions can't be counted*/
+} lv_test_perf_stats_t;
+
+/**
+ * Collects the time (and if possible the number of instructions) of repeated runs of something
+ */
+typedef struct {
+    const char * name;
+    uint64_t * time_ns;
+    int64_t * instructions;
+    uint32_t cnt;
+    uint32_t capacity;
+    uint64_t begin_ns;
+    int64_t begin_instructions;
+} lv_test_perf_samples_t;
+
+void lv_test_perf_samples_init(lv_test_perf_samples_t * samples, const char * name);
+
+void lv_test_perf_sample_begin(lv_test_perf_samples_t * samples);
+
+void lv_test_perf_sample_end(lv_test_perf_samples_t * samples);
+
+/**
+ * Add a sample measured by the caller
+ * @param samples       the samples to extend
+ * @param time_ns       the measured time in nanoseconds
+ * @param instructions  the number of executed instructions or -1 if not known
+ */
+void lv_test_perf_sample_add(lv_test_perf_samples_t * samples, uint64_t time_ns, int64_t instructions);
+
+/**
+ * Calculate the statistics of the samples, print them and append them as a JSON line
+ * to the file set in the `LV_TEST_PERF_JSON` environment variable.
+ * The samples are freed.
+ * @param samples   the collected samples
+ * @param stats     store the statistics here (can be NULL)
+ */
+void lv_test_perf_samples_report(lv_test_perf_samples_t * samples, lv_test_perf_stats_t * stats);
+
+/**
+ * Call `cb` `iterations` times after a warm-up run, measure each call and report the statistics
+ * @param name          name of the measurement in the report
+ * @param cb            the function to measure
+ * @param user_data     passed to `cb`
+ * @param iterations    number of measured calls
+ * @param stats         store the statistics here (can be NULL)
+ */
+void lv_test_perf_run(const char * name, void (*cb)(void * user_data), void * user_data, uint32_t iterations,
+                      lv_test_perf_stats_t * stats);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_PERF_H*/
@@ -19,6 +19,12 @@
 
         #define LV_BUILD_TEST_PERF 1
         #define LV_USE_TEST 1
+
+        /* Set by the native host build (`OPTIONS_TEST_PERF_NATIVE`) to also enable
+         * the benchmark demo and the image decoders measured only on the host */
+        #ifndef LV_TEST_PERF_NATIVE
+            #define LV_TEST_PERF_NATIVE 0
+        #endif
         /* If you need to include anything here, do it inside the `__ASSEMBLY__` guard */
         #if  0 && defined(__ASSEMBLY__)
             #include "my_include.h"
@@ -74,7 +80,9 @@
             #define LV_MEM_SIZE ((32 * 1024 * 1024))          /**< [bytes] */
 
             /** Size of the memory expand for `lv_malloc()` in bytes */
-            #define LV_MEM_POOL_EXPAND_SIZE 0
+            #if !LV_TEST_PERF_NATIVE    /*Deprecated, its warning would fail the native builds*/
+                #define LV_MEM_POOL_EXPAND_SIZE 0
+            #endif
 
             /** Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too. */
             #define LV_MEM_ADR 0     /**< 0: unused*/
@@ -109,7 +117,9 @@
         * - LV_OS_MQX
         * - LV_OS_SDL2
         * - LV_OS_CUSTOM */
-        #define LV_USE_OS   LV_OS_NONE
+        #ifndef LV_USE_OS   /*Can be overridden to measure the parallel rendering*/
+            #define LV_USE_OS   LV_OS_NONE
+        #endif
 
         #if LV_USE_OS == LV_OS_CUSTOM
             #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -185,7 +195,9 @@
             /** Set number of draw units.
             *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
             *  - > 1 means multiple threads will render the screen in parallel. */
-            #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+            #ifndef LV_DRAW_SW_DRAW_UNIT_CNT
+                #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+            #endif
 
             /** Use Arm-2D to accelerate software (sw) rendering. */
             #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -204,6 +216,9 @@
                 *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+                /** Number of shadow corners to cache. Each uses at most LV_DRAW_SW_SHADOW_CACHE_SIZE^2 bytes. */
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+
                 /** Set number of maximally-cached circle data.
                 *  The circumference of 1/4 circle are saved for anti-aliasing.
                 *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -392,6 +407,7 @@
 
         /** Add a custom handler when assert happens e.g. to restart MCU. */
         #define LV_ASSERT_HANDLER_INCLUDE <stdint.h>
+        #define LV_DISABLE_ASSERT_HANDLER_INCLUDE_WARNING 1 /**< The native builds treat warnings as errors */
         #define LV_ASSERT_HANDLER while(1);     /**< Halt by default */
 
         /*-------------
@@ -431,6 +447,9 @@
         *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
         #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+        /** Decode images in background threads into the image cache. */
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+
         /** Number of stops allowed per gradient. Increase this to allow more stops.
         *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
         #define LV_GRADIENT_MAX_STOPS   2
@@ -446,6 +465,15 @@
         /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
         #define LV_OBJ_STYLE_CACHE      0
 
+        /** Cache the style properties resolved from the styles of the widgets by part and state */
+        #define LV_OBJ_STYLE_VALUE_CACHE 1
+
+        /** Find the pressed widget with a grid of the children */
+        #define LV_USE_OBJ_HIT_INDEX    1
+        #if LV_USE_OBJ_HIT_INDEX
+            #define LV_OBJ_HIT_INDEX_MIN_CHILDREN 32
+        #endif
+
         /** Add `id` field to `lv_obj_t` */
         #define LV_USE_OBJ_ID           0
 
@@ -573,8 +601,9 @@
         #define LV_FONT_MONTSERRAT_48 0
 
         /* Demonstrate special features */
-        #define LV_FONT_MONTSERRAT_28_COMPRESSED 0  /**< bpp = 3 */
+        #define LV_FONT_MONTSERRAT_28_COMPRESSED 1  /**< bpp = 3 */
         #define LV_FONT_DEJAVU_16_PERSIAN_HEBREW 0  /**< Hebrew, Arabic, Persian letters and all their forms */
+        #define LV_FONT_SOURCE_HAN_SANS_SC_14_CJK 1 /**< 1338 most common CJK radicals */
 
         /** Pixel perfect monospaced fonts */
         #define LV_FONT_UNSCII_8  0
@@ -600,7 +629,16 @@
         #define LV_FONT_FMT_TXT_LARGE 0
 
         /** Enables/disables support for compressed fonts. */
-        #define LV_USE_FONT_COMPRESSED 0
+        #define LV_USE_FONT_COMPRESSED 1
+
+        /** Size of the cache of the decompressed glyphs of the compressed built-in (fmt_txt) fonts in bytes.
+        *  0: decompress the glyphs every time they are drawn */
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (32 * 1024)
+
+        /** Number of letter to glyph id pairs cached per thread for the built-in (fmt_txt) fonts
+        *  to avoid searching the character maps. Should be a power of 2, e.g. 64.
+        *  0: don't cache */
+        #define LV_FONT_FMT_TXT_GID_CACHE_CNT 64
 
         /** Enable drawing placeholders when glyph dsc is not found. */
         #define LV_USE_FONT_PLACEHOLDER 1
@@ -678,13 +716,15 @@
         #define LV_USE_CALENDAR   1
         #if LV_USE_CALENDAR
             #define LV_CALENDAR_WEEK_STARTS_MONDAY 0
-            #if LV_CALENDAR_WEEK_STARTS_MONDAY
-                #define LV_CALENDAR_DEFAULT_DAY_NAMES {"Mo", "Tu", "We", "Th", "Fr", "Sa", "Su"}
-            #else
-                #define LV_CALENDAR_DEFAULT_DAY_NAMES {"Su", "Mo", "Tu", "We", "Th", "Fr", "Sa"}
-            #endif
+            #if !LV_TEST_PERF_NATIVE    /*Deprecated, their warnings would fail the native builds*/
+                #if LV_CALENDAR_WEEK_STARTS_MONDAY
+                    #define LV_CALENDAR_DEFAULT_DAY_NAMES {"Mo", "Tu", "We", "Th", "Fr", "Sa", "Su"}
+                #else
+                    #define LV_CALENDAR_DEFAULT_DAY_NAMES {"Su", "Mo", "Tu", "We", "Th", "Fr", "Sa"}
+                #endif
 
-            #define LV_CALENDAR_DEFAULT_MONTH_NAMES {"January", "February", "March",  "April", "May",  "June", "July", "August", "September", "October", "November", "December"}
+                #define LV_CALENDAR_DEFAULT_MONTH_NAMES {"January", "February", "March",  "April", "May",  "June", "July", "August", "September", "October", "November", "December"}
+            #endif
             #define LV_USE_CALENDAR_HEADER_ARROW 1
             #define LV_USE_CALENDAR_HEADER_DROPDOWN 1
             #define LV_USE_CALENDAR_CHINESE 0
@@ -708,6 +748,7 @@
         #if LV_USE_LABEL
             #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
             #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
+            #define LV_LABEL_LINE_CACHE 1       /**< Store the line breaks of long texts to draw only the visible lines */
             #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
         #endif
 
@@ -834,9 +875,9 @@
         #endif
 
         /** API for memory-mapped file access. */
-        #define LV_USE_FS_MEMFS 0
+        #define LV_USE_FS_MEMFS LV_TEST_PERF_NATIVE
         #if LV_USE_FS_MEMFS
-            #define LV_FS_MEMFS_LETTER '\0'     /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
+            #define LV_FS_MEMFS_LETTER 'M'      /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
         #endif
 
         /** API for LittleFs. */
@@ -867,7 +908,7 @@
         #endif
 
         /** LODEPNG decoder library */
-        #define LV_USE_LODEPNG 0
+        #define LV_USE_LODEPNG LV_TEST_PERF_NATIVE
 
         /** PNG decoder(libpng) library */
         #define LV_USE_LIBPNG 0
@@ -877,7 +918,7 @@
 
         /** JPG + split JPG decoder library.
         *  Split JPG is a custom format optimized for embedded systems. */
-        #define LV_USE_TJPGD 0
+        #define LV_USE_TJPGD LV_TEST_PERF_NATIVE
 
         /** libjpeg-turbo decoder library.
         *  - Supports complete JPEG specifications and high-performance JPEG decoding. */
@@ -998,7 +1039,7 @@
             /** 1: Enable the built-in profiler */
             #define LV_USE_PROFILER_BUILTIN 1
             #if LV_USE_PROFILER_BUILTIN
-                /** Default profiler trace buffer size */
+                /** Default profiler trace buffer size of each profiled thread */
                 #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /**< [bytes] */
             #endif
 
@@ -1255,13 +1296,13 @@
         ====================*/
 
         /** Show some widgets. This might be required to increase `LV_MEM_SIZE`. */
-        #define LV_USE_DEMO_WIDGETS 0
+        #define LV_USE_DEMO_WIDGETS LV_TEST_PERF_NATIVE
 
         /** Demonstrate usage of encoder and keyboard. */
         #define LV_USE_DEMO_KEYPAD_AND_ENCODER 0
 
         /** Benchmark your system */
-        #define LV_USE_DEMO_BENCHMARK 0
+        #define LV_USE_DEMO_BENCHMARK LV_TEST_PERF_NATIVE
 
         /** Render test for each primitive.
         *  - Requires at least 480x272 display. */
@@ -0,0 +1,370 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define SHARD_CNT           4
+#define KEY_CNT             256
+#define THREAD_CNT          4
+#define THREAD_ITERATIONS   20000
+
+typedef struct {
+    int32_t key;
+    int32_t value;
+} test_data_t;
+
+typedef struct {
+    lv_thread_t thread;
+    lv_cache_t * cache;
+    uint32_t seed;
+    bool failed;
+} cache_thread_t;
+
+static uint32_t MEM_SIZE = 0;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 64);
+}
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return (uint32_t)key->key;
+}
+
+static bool create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->value = node->key * 3;
+    return true;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static lv_cache_t * create_cache(size_t max_size, uint32_t shard_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)create_cb,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    return lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(test_data_t), max_size, ops, shard_cnt);
+}
+
+void test_cache_sharded_one_shard_is_a_normal_cache(void)
+{
+    lv_cache_t * cache = create_cache(16, 1);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_NULL(cache->shards);
+    TEST_ASSERT_EQUAL_UINT32(0, cache->shard_cnt);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_acquire_release(void)
+{
+    lv_cache_t * cache = create_cache(KEY_CNT, SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL_UINT32(SHARD_CNT, cache->shard_cnt);
+    TEST_ASSERT_EQUAL(KEY_CNT, lv_cache_get_max_size(cache, NULL));
+
+    /*The same key always goes to the same shard and the keys are spread over all the shards*/
+    const lv_cache_t * shard_of_key[KEY_CNT];
+    uint32_t used_shards = 0;
+    for(int32_t i = 0; i < KEY_CNT / 2; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        TEST_ASSERT_EQUAL_INT32(i * 3, data->value);
+
+        shard_of_key[i] = lv_cache_entry_get_cache(entry);
+        for(uint32_t s = 0; s < SHARD_CNT; s++) {
+            if(shard_of_key[i] == cache->shards[s]) used_shards |= 1 << s;
+        }
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32((1 << SHARD_CNT) - 1, used_shards);
+
+    for(int32_t i = 0; i < KEY_CNT / 2; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL_PTR(shard_of_key[i], lv_cache_entry_get_cache(entry));
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    TEST_ASSERT_EQUAL(KEY_CNT / 2, lv_cache_get_size(cache, NULL));
+
+    /*Dropped entries are not found anymore*/
+    test_data_t drop_key = { .key = 7 };
+    lv_cache_drop(cache, &drop_key, NULL);
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &drop_key, NULL));
+    TEST_ASSERT_EQUAL(KEY_CNT / 2 - 1, lv_cache_get_size(cache, NULL));
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_max_size(void)
+{
+    lv_cache_t * cache = create_cache(10, SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    /*The size is split between the shards, the remainder goes to the first ones*/
+    TEST_ASSERT_EQUAL(3, lv_cache_get_max_size(cache->shards[0], NULL));
+    TEST_ASSERT_EQUAL(3, lv_cache_get_max_size(cache->shards[1], NULL));
+    TEST_ASSERT_EQUAL(2, lv_cache_get_max_size(cache->shards[2], NULL));
+    TEST_ASSERT_EQUAL(2, lv_cache_get_max_size(cache->shards[3], NULL));
+
+    /*Each shard evicts its own entries, so the whole cache can't grow larger*/
+    for(int32_t i = 0; i < KEY_CNT; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL(10, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL(0, lv_cache_get_free_size(cache, NULL));
+
+    lv_cache_set_max_size(cache, 40, NULL);
+    TEST_ASSERT_EQUAL(40, lv_cache_get_max_size(cache, NULL));
+    TEST_ASSERT_EQUAL(10, lv_cache_get_max_size(cache->shards[3], NULL));
+    TEST_ASSERT_EQUAL(30, lv_cache_get_free_size(cache, NULL));
+
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(9, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_evict_from_the_fullest_shard(void)
+{
+    lv_cache_t * cache = create_cache(KEY_CNT, SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    /*Put more entries into the shard of key 0 than into the others*/
+    test_data_t search_key = { .key = 0 };
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+    lv_cache_t * fullest = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    for(int32_t i = 1; i < KEY_CNT / 2; i++) {
+        search_key.key = i;
+        entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        bool keep = lv_cache_entry_get_cache(entry) == fullest || i < 4;
+        lv_cache_release(cache, entry, NULL);
+        if(!keep) lv_cache_drop(cache, &search_key, NULL);
+    }
+
+    size_t fullest_size = lv_cache_get_size(fullest, NULL);
+    size_t total_size = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(fullest_size - 1, lv_cache_get_size(fullest, NULL));
+    TEST_ASSERT_EQUAL(total_size - 1, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_reserve(void)
+{
+    lv_cache_t * cache = create_cache(40, SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < KEY_CNT; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        lv_cache_release(cache, entry, NULL);
+    }
+    TEST_ASSERT_EQUAL(40, lv_cache_get_size(cache, NULL));
+
+    /*The entry can go to any shard, so each of them gets the full free space*/
+    lv_cache_reserve(cache, 4, NULL);
+    for(uint32_t i = 0; i < SHARD_CNT; i++) {
+        TEST_ASSERT_GREATER_OR_EQUAL(4, lv_cache_get_free_size(cache->shards[i], NULL));
+    }
+    TEST_ASSERT_EQUAL(40 - 4 * SHARD_CNT, lv_cache_get_size(cache, NULL));
+
+    /*More than a shard can hold empties the shards, but the used entries stay*/
+    test_data_t used_key = { .key = 1 };
+    lv_cache_entry_t * used = lv_cache_acquire_or_create(cache, &used_key, NULL);
+    TEST_ASSERT_NOT_NULL(used);
+    lv_cache_reserve(cache, 40, NULL);
+    TEST_ASSERT_EQUAL(1, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_PTR(used, lv_cache_acquire(cache, &used_key, NULL));
+    lv_cache_release(cache, used, NULL);
+    lv_cache_release(cache, used, NULL);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_iter(void)
+{
+    lv_cache_t * cache = create_cache(KEY_CNT, SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < 50; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    /*Each entry is visited once*/
+    uint8_t visited[50];
+    lv_memzero(visited, sizeof(visited));
+
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    uint8_t elem[64];
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(elem), lv_cache_entry_get_size(sizeof(test_data_t)));
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        test_data_t * data = (test_data_t *)elem;
+        TEST_ASSERT_LESS_THAN_INT32(50, data->key);
+        visited[data->key]++;
+    }
+    lv_iter_destroy(iter);
+
+    for(uint32_t i = 0; i < 50; i++) {
+        TEST_ASSERT_EQUAL_UINT8(1, visited[i]);
+    }
+
+    /*Stopping early must not leak*/
+    iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_iter_next(iter, elem));
+    lv_iter_destroy(iter);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+#if LV_USE_OS
+
+static void cache_thread_cb(void * user_data)
+{
+    cache_thread_t * t = user_data;
+
+    /*Unity can't fail a test from another thread, so only note the errors here*/
+    for(uint32_t i = 0; i < THREAD_ITERATIONS; i++) {
+        t->seed = t->seed * 1103515245 + 12345;
+        test_data_t search_key = { .key = (int32_t)((t->seed >> 16) % KEY_CNT) };
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(t->cache, &search_key, NULL);
+        if(entry == NULL) {
+            t->failed = true;
+            continue;
+        }
+
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->key != search_key.key || data->value != search_key.key * 3) t->failed = true;
+
+        /*Sometimes drop an entry which is still used by this or other threads*/
+        if((t->seed & 0x3f) == 0) lv_cache_drop(t->cache, &search_key, NULL);
+
+        lv_cache_release(t->cache, entry, NULL);
+    }
+}
+
+static uint32_t run_threads(uint32_t shard_cnt)
+{
+    /*Smaller than the number of keys to evict all the time*/
+    lv_cache_t * cache = create_cache(KEY_CNT / 4, shard_cnt);
+    TEST_ASSERT_NOT_NULL(cache);
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+#endif
+
+    cache_thread_t threads[THREAD_CNT];
+    lv_memzero(threads, sizeof(threads));
+    for(uint32_t i = 0; i < THREAD_CNT; i++) {
+        threads[i].cache = cache;
+        threads[i].seed = i + 1;
+        lv_thread_init(&threads[i].thread, "cache", LV_THREAD_PRIO_MID, cache_thread_cb, 64 * 1024, &threads[i]);
+    }
+
+    for(uint32_t i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i].thread);
+        TEST_ASSERT_FALSE(threads[i].failed);
+    }
+
+    uint32_t time_us = 0;
+#if LV_USE_OS == LV_OS_PTHREAD
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    time_us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+#endif
+
+    /*All the references are given back and the remaining entries are intact*/
+    TEST_ASSERT_LESS_OR_EQUAL(KEY_CNT / 4, lv_cache_get_size(cache, NULL));
+    uint8_t visited[KEY_CNT];
+    lv_memzero(visited, sizeof(visited));
+    size_t entry_cnt = 0;
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    uint8_t elem[64];
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) {
+        test_data_t * data = (test_data_t *)elem;
+        TEST_ASSERT_LESS_THAN_INT32(KEY_CNT, data->key);
+        TEST_ASSERT_EQUAL_INT32(data->key * 3, data->value);
+        TEST_ASSERT_EQUAL_UINT8(0, visited[data->key]);
+        visited[data->key] = 1;
+        entry_cnt++;
+
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(elem, sizeof(test_data_t));
+        TEST_ASSERT_EQUAL_INT32(0, lv_cache_entry_get_ref(entry));
+    }
+    lv_iter_destroy(iter);
+    TEST_ASSERT_EQUAL(lv_cache_get_size(cache, NULL), entry_cnt);
+
+    /*No shard grew over its share*/
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        TEST_ASSERT_LESS_OR_EQUAL(lv_cache_get_max_size(cache->shards[i], NULL), lv_cache_get_size(cache->shards[i], NULL));
+    }
+
+    lv_cache_destroy(cache, NULL);
+    return time_us;
+}
+
+#endif /*LV_USE_OS*/
+
+void test_cache_sharded_threads(void)
+{
+#if LV_USE_OS
+    uint32_t single_us = run_threads(1);
+    uint32_t sharded_us = run_threads(SHARD_CNT);
+
+    /*The timing depends on the machine, so it's only reported*/
+    TEST_PRINTF("%d threads x %d lookups: 1 lock: %" LV_PRIu32 " us, %d shards: %" LV_PRIu32 " us",
+                THREAD_CNT, THREAD_ITERATIONS, single_us, SHARD_CNT, sharded_us);
+#endif
+}
+
+#endif
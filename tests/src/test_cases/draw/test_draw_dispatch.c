@@ -0,0 +1,208 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TEST_DRAW_UNIT_ID   1
+
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    lv_layer_init(&layer);
+    lv_area_set(&layer.buf_area, 0, 0, 799, 479);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+}
+
+void tearDown(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+static lv_draw_task_t * add_task(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a;
+    lv_area_set(&a, x1, y1, x2, y2);
+    return lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+}
+
+void test_draw_task_tail_is_maintained(void)
+{
+    lv_draw_task_t * t1 = add_task(0, 0, 9, 9);
+    TEST_ASSERT_EQUAL_PTR(t1, layer.draw_task_head);
+    TEST_ASSERT_EQUAL_PTR(t1, layer.draw_task_tail);
+
+    lv_draw_task_t * t2 = add_task(10, 0, 19, 9);
+    lv_draw_task_t * t3 = add_task(20, 0, 29, 9);
+    TEST_ASSERT_EQUAL_PTR(t3, layer.draw_task_tail);
+    TEST_ASSERT_EQUAL_PTR(t2, t1->next);
+    TEST_ASSERT_EQUAL_PTR(t3, t2->next);
+
+    /*Removing the last task should update the tail.
+     *Block the others to not let the draw units render them.*/
+    t1->state = LV_DRAW_TASK_STATE_BLOCKED;
+    t2->state = LV_DRAW_TASK_STATE_BLOCKED;
+    TEST_ASSERT_EQUAL_PTR(t3, lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID));
+    t3->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_EQUAL_PTR(t2, layer.draw_task_tail);
+    TEST_ASSERT_NULL(t2->next);
+
+    lv_draw_task_t * t4 = add_task(30, 0, 39, 9);
+    TEST_ASSERT_EQUAL_PTR(t4, t2->next);
+    TEST_ASSERT_EQUAL_PTR(t4, layer.draw_task_tail);
+
+    /*Removing all tasks should clear the tail too*/
+    t1->state = LV_DRAW_TASK_STATE_FINISHED;
+    t2->state = LV_DRAW_TASK_STATE_FINISHED;
+    t4->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.draw_task_tail);
+}
+
+void test_draw_task_overlapping_older_task_is_not_available(void)
+{
+    lv_draw_task_t * t1 = add_task(0, 0, 99, 99);
+    lv_draw_task_t * t2 = add_task(50, 50, 149, 149);
+    lv_draw_task_t * t3 = add_task(400, 300, 499, 399);
+
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    /*t2 overlaps with t1 which is still in progress, but t3 is independent*/
+    TEST_ASSERT_EQUAL_PTR(t3, lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID));
+
+    /*Once t1 is finished t2 can be rendered too*/
+    t1->state = LV_DRAW_TASK_STATE_FINISHED;
+    TEST_ASSERT_EQUAL_PTR(t2, lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID));
+}
+
+void test_draw_task_on_the_same_tile_but_not_overlapping_is_available(void)
+{
+    /*Both are on the first tile of the layer but they don't overlap*/
+    lv_draw_task_t * t1 = add_task(0, 0, 9, 9);
+    lv_draw_task_t * t2 = add_task(20, 20, 29, 29);
+    TEST_ASSERT_EQUAL_UINT64(t1->tile_mask, t2->tile_mask);
+
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_EQUAL_PTR(t2, lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID));
+}
+
+void test_draw_task_continue_from_previous_task(void)
+{
+    lv_draw_task_t * t1 = add_task(0, 0, 99, 99);
+    lv_draw_task_t * t2 = add_task(50, 50, 149, 149);
+    lv_draw_task_t * t3 = add_task(200, 0, 299, 99);
+    lv_draw_task_t * t4 = add_task(250, 50, 349, 149);
+    lv_draw_task_t * t5 = add_task(400, 300, 499, 399);
+
+    /*Take the tasks as a multi-threaded draw unit would do*/
+    lv_draw_task_t * t = lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID);
+    TEST_ASSERT_EQUAL_PTR(t1, t);
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    t = lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID);
+    TEST_ASSERT_EQUAL_PTR(t3, t);
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    t = lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID);
+    TEST_ASSERT_EQUAL_PTR(t5, t);
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    TEST_ASSERT_NULL(lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID));
+
+    /*Finish t1 and remove it. Now t2 is available but t4 still depends on t3*/
+    t1->state = LV_DRAW_TASK_STATE_FINISHED;
+    t2->state = LV_DRAW_TASK_STATE_BLOCKED;
+    t4->state = LV_DRAW_TASK_STATE_BLOCKED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_EQUAL_PTR(t2, layer.draw_task_head);
+    t2->state = LV_DRAW_TASK_STATE_WAITING;
+    t4->state = LV_DRAW_TASK_STATE_WAITING;
+    t = lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID);
+    TEST_ASSERT_EQUAL_PTR(t2, t);
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_NULL(lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID));
+
+    t3->state = LV_DRAW_TASK_STATE_FINISHED;
+    TEST_ASSERT_EQUAL_PTR(t4, lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID));
+}
+
+void test_draw_task_removal_stops_at_the_dispatch_frontier(void)
+{
+    lv_draw_task_t * t1 = add_task(0, 0, 99, 99);
+    lv_draw_task_t * t2 = add_task(50, 50, 149, 149);
+    lv_draw_task_t * t3 = add_task(400, 300, 499, 399);
+    lv_draw_task_t * t4 = add_task(450, 350, 549, 449);
+
+    /*t1 is given to a draw unit, the others depend on it or weren't reached*/
+    TEST_ASSERT_EQUAL_PTR(t1, lv_draw_get_next_available_task(&layer, NULL, TEST_DRAW_UNIT_ID));
+    TEST_ASSERT_EQUAL_PTR(t1, layer._dispatch_frontier);
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t2->state = LV_DRAW_TASK_STATE_BLOCKED;
+    t3->state = LV_DRAW_TASK_STATE_BLOCKED;
+
+    /*A finished task after the frontier (e.g. not taken by any draw units) is kept for now*/
+    t4->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_EQUAL_PTR(t4, t3->next);
+
+    /*The finished tasks at the head are always removed*/
+    t1->state = LV_DRAW_TASK_STATE_FINISHED;
+    t2->state = LV_DRAW_TASK_STATE_FINISHED;
+    t3->state = LV_DRAW_TASK_STATE_FINISHED;
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.draw_task_tail);
+    TEST_ASSERT_NULL(layer._dispatch_frontier);
+}
+
+#if LV_DRAW_TASK_ARENA_CHUNK_SIZE > 0
+void test_draw_task_arena_keeps_one_chunk_when_drained(void)
+{
+    lv_draw_task_arena_t * arena = &LV_GLOBAL_DEFAULT()->draw_info.task_arena;
+
+    /*Enough tasks to fill a few chunks*/
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_draw_task_t * t = add_task(0, 0, 9, 9);
+        TEST_ASSERT_NOT_NULL(t->arena_chunk);
+        t->state = LV_DRAW_TASK_STATE_BLOCKED;
+    }
+    TEST_ASSERT_GREATER_THAN(1, arena->chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(200, arena->live_cnt);
+
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+
+    TEST_ASSERT_EQUAL_UINT32(0, arena->live_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, arena->chunk_cnt);
+}
+
+void test_draw_task_arena_stats_in_mem_monitor(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 100);
+    lv_refr_now(NULL);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(0, mon.draw_task_arena_alloc_cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_TASK_ARENA_CHUNK_SIZE, mon.draw_task_arena_size);
+
+    lv_obj_delete(obj);
+}
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * shadow_obj_create(int32_t x, int32_t y, int32_t w, int32_t h, int32_t shadow_w, int32_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_w, 0);
+    lv_obj_set_style_shadow_offset_y(obj, shadow_w / 4, 0);
+    lv_obj_set_style_shadow_color(obj, lv_color_hex(0x202060), 0);
+
+    return obj;
+}
+
+void test_draw_shadow_cache_hit(void)
+{
+#if !LV_USE_DRAW_SW || !LV_DRAW_SW_COMPLEX || LV_DRAW_SW_SHADOW_CACHE_SIZE < 40 || LV_USE_DRAW_VG_LITE
+    TEST_PASS();
+#else
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_reset_stats();
+
+    /*Cards: the same shadow on areas larger than the corner*/
+    shadow_obj_create(40, 40, 160, 100, 20, 10);
+    shadow_obj_create(260, 40, 200, 120, 20, 10);
+    shadow_obj_create(520, 40, 120, 160, 20, 10);
+
+    /*Buttons: an other shadow size*/
+    shadow_obj_create(40, 260, 100, 40, 10, 5);
+    shadow_obj_create(200, 260, 140, 40, 10, 5);
+
+    /*Same shadow but the area is so small that its sides affect the corners*/
+    shadow_obj_create(420, 260, 30, 30, 20, 10);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/shadow_cache.png");
+
+    lv_draw_sw_shadow_cache_stats_t stats;
+    lv_draw_sw_shadow_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.hit_cnt);
+
+    /*Now all the corners are cached and they look the same*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/shadow_cache.png");
+
+    lv_draw_sw_shadow_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(9, stats.hit_cnt);
+#endif
+}
+
+void test_draw_shadow_cache_evict(void)
+{
+#if !LV_USE_DRAW_SW || !LV_DRAW_SW_COMPLEX || LV_DRAW_SW_SHADOW_CACHE_SIZE < 40 || LV_USE_DRAW_VG_LITE
+    TEST_PASS();
+#else
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_reset_stats();
+
+    /*More shadow sizes than the cached corners*/
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_SHADOW_CACHE_CNT + 1; i++) {
+        shadow_obj_create(20 + i * 120, 40, 100, 100, 10 + i * 4, 8);
+    }
+    lv_refr_now(NULL);
+
+    lv_draw_sw_shadow_cache_stats_t stats;
+    lv_draw_sw_shadow_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_SHADOW_CACHE_CNT + 1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+
+    /*Drawn in the same order, the least recently used corner is always dropped
+     *just before it would be used again*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2 * (LV_DRAW_SW_SHADOW_CACHE_CNT + 1), stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+
+    /*Only the most recently used ones are kept*/
+    lv_obj_delete(lv_obj_get_child(lv_screen_active(), 0));
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2 * (LV_DRAW_SW_SHADOW_CACHE_CNT + 1), stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_SHADOW_CACHE_CNT, stats.hit_cnt);
+#endif
+}
+
+#endif
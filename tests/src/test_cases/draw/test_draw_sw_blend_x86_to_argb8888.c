@@ -0,0 +1,193 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 && LV_DRAW_SW_SUPPORT_ARGB8888
+
+/*Compile the generic C blending once more without the x86 hooks to use it as reference*/
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(...)                             LV_RESULT_INVALID
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(...)                    LV_RESULT_INVALID
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(...)                   LV_RESULT_INVALID
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(...)                LV_RESULT_INVALID
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(...)                   LV_RESULT_INVALID
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(...)          LV_RESULT_INVALID
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(...)         LV_RESULT_INVALID
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(...)      LV_RESULT_INVALID
+
+#define lv_draw_sw_blend_color_to_argb8888  ref_blend_color_to_argb8888
+#define lv_draw_sw_blend_image_to_argb8888  ref_blend_image_to_argb8888
+#define lv_color_mix_with_alpha_cache_init  ref_color_mix_with_alpha_cache_init
+#include "../../../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.c"
+#undef lv_draw_sw_blend_color_to_argb8888
+#undef lv_draw_sw_blend_image_to_argb8888
+#undef lv_color_mix_with_alpha_cache_init
+
+/*The blend functions of the library, using the x86 hooks*/
+void lv_draw_sw_blend_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc);
+void lv_draw_sw_blend_image_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/*Not a multiple of the vector widths to test the tails too*/
+#define W               67
+#define H               5
+#define DEST_STRIDE     ((W + 3) * 4)
+#define SRC_STRIDE      ((W + 1) * 4)
+#define MASK_STRIDE     (W + 5)
+
+static uint8_t dest_ref[H * DEST_STRIDE];
+static uint8_t dest_x86[H * DEST_STRIDE];
+static uint8_t src_buf[H * SRC_STRIDE];
+static lv_opa_t mask_buf[H * MASK_STRIDE];
+
+static const lv_opa_t opa_cases[] = {LV_OPA_COVER, LV_OPA_MAX, 200, LV_OPA_50, 7};
+
+/**
+ * Get a random opacity which is often fully transparent or opaque
+ */
+static lv_opa_t random_opa(void)
+{
+    switch(lv_rand(0, 3)) {
+        case 0:
+            return LV_OPA_TRANSP;
+        case 1:
+            return LV_OPA_COVER;
+        default:
+            return (lv_opa_t)lv_rand(0, 255);
+    }
+}
+
+static void randomize(uint8_t * buf, uint32_t size)
+{
+    uint32_t i;
+    for(i = 0; i < size; i++) buf[i] = (uint8_t)lv_rand(0, 255);
+}
+
+/**
+ * Fill the destination with random pixels. Most of them are opaque
+ * as the x86 code handles the opaque and the transparent destinations differently.
+ */
+static void randomize_dest(void)
+{
+    randomize(dest_ref, sizeof(dest_ref));
+    uint32_t i;
+    for(i = 3; i < sizeof(dest_ref); i += 4) {
+        if(lv_rand(0, 3)) dest_ref[i] = LV_OPA_COVER;
+    }
+    lv_memcpy(dest_x86, dest_ref, sizeof(dest_ref));
+}
+
+static void randomize_mask(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(mask_buf); i++) mask_buf[i] = random_opa();
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 && LV_DRAW_SW_SUPPORT_ARGB8888*/
+
+void setUp(void)
+{
+    lv_rand_set_seed(0x12345678);
+}
+
+void tearDown(void)
+{
+}
+
+void test_blend_color_to_argb8888_matches_the_c_reference(void)
+{
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 && LV_DRAW_SW_SUPPORT_ARGB8888
+    uint32_t i;
+    uint32_t masked;
+    uint32_t rep;
+    for(i = 0; i < sizeof(opa_cases); i++) {
+        for(masked = 0; masked < 2; masked++) {
+            for(rep = 0; rep < 4; rep++) {
+                lv_draw_sw_blend_fill_dsc_t dsc;
+                lv_memzero(&dsc, sizeof(dsc));
+                dsc.dest_w = W;
+                dsc.dest_h = H;
+                dsc.dest_stride = DEST_STRIDE;
+                dsc.color = lv_color_hex(lv_rand(0, 0xffffff));
+                dsc.opa = opa_cases[i];
+                lv_area_set(&dsc.relative_area, 0, 0, W - 1, H - 1);
+                if(masked) {
+                    randomize_mask();
+                    dsc.mask_buf = mask_buf;
+                    dsc.mask_stride = MASK_STRIDE;
+                }
+                randomize_dest();
+
+                dsc.dest_buf = dest_ref;
+                ref_blend_color_to_argb8888(&dsc);
+                dsc.dest_buf = dest_x86;
+                lv_draw_sw_blend_color_to_argb8888(&dsc);
+
+                char msg[64];
+                lv_snprintf(msg, sizeof(msg), "opa %d, mask %d", dsc.opa, (int)masked);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(dest_ref, dest_x86, sizeof(dest_ref), msg);
+            }
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Requires the x86 blending, LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2");
+#endif
+}
+
+void test_blend_image_to_argb8888_matches_the_c_reference(void)
+{
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2 && LV_DRAW_SW_SUPPORT_ARGB8888
+    static const lv_color_format_t src_cfs[] = {
+        LV_COLOR_FORMAT_RGB565,
+        LV_COLOR_FORMAT_RGB888,
+        LV_COLOR_FORMAT_XRGB8888,
+        LV_COLOR_FORMAT_ARGB8888,
+    };
+
+    uint32_t cf;
+    uint32_t i;
+    uint32_t masked;
+    for(cf = 0; cf < sizeof(src_cfs) / sizeof(src_cfs[0]); cf++) {
+        for(i = 0; i < sizeof(opa_cases); i++) {
+            for(masked = 0; masked < 2; masked++) {
+                lv_draw_sw_blend_image_dsc_t dsc;
+                lv_memzero(&dsc, sizeof(dsc));
+                dsc.dest_w = W;
+                dsc.dest_h = H;
+                dsc.dest_stride = DEST_STRIDE;
+                dsc.src_buf = src_buf;
+                dsc.src_stride = SRC_STRIDE;
+                dsc.src_color_format = src_cfs[cf];
+                dsc.opa = opa_cases[i];
+                dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+                lv_area_set(&dsc.relative_area, 0, 0, W - 1, H - 1);
+                lv_area_set(&dsc.src_area, 0, 0, W - 1, H - 1);
+                if(masked) {
+                    randomize_mask();
+                    dsc.mask_buf = mask_buf;
+                    dsc.mask_stride = MASK_STRIDE;
+                }
+                randomize(src_buf, sizeof(src_buf));
+                if(src_cfs[cf] == LV_COLOR_FORMAT_ARGB8888) {
+                    uint32_t j;
+                    for(j = 3; j < sizeof(src_buf); j += 4) src_buf[j] = random_opa();
+                }
+                randomize_dest();
+
+                dsc.dest_buf = dest_ref;
+                ref_blend_image_to_argb8888(&dsc);
+                dsc.dest_buf = dest_x86;
+                lv_draw_sw_blend_image_to_argb8888(&dsc);
+
+                char msg[64];
+                lv_snprintf(msg, sizeof(msg), "src cf 0x%02x, opa %d, mask %d", src_cfs[cf], dsc.opa, (int)masked);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(dest_ref, dest_x86, sizeof(dest_ref), msg);
+            }
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Requires the x86 blending, LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_AVX2");
+#endif
+}
+
+#endif
@@ -412,6 +412,65 @@ void test_draw_during_rendering(void)
     draw_during_rendering("lines_opa_50", draw_lines, LV_OPA_50);
 }
 
+static lv_draw_buf_t * partial_full_buf;
+
+static void partial_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    /* collect the flushed bands in the screen sized buffer */
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(lv_draw_buf_goto_xy(partial_full_buf, area->x1, y), px_map, w * lv_color_format_get_size(cf));
+        px_map += stride;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static void draw_in_partial_mode(const char * name, draw_cb_t draw_cb)
+{
+    /* 50 rows per band, so most of the bands don't start at the top of the screen.
+     * The size of the draw buffer is rounded up to LV_DRAW_BUF_ALIGN and one more is needed to align the start. */
+    static LV_ATTRIBUTE_MEM_ALIGN uint8_t partial_buf[800 * 50 * 4 + 2 * LV_DRAW_BUF_ALIGN];
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    lv_display_flush_cb_t flush_cb_ori = disp->flush_cb;
+    partial_full_buf = lv_display_get_buf_active(disp);
+    lv_draw_buf_clear(partial_full_buf, NULL);
+
+    lv_display_set_buffers(disp, lv_draw_buf_align(partial_buf, cf), NULL, sizeof(partial_buf) - LV_DRAW_BUF_ALIGN,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, partial_flush_cb);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, lv_pct(90), lv_pct(90));
+    lv_obj_center(obj);
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_DRAW_MAIN, (void *)(lv_uintptr_t)draw_cb);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+
+    lv_display_set_draw_buffers(disp, partial_full_buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(disp, flush_cb_ori);
+
+    /* the bands have their own references as the anti-aliasing of the edges starting in a new band can differ by 1 */
+    char fn_buf[128];
+    lv_snprintf(fn_buf, sizeof(fn_buf), "draw/vector_draw_%s_partial" EXT_NAME, name);
+    TEST_ASSERT_EQUAL_MESSAGE(LV_TEST_SCREENSHOT_RESULT_PASSED, lv_test_screenshot_compare_core(fn_buf), fn_buf);
+
+    lv_obj_delete(obj);
+}
+
+void test_draw_in_partial_mode(void)
+{
+    draw_in_partial_mode("shapes", draw_shapes);
+    draw_in_partial_mode("lines", draw_lines);
+}
+
 void test_draw_display_matrix_rotation(void)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
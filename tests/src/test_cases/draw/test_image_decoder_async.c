@@ -0,0 +1,146 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define PNG_FILE    "A:src/test_assets/test_img_lvgl_logo.png"
+#define JPG_FILE    "A:src/test_assets/test_img_lvgl_logo.jpg"
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_image_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Let the decoder threads run and the LVGL timers call the ready callbacks
+ */
+static void wait_decoding(void)
+{
+    uint32_t i;
+    for(i = 0; i < 1000 && lv_image_decoder_async_get_pending_count() > 0; i++) {
+        lv_sleep_ms(2);
+        lv_test_wait(10);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+}
+
+static bool is_cached(const void * src)
+{
+    lv_image_decoder_dsc_t dsc;
+    if(lv_image_decoder_open(&dsc, src, NULL) != LV_RESULT_OK) return false;
+    bool from_cache = dsc.from_cache;
+    lv_image_decoder_close(&dsc);
+    return from_cache;
+}
+
+static lv_obj_t * async_image_create(const void * src)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_placeholder_src(img, &test_image_cogwheel_rgb565);
+    lv_image_set_src(img, src);
+    return img;
+}
+
+#endif
+
+void test_image_decoder_async_prefetch(void)
+{
+#if !LV_USE_IMAGE_DECODER_ASYNC || LV_CACHE_DEF_SIZE == 0
+    TEST_PASS();
+#else
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(JPG_FILE));
+
+    /*The same image is decoded only once*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, lv_image_decoder_async_get_pending_count());
+
+    wait_decoding();
+    TEST_ASSERT_TRUE(is_cached(PNG_FILE));
+    TEST_ASSERT_TRUE(is_cached(JPG_FILE));
+
+    /*Already cached*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(NULL));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(LV_SYMBOL_OK));
+#endif
+}
+
+void test_image_decoder_async_placeholder(void)
+{
+#if !LV_USE_IMAGE_DECODER_ASYNC || LV_CACHE_DEF_SIZE == 0
+    TEST_PASS();
+#else
+    lv_obj_t * img1 = async_image_create(PNG_FILE);
+    lv_obj_align(img1, LV_ALIGN_LEFT_MID, 40, 0);
+
+    /*Same image, only one decoding*/
+    lv_obj_t * img2 = async_image_create(PNG_FILE);
+    lv_obj_align(img2, LV_ALIGN_RIGHT_MID, -40, 0);
+    lv_image_set_rotation(img2, 300);
+
+    /*The ready callbacks are called only from the timers so the placeholders are drawn first*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_async_placeholder.png");
+    TEST_ASSERT_TRUE(lv_image_is_decode_pending(img1));
+    TEST_ASSERT_TRUE(lv_image_is_decode_pending(img2));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+
+    wait_decoding();
+    TEST_ASSERT_FALSE(lv_image_is_decode_pending(img1));
+    TEST_ASSERT_FALSE(lv_image_is_decode_pending(img2));
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_async_ready.png");
+
+    /*Drawn the same way without the background decoding*/
+    lv_image_set_decode_async(img1, false);
+    lv_image_set_decode_async(img2, false);
+    lv_image_cache_drop(NULL);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_async_ready.png");
+#endif
+}
+
+void test_image_decoder_async_delete_pending(void)
+{
+#if !LV_USE_IMAGE_DECODER_ASYNC || LV_CACHE_DEF_SIZE == 0
+    TEST_PASS();
+#else
+    lv_obj_t * img = async_image_create(JPG_FILE);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_is_decode_pending(img));
+
+    /*The ready callback of a deleted image must not be called*/
+    lv_obj_delete(img);
+    wait_decoding();
+    TEST_ASSERT_TRUE(is_cached(JPG_FILE));
+
+    /*Cached images are drawn right away*/
+    img = async_image_create(JPG_FILE);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lv_image_is_decode_pending(img));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+
+    /*Changing the source to an uncached one starts a new decoding*/
+    lv_image_set_src(img, PNG_FILE);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_is_decode_pending(img));
+    wait_decoding();
+    TEST_ASSERT_FALSE(lv_image_is_decode_pending(img));
+#endif
+}
+
+#endif
@@ -116,4 +116,104 @@ void test_jpg_decode_failed(void)
     TEST_ASSERT_EQUAL(LV_RESULT_INVALID, res);
 }
 
+static void create_scaled_images(const char * img_src, int32_t y)
+{
+    static const int32_t scales[] = {256, 128, 100, 64, 32};
+    uint32_t i;
+    for(i = 0; i < sizeof(scales) / sizeof(scales[0]); i++) {
+        lv_obj_t * img = lv_image_create(lv_screen_active());
+        lv_image_set_src(img, img_src);
+        lv_image_set_scale(img, scales[i]);
+        lv_obj_set_pos(img, 20 + i * 120, y);
+    }
+
+    /* Rotated around the center */
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, img_src);
+    lv_image_set_scale(img, 100);
+    lv_image_set_rotation(img, 300);
+    lv_obj_set_pos(img, 20 + i * 120, y);
+}
+
+static void create_downscaled_images(void)
+{
+    lv_obj_clean(lv_screen_active());
+    create_scaled_images("A:src/test_assets/test_img_lvgl_logo.jpg", 20);
+    create_scaled_images("A:src/test_assets/test_img_lvgl_logo_cmyk.jpg", 120);
+    create_scaled_images("A:src/test_assets/test_img_lvgl_logo_with_exif_orientation_90.jpg", 220);
+}
+
+void test_jpg_downscale(void)
+{
+    lv_image_cache_drop(NULL);
+
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.jpg";
+    lv_image_decoder_args_t args = {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .downscale = 2,
+    };
+
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, &args));
+    TEST_ASSERT_EQUAL_INT32(53, dsc.decoded->header.w);
+    TEST_ASSERT_EQUAL_INT32(20, dsc.decoded->header.h);
+    lv_image_decoder_close(&dsc);
+
+    /* The full size image is cached separately */
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    TEST_ASSERT_FALSE(dsc.from_cache);
+    TEST_ASSERT_EQUAL_INT32(105, dsc.decoded->header.w);
+    lv_image_decoder_close(&dsc);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, &args));
+    TEST_ASSERT_TRUE(dsc.from_cache);
+    TEST_ASSERT_EQUAL_INT32(53, dsc.decoded->header.w);
+    lv_image_decoder_close(&dsc);
+
+    create_downscaled_images();
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_downscale.png");
+
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_jpg_get_area(void)
+{
+    /* Without image cache only the drawn area is decoded in bands */
+    lv_image_cache_resize(0, true);
+
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.jpg";
+    lv_image_decoder_args_t args = {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .use_get_area = true,
+    };
+
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, &args));
+    TEST_ASSERT_NULL(dsc.decoded);
+    lv_image_decoder_close(&dsc);
+
+    /* The rotated images are decoded as a whole */
+    create_images();
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+
+    /* Redraw an area which cuts the images */
+    lv_area_t area = {100, 70, 700, 100};
+    lv_obj_invalidate_area(lv_screen_active(), &area);
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_2.png");
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 10; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 128);
+
+    /* The same as the downscaled images in the cache */
+    create_downscaled_images();
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/jpg_downscale.png");
+
+    lv_image_cache_resize(LV_CACHE_DEF_SIZE, true);
+    lv_obj_clean(lv_screen_active());
+}
+
 #endif
@@ -0,0 +1,246 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_anim_batch_t * batch;
+static uint32_t exec_cnt;
+static uint32_t completed_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    exec_cnt = 0;
+    completed_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    if(batch) {
+        lv_anim_batch_delete(batch);
+        batch = NULL;
+    }
+    lv_obj_clean(lv_screen_active());
+    lv_anim_delete_all();
+}
+
+static void exec_cb(void * var, int32_t v)
+{
+    int32_t * var_i32 = var;
+    *var_i32 = v;
+}
+
+static void batch_exec_cb(lv_anim_batch_t * b, uint32_t index, void * var, const int32_t * values)
+{
+    LV_UNUSED(b);
+    LV_UNUSED(index);
+    int32_t * var_i32 = var;
+    *var_i32 = values[0];
+    exec_cnt++;
+}
+
+static void batch_obj_exec_cb(lv_anim_batch_t * b, uint32_t index, void * var, const int32_t * values)
+{
+    LV_UNUSED(b);
+    LV_UNUSED(index);
+    lv_obj_set_pos(var, values[0], values[1]);
+    exec_cnt++;
+}
+
+static void batch_completed_cb(lv_anim_batch_t * b)
+{
+    LV_UNUSED(b);
+    completed_cnt++;
+}
+
+/**
+ * Check that an item of a batch has the same values as an `lv_anim_t` with the same path
+ */
+static void check_path(lv_anim_path_cb_t path_cb, const lv_anim_bezier3_para_t * bezier3)
+{
+    int32_t var_anim = 0;
+    int32_t var_batch = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var_anim);
+    lv_anim_set_values(&a, -300, 500);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_set_path_cb(&a, path_cb);
+    if(bezier3) a.parameter.bezier3 = *bezier3;
+
+    batch = lv_anim_batch_create(1);
+    lv_anim_batch_set_exec_cb(batch, batch_exec_cb);
+    if(bezier3) lv_anim_batch_set_bezier3_param(batch, bezier3->x1, bezier3->y1, bezier3->x2, bezier3->y2);
+    lv_anim_batch_set_path_cb(batch, path_cb);
+    int32_t index = lv_anim_batch_add(batch, &var_batch, 1000, 0);
+    TEST_ASSERT_EQUAL_INT32(0, index);
+    lv_anim_batch_set_values(batch, index, 0, -300, 500);
+
+    lv_anim_start(&a);
+    lv_anim_batch_start(batch);
+    TEST_ASSERT_EQUAL_INT32(var_anim, var_batch);
+
+    uint32_t t;
+    for(t = 0; t < 1100; t += 37) {
+        lv_tick_inc(37);
+        lv_anim_refr_now();
+        TEST_ASSERT_EQUAL_INT32(var_anim, var_batch);
+        TEST_ASSERT_EQUAL_INT32(var_batch, lv_anim_batch_get_value(batch, index, 0));
+    }
+
+    TEST_ASSERT_EQUAL_INT32(500, var_batch);
+    TEST_ASSERT_FALSE(lv_anim_batch_is_running(batch));
+
+    lv_anim_batch_delete(batch);
+    batch = NULL;
+}
+
+void test_anim_batch_paths(void)
+{
+    check_path(lv_anim_path_linear, NULL);
+    check_path(lv_anim_path_ease_in, NULL);
+    check_path(lv_anim_path_ease_in_out, NULL);
+    check_path(lv_anim_path_overshoot, NULL);
+    check_path(lv_anim_path_step, NULL);
+
+    lv_anim_bezier3_para_t bezier3 = {LV_BEZIER_VAL_FLOAT(0.68), LV_BEZIER_VAL_FLOAT(-0.6),
+                                      LV_BEZIER_VAL_FLOAT(0.32), LV_BEZIER_VAL_FLOAT(1.6)
+                                     };
+    check_path(lv_anim_path_custom_bezier3, &bezier3);
+}
+
+void test_anim_batch_objects(void)
+{
+    lv_obj_t * objs[3];
+    batch = lv_anim_batch_create(2);
+    lv_anim_batch_set_exec_cb(batch, batch_obj_exec_cb);
+    lv_anim_batch_set_completed_cb(batch, batch_completed_cb);
+    lv_anim_batch_set_path_cb(batch, lv_anim_path_ease_out);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        int32_t index = lv_anim_batch_add(batch, objs[i], 200 + i * 100, 0);
+        lv_anim_batch_set_values(batch, index, 0, 10, 100 + i * 100);
+        lv_anim_batch_set_values(batch, index, 1, 20, 50 + i * 50);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, lv_anim_batch_get_count(batch));
+
+    /*The start values are applied right away, with one call for both coordinates*/
+    lv_anim_batch_start(batch);
+    TEST_ASSERT_EQUAL_UINT32(3, exec_cnt);
+    lv_obj_update_layout(objs[2]);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_x(objs[2]));
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_y(objs[2]));
+    TEST_ASSERT_FALSE(lv_timer_get_paused(lv_anim_get_timer()));
+
+    exec_cnt = 0;
+    lv_test_wait(100);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(3 * 100 / LV_DEF_REFR_PERIOD + 3, exec_cnt);
+
+    lv_test_wait(400);
+    TEST_ASSERT_EQUAL_UINT32(1, completed_cnt);
+    TEST_ASSERT_FALSE(lv_anim_batch_is_running(batch));
+    for(i = 0; i < 3; i++) {
+        lv_obj_update_layout(objs[i]);
+        TEST_ASSERT_EQUAL_INT32(100 + i * 100, lv_obj_get_x(objs[i]));
+        TEST_ASSERT_EQUAL_INT32(50 + i * 50, lv_obj_get_y(objs[i]));
+    }
+
+    /*Nothing to animate, the timer is paused*/
+    TEST_ASSERT_TRUE(lv_timer_get_paused(lv_anim_get_timer()));
+
+    /*Deleted objects are not animated anymore*/
+    lv_anim_batch_start(batch);
+    lv_obj_delete(objs[1]);
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL_UINT32(2, completed_cnt);
+    TEST_ASSERT_EQUAL_INT32(300, lv_obj_get_x(objs[2]));
+}
+
+void test_anim_batch_delay_repeat(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+
+    batch = lv_anim_batch_create(1);
+    lv_anim_batch_set_exec_cb(batch, batch_exec_cb);
+    lv_anim_batch_set_completed_cb(batch, batch_completed_cb);
+    lv_anim_batch_set_repeat_count(batch, 2);
+    lv_anim_batch_set_repeat_delay(batch, 100);
+
+    int32_t index = lv_anim_batch_add(batch, &var1, 100, 0);
+    lv_anim_batch_set_values(batch, index, 0, 0, 100);
+    index = lv_anim_batch_add(batch, &var2, 100, 200);
+    lv_anim_batch_set_values(batch, index, 0, 1000, 2000);
+
+    lv_anim_batch_start(batch);
+    TEST_ASSERT_EQUAL_INT32(1000, var2);
+
+    lv_test_fast_forward(100);
+    TEST_ASSERT_EQUAL_INT32(100, var1);
+    TEST_ASSERT_EQUAL_INT32(1000, var2);
+
+    /*The first item keeps its end value while waiting to repeat*/
+    lv_test_fast_forward(50);
+    TEST_ASSERT_EQUAL_INT32(100, var1);
+    TEST_ASSERT_EQUAL_INT32(1000, var2);
+
+    /*The first item has restarted, the second has started*/
+    lv_test_fast_forward(100);
+    TEST_ASSERT_EQUAL_INT32(50, var1);
+    TEST_ASSERT_EQUAL_INT32(1500, var2);
+
+    lv_test_fast_forward(50);
+    TEST_ASSERT_EQUAL_INT32(100, var1);
+    TEST_ASSERT_EQUAL_INT32(2000, var2);
+    TEST_ASSERT_EQUAL_UINT32(0, completed_cnt);
+
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_UINT32(1, completed_cnt);
+    TEST_ASSERT_EQUAL_INT32(100, var1);
+    TEST_ASSERT_EQUAL_INT32(2000, var2);
+
+    /*Infinite repeat runs until stopped*/
+    lv_anim_batch_set_repeat_count(batch, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_batch_start(batch);
+    lv_test_fast_forward(5000);
+    TEST_ASSERT_TRUE(lv_anim_batch_is_running(batch));
+    lv_anim_batch_stop(batch);
+    TEST_ASSERT_FALSE(lv_anim_batch_is_running(batch));
+    TEST_ASSERT_EQUAL_UINT32(1, completed_cnt);
+}
+
+void test_anim_batch_many_items(void)
+{
+    static int32_t vars[1000];
+
+    batch = lv_anim_batch_create(3);
+    lv_anim_batch_set_exec_cb(batch, batch_exec_cb);
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        int32_t index = lv_anim_batch_add(batch, &vars[i], 100 + i, 0);
+        TEST_ASSERT_EQUAL_INT32(i, index);
+        lv_anim_batch_set_values(batch, index, 0, 0, i);
+        lv_anim_batch_set_values(batch, index, 2, i, 0);
+    }
+
+    lv_anim_batch_start(batch);
+    lv_test_fast_forward(2000);
+    for(i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL_INT32(i, vars[i]);
+        TEST_ASSERT_EQUAL_INT32(0, lv_anim_batch_get_value(batch, i, 1));
+        TEST_ASSERT_EQUAL_INT32(0, lv_anim_batch_get_value(batch, i, 2));
+    }
+
+    lv_anim_batch_clear(batch);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_anim_batch_get_count(batch));
+    TEST_ASSERT_FALSE(lv_anim_batch_is_running(batch));
+}
+
+#endif
@@ -624,4 +624,97 @@ void test_display_rotate_point(void)
     lv_display_delete(disp);
 }
 
+void test_display_inv_areas_grow(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+
+    /*Far enough from each other to not be joined*/
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y + 30 <= lv_display_get_vertical_resolution(disp); y += 50) {
+        for(x = 0; x + 30 <= lv_display_get_horizontal_resolution(disp); x += 50) {
+            lv_area_t a = {x, y, x + 29, y + 29};
+            lv_inv_area(disp, &a);
+            cnt++;
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN(LV_INV_BUF_SIZE, cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt, disp->inv_p);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(cnt, disp->inv_area_cap);
+
+    lv_refr_now(disp);
+
+    lv_display_refr_stats_t stats;
+    lv_display_get_refr_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(cnt, stats.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt * 30 * 30, stats.inv_px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt, stats.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt * 30 * 30, stats.refr_px_cnt);
+}
+
+void test_display_inv_areas_overflow(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    lv_refr_now(disp);
+
+    /*More single pixels than the buffer can store*/
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < ver_res; y += 19) {
+        for(x = 0; x < hor_res; x += 20) {
+            lv_area_t a = {x, y, x, y};
+            lv_inv_area(disp, &a);
+            cnt++;
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN(LV_INV_BUF_MAX_SIZE, cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_MAX_SIZE, disp->inv_p);
+
+    /*The overflowing pixels are joined to the nearby areas instead of invalidating the whole screen*/
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        TEST_ASSERT_LESS_THAN_UINT32(hor_res * 2, lv_area_get_size(&disp->inv_areas[i]));
+    }
+
+    lv_refr_now(disp);
+
+    lv_display_refr_stats_t stats;
+    lv_display_get_refr_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(cnt, stats.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt, stats.inv_px_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.refr_area_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(hor_res * ver_res / 4, stats.refr_px_cnt);
+}
+
+void test_display_refr_stats_joined(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_refr_now(disp);
+
+    /*Overlapping areas are rendered as one*/
+    lv_area_t a1 = {10, 10, 109, 109};
+    lv_area_t a2 = {60, 10, 159, 109};
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+
+    /*Already invalidated area*/
+    lv_area_t a3 = {20, 20, 29, 29};
+    lv_inv_area(disp, &a3);
+    lv_refr_now(disp);
+
+    lv_display_refr_stats_t stats;
+    lv_display_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 100 * 2 + 10 * 10, stats.inv_px_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.refr_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(150 * 100, stats.refr_px_cnt);
+}
+
 #endif
@@ -25,6 +25,8 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void compare_cached_bitmaps(lv_font_t * f1, lv_font_t * f2);
+static void draw_fonts(void);
 void test_font_loader_with_cache(void);
 void test_font_loader_no_cache(void);
 void test_font_loader_from_buffer(void);
@@ -72,6 +74,11 @@ static void common(void)
     compare_fonts(&test_font_2, font_2_bin);
     compare_fonts(&test_font_3, font_3_bin);
 
+    draw_fonts();
+}
+
+static void draw_fonts(void)
+{
     /* create labels for testing */
     lv_obj_t * scr = lv_screen_active();
     lv_obj_t * label1 = lv_label_create(scr);
@@ -145,6 +152,62 @@ void test_font_loader_from_buffer(void)
     common();
 }
 
+#if LV_BINFONT_ZERO_COPY
+static bool is_in_buffer(const void * p, const void * buf, uint32_t size)
+{
+    return (const uint8_t *)p >= (const uint8_t *)buf && (const uint8_t *)p < (const uint8_t *)buf + size;
+}
+
+void test_font_loader_zero_copy(void)
+{
+    /*The tables of a font in a buffer are used from the buffer*/
+    font_1_bin = lv_binfont_create_from_buffer((void *)&test_font_1_buf, sizeof(test_font_1_buf));
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    const lv_font_fmt_txt_dsc_t * dsc = font_1_bin->dsc;
+    uint32_t in_buffer_cnt = 0;
+    for(uint32_t i = 0; i < dsc->cmap_num; i++) {
+        if(dsc->cmaps[i].glyph_id_ofs_list &&
+           is_in_buffer(dsc->cmaps[i].glyph_id_ofs_list, test_font_1_buf, sizeof(test_font_1_buf))) in_buffer_cnt++;
+        if(dsc->cmaps[i].unicode_list &&
+           is_in_buffer(dsc->cmaps[i].unicode_list, test_font_1_buf, sizeof(test_font_1_buf))) in_buffer_cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, in_buffer_cnt);
+
+    /*The glyph bitmaps are not byte aligned in the test fonts, so they are copied*/
+    TEST_ASSERT_FALSE(is_in_buffer(dsc->glyph_bitmap, test_font_1_buf, sizeof(test_font_1_buf)));
+
+    /*Also from files mapped by the POSIX driver*/
+    font_2_bin = lv_binfont_create("B:src/test_assets/test_font_2.fnt");
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+    font_3_bin = lv_binfont_create_from_buffer((void *)&test_font_3_buf, sizeof(test_font_3_buf));
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    common();
+}
+#endif
+
+void test_font_loader_bitmap_cache(void)
+{
+    /*Read the bitmaps on demand with a cache smaller than the fonts to evict bitmaps too*/
+    font_1_bin = lv_binfont_create_ex("A:src/test_assets/test_font_1.fnt", 512);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_ex("B:src/test_assets/test_font_2.fnt", 512);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    lv_fs_path_ex_t mempath;
+    lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, test_font_3_buf, sizeof(test_font_3_buf), "bin");
+    font_3_bin = lv_binfont_create_ex((const char *)&mempath, 512);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    compare_cached_bitmaps(&test_font_1, font_1_bin);
+    compare_cached_bitmaps(&test_font_2, font_2_bin);
+    compare_cached_bitmaps(&test_font_3, font_3_bin);
+
+    draw_fonts();
+}
+
 void test_font_loader_reload(void)
 {
     /*Reload a font which is being used by a label*/
@@ -178,6 +241,41 @@ void test_font_loader_reload(void)
     lv_binfont_destroy(font);
 }
 
+static void compare_cached_bitmaps(lv_font_t * f1, lv_font_t * f2)
+{
+    lv_font_fmt_txt_dsc_t * dsc1 = (lv_font_fmt_txt_dsc_t *)f1->dsc;
+    lv_font_fmt_txt_dsc_t * dsc2 = (lv_font_fmt_txt_dsc_t *)f2->dsc;
+
+    /*The bitmaps are not loaded with the font*/
+    TEST_ASSERT_NULL(dsc2->glyph_bitmap);
+
+    uint32_t total_glyphs = 0;
+    for(uint32_t i = 0; i < dsc1->cmap_num; ++i) {
+        total_glyphs += dsc1->cmaps[i].unicode_list ? dsc1->cmaps[i].list_length : dsc1->cmaps[i].range_length;
+    }
+
+    /*Compare the raw bitmaps of the glyphs. The last glyph's size is unknown in the C font.*/
+    const lv_font_fmt_txt_glyph_dsc_t * glyph_dsc1 = dsc1->glyph_dsc;
+    for(uint32_t gid = 1; gid < total_glyphs; gid++) {
+        int32_t size = (int32_t)glyph_dsc1[gid + 1].bitmap_index - (int32_t)glyph_dsc1[gid].bitmap_index;
+        if(size <= 0) continue;
+
+        lv_font_glyph_dsc_t g;
+        lv_memzero(&g, sizeof(g));
+        g.resolved_font = f2;
+        g.gid.index = gid;
+        g.req_raw_bitmap = 1;
+
+        const uint8_t * bitmap = f2->get_glyph_bitmap(&g, NULL);
+        TEST_ASSERT_NOT_NULL(bitmap);
+        TEST_ASSERT_NOT_NULL(g.entry);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(dsc1->glyph_bitmap + glyph_dsc1[gid].bitmap_index, bitmap, size - 1);
+
+        lv_font_glyph_release_draw_data(&g);
+        TEST_ASSERT_NULL(g.entry);
+    }
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
@@ -0,0 +1,148 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ROW_CNT     40
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * value_labels[ROW_CNT];
+static lv_obj_t * unit_labels[ROW_CNT];
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+/**
+ * Create a dashboard like column of rows with a name, a value and a unit label in each
+ */
+static lv_obj_t * dashboard_create(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 300, 400);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Sensor %" LV_PRIu32, i);
+
+        value_labels[i] = lv_label_create(row);
+        lv_obj_set_width(value_labels[i], 60);
+        lv_label_set_text(value_labels[i], "10");
+
+        unit_labels[i] = lv_label_create(row);
+        lv_label_set_text(unit_labels[i], "C");
+    }
+
+    lv_refr_now(NULL);
+
+    return cont;
+}
+
+void test_layout_update_same_size(void)
+{
+    dashboard_create();
+
+    lv_display_refr_stats_t stats;
+
+    /*The size of the label doesn't change so the flex containers are not updated*/
+    lv_label_set_text(value_labels[5], "23");
+    lv_refr_now(NULL);
+    lv_display_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.layout_pass_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.layout_obj_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.layout_apply_cnt);
+
+    /*Non-layout style properties don't update the layout at all*/
+    lv_obj_set_style_text_color(value_labels[5], lv_palette_main(LV_PALETTE_RED), 0);
+    lv_refr_now(NULL);
+    lv_display_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.layout_pass_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.layout_obj_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.layout_apply_cnt);
+}
+
+void test_layout_update_size_changed(void)
+{
+    lv_obj_t * cont = dashboard_create();
+
+    int32_t unit_x = lv_obj_get_x(unit_labels[2]);
+    int32_t row_h = lv_obj_get_height(lv_obj_get_parent(unit_labels[2]));
+    int32_t next_row_y = lv_obj_get_y(lv_obj_get_parent(unit_labels[3]));
+    lv_obj_t * last_row = lv_obj_get_child(cont, -1);
+    int32_t last_row_y = lv_obj_get_y(last_row);
+
+    /*Only the row of the label is updated as its height doesn't change*/
+    lv_obj_set_width(value_labels[2], 80);
+    lv_refr_now(NULL);
+
+    lv_display_refr_stats_t stats;
+    lv_display_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.layout_apply_cnt);
+    TEST_ASSERT_EQUAL_INT32(unit_x + 20, lv_obj_get_x(unit_labels[2]));
+    TEST_ASSERT_EQUAL_INT32(unit_x, lv_obj_get_x(unit_labels[3]));
+    TEST_ASSERT_EQUAL_INT32(next_row_y, lv_obj_get_y(lv_obj_get_parent(unit_labels[3])));
+
+    /*The height of the row changes too so the column is updated as well.
+     *The row is updated once more because of its size change, but the other rows are not touched.*/
+    lv_label_set_text(value_labels[2], "10\n20");
+    lv_refr_now(NULL);
+
+    lv_display_get_refr_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.layout_apply_cnt);
+    int32_t row_h_new = lv_obj_get_height(lv_obj_get_parent(unit_labels[2]));
+    TEST_ASSERT_GREATER_THAN_INT32(row_h, row_h_new);
+    TEST_ASSERT_EQUAL_INT32(next_row_y + row_h_new - row_h, lv_obj_get_y(lv_obj_get_parent(unit_labels[3])));
+
+    /*The last row is moved too*/
+    TEST_ASSERT_EQUAL_INT32(last_row_y + row_h_new - row_h, lv_obj_get_y(last_row));
+}
+
+void test_layout_update_deep_child(void)
+{
+    /*Nested widgets without layout: the dirty widget is found even if it's deep in a clean tree*/
+    lv_obj_t * parent = active_screen;
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+        lv_obj_set_style_pad_all(obj, 2, 0);
+        parent = obj;
+    }
+
+    lv_obj_t * leaf = lv_obj_create(parent);
+    lv_obj_set_size(leaf, 20, 20);
+    lv_refr_now(NULL);
+
+    lv_obj_t * top = lv_obj_get_child(active_screen, 0);
+    int32_t top_w = lv_obj_get_width(top);
+
+    lv_obj_set_size(leaf, 50, 20);
+    lv_obj_update_layout(leaf);
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_width(leaf));
+    TEST_ASSERT_EQUAL_INT32(top_w + 30, lv_obj_get_width(top));
+
+    /*Swapping moves the pending updates to the new parents too*/
+    lv_obj_t * other = lv_obj_create(active_screen);
+    lv_obj_set_size(other, 10, 10);
+    lv_refr_now(NULL);
+
+    lv_obj_set_size(leaf, 60, 20);
+    lv_obj_swap(leaf, other);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(60, lv_obj_get_width(leaf));
+    TEST_ASSERT_EQUAL_PTR(active_screen, lv_obj_get_parent(leaf));
+}
+
+#endif
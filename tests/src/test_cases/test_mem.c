@@ -139,6 +139,191 @@ void test_mem_test(void)
 #endif
 }
 
+void test_mem_slab_reuse(void)
+{
+#if LV_USE_MEM_SLAB
+    /*A freed small block is given out again for the same size class*/
+    void * buf1 = lv_malloc(24);
+    TEST_ASSERT_NOT_NULL(buf1);
+    lv_free(buf1);
+
+    void * buf2 = lv_malloc(20);
+    TEST_ASSERT_EQUAL_PTR(buf1, buf2);
+    lv_free(buf2);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(0, mon.slab_size);
+    TEST_ASSERT_GREATER_THAN(0, mon.slab_free_size);
+    TEST_ASSERT_LESS_OR_EQUAL(mon.slab_size, mon.slab_free_size);
+#endif
+}
+
+void test_mem_slab_realloc(void)
+{
+#if LV_USE_MEM_SLAB
+    uint8_t * buf = lv_malloc(16);
+    TEST_ASSERT_NOT_NULL(buf);
+    for(uint32_t i = 0; i < 16; i++) buf[i] = (uint8_t)i;
+
+    /*Fits into the same block*/
+    uint8_t * buf2 = lv_realloc(buf, 12);
+    TEST_ASSERT_EQUAL_PTR(buf, buf2);
+
+    /*Moves to a larger size class and then to the heap*/
+    buf = lv_realloc(buf2, 100);
+    TEST_ASSERT_NOT_NULL(buf);
+    for(uint32_t i = 0; i < 12; i++) TEST_ASSERT_EQUAL_UINT8(i, buf[i]);
+
+    buf = lv_realloc(buf, 1000);
+    TEST_ASSERT_NOT_NULL(buf);
+    for(uint32_t i = 0; i < 12; i++) TEST_ASSERT_EQUAL_UINT8(i, buf[i]);
+
+    buf = lv_realloc(buf, 8);
+    TEST_ASSERT_NOT_NULL(buf);
+    for(uint32_t i = 0; i < 8; i++) TEST_ASSERT_EQUAL_UINT8(i, buf[i]);
+
+    lv_free(buf);
+#endif
+}
+
+void test_mem_slab_histogram(void)
+{
+#if LV_USE_MEM_SLAB
+    lv_mem_monitor_t mon1;
+    lv_mem_monitor(&mon1);
+
+    void * buf1 = lv_malloc(10);
+    void * buf2 = lv_malloc(200);
+    void * buf3 = lv_malloc(5000);
+
+    lv_mem_monitor_t mon2;
+    lv_mem_monitor(&mon2);
+
+    lv_free(buf1);
+    lv_free(buf2);
+    lv_free(buf3);
+
+    TEST_ASSERT_EQUAL_UINT32(mon1.size_histogram[0] + 1, mon2.size_histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(mon1.size_histogram[4] + 1, mon2.size_histogram[4]);
+    TEST_ASSERT_EQUAL_UINT32(mon1.size_histogram[LV_MEM_SIZE_HISTOGRAM_CNT - 1] + 1,
+                             mon2.size_histogram[LV_MEM_SIZE_HISTOGRAM_CNT - 1]);
+#endif
+}
+
+#if LV_USE_MEM_SLAB && LV_USE_OS
+#define SLAB_THREAD_CNT     4
+#define SLAB_BLOCK_CNT      256
+
+typedef struct {
+    lv_thread_t thread;
+    uint32_t seed;
+    bool failed;
+} slab_thread_t;
+
+static void slab_thread_cb(void * user_data)
+{
+    slab_thread_t * t = user_data;
+    uint8_t * blocks[SLAB_BLOCK_CNT];
+    lv_memzero(blocks, sizeof(blocks));
+
+    /*Unity can't fail a test from another thread, so only note the errors here*/
+    for(uint32_t round = 0; round < 200; round++) {
+        for(uint32_t i = 0; i < SLAB_BLOCK_CNT; i++) {
+            t->seed = t->seed * 1103515245 + 12345;
+            if(blocks[i]) {
+                if(blocks[i][0] != (uint8_t)i) t->failed = true;
+                lv_free(blocks[i]);
+                blocks[i] = NULL;
+            }
+            else {
+                blocks[i] = lv_malloc(1 + (t->seed >> 16) % 300);
+                if(blocks[i] == NULL) {
+                    t->failed = true;
+                    continue;
+                }
+                blocks[i][0] = (uint8_t)i;
+            }
+        }
+    }
+
+    for(uint32_t i = 0; i < SLAB_BLOCK_CNT; i++) lv_free(blocks[i]);
+}
+#endif
+
+void test_mem_slab_threads(void)
+{
+#if LV_USE_MEM_SLAB && LV_USE_OS
+    slab_thread_t threads[SLAB_THREAD_CNT];
+    lv_memzero(threads, sizeof(threads));
+    for(uint32_t i = 0; i < SLAB_THREAD_CNT; i++) {
+        threads[i].seed = i + 1;
+        lv_thread_init(&threads[i].thread, "slab", LV_THREAD_PRIO_MID, slab_thread_cb, 64 * 1024, &threads[i]);
+    }
+
+    for(uint32_t i = 0; i < SLAB_THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i].thread);
+        TEST_ASSERT_FALSE(threads[i].failed);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_OR_EQUAL(mon.slab_size, mon.slab_free_size);
+#endif
+}
+
+void test_mem_slab_alignment(void)
+{
+#if LV_USE_MEM_SLAB
+    /*The size classes and the larger blocks from the heap too*/
+    void * bufs[64];
+    for(uint32_t i = 0; i < 64; i++) {
+        bufs[i] = lv_malloc(1 + i * 7);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)bufs[i] % LV_MEM_SLAB_ALIGN);
+    }
+
+    for(uint32_t i = 0; i < 64; i++) lv_free(bufs[i]);
+#endif
+}
+
+#if LV_USE_MEM_SLAB && LV_USE_OS == LV_OS_PTHREAD
+static uint32_t slab_cache_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_mem_slab_cache_t * cache;
+    for(cache = LV_GLOBAL_DEFAULT()->mem_slab.cache_head; cache; cache = cache->next) cnt++;
+    return cnt;
+}
+#endif
+
+void test_mem_slab_thread_exit(void)
+{
+#if LV_USE_MEM_SLAB && LV_USE_OS == LV_OS_PTHREAD
+    uint32_t cache_cnt = slab_cache_cnt();
+
+    slab_thread_t threads[SLAB_THREAD_CNT];
+    lv_memzero(threads, sizeof(threads));
+    for(uint32_t i = 0; i < SLAB_THREAD_CNT; i++) {
+        threads[i].seed = i + 1;
+        lv_thread_init(&threads[i].thread, "slab", LV_THREAD_PRIO_MID, slab_thread_cb, 64 * 1024, &threads[i]);
+    }
+
+    for(uint32_t i = 0; i < SLAB_THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i].thread);
+        TEST_ASSERT_FALSE(threads[i].failed);
+    }
+
+    /*The caches of the exited threads are given back*/
+    TEST_ASSERT_EQUAL_UINT32(cache_cnt, slab_cache_cnt());
+
+    /*and their free blocks are on the shared lists*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_OR_EQUAL(mon.slab_size, mon.slab_free_size);
+#endif
+}
+
 /* #7573: Test memcpy with unaligned addresses */
 void test_memcpy_unaligned(void)
 {
@@ -0,0 +1,176 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*The search without the hit index*/
+static lv_obj_t * search_obj_linear(lv_obj_t * obj, lv_point_t * point)
+{
+    if(lv_obj_is_hidden(obj)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+
+    lv_area_t obj_coords = obj->coords;
+    if(lv_obj_is_overflow_visible(obj)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+            lv_obj_t * found = search_obj_linear(obj->spec_attr->children[i], &p_trans);
+            if(found) return found;
+        }
+    }
+
+    return hit_test_ok ? obj : NULL;
+}
+
+static void check_all_points(void)
+{
+    lv_refr_now(NULL);
+
+    lv_point_t p;
+    for(p.y = -10; p.y < 320; p.y += 3) {
+        for(p.x = -10; p.x < 420; p.x += 3) {
+            lv_point_t p1 = p;
+            lv_point_t p2 = p;
+            lv_obj_t * expected = search_obj_linear(lv_screen_active(), &p1);
+            lv_obj_t * found = lv_indev_search_obj(lv_screen_active(), &p2);
+            if(expected != found) {
+                TEST_PRINTF("mismatch at %" LV_PRId32 ";%" LV_PRId32, p.x, p.y);
+                TEST_ASSERT_EQUAL_PTR(expected, found);
+            }
+        }
+    }
+}
+
+static void create_buttons(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_size(btn, 30 + (i % 5) * 7, 20 + (i % 3) * 9);
+        lv_obj_set_pos(btn, (int32_t)(i * 37) % 390, (int32_t)(i * 23) % 500);
+        if(i % 4 == 0) lv_obj_set_clickable(btn, false);
+    }
+}
+
+void test_obj_hit_index_same_as_linear_search(void)
+{
+    create_buttons(200);
+    check_all_points();
+
+#if LV_USE_OBJ_HIT_INDEX
+    TEST_ASSERT_NOT_NULL(cont->spec_attr->hit_index);
+    TEST_ASSERT_TRUE(cont->spec_attr->hit_index->valid);
+#endif
+}
+
+void test_obj_hit_index_scroll_and_move(void)
+{
+    create_buttons(200);
+    check_all_points();
+
+    lv_obj_scroll_to_y(cont, 120, LV_ANIM_OFF);
+    check_all_points();
+
+    /*Move the pressed child over the others*/
+    lv_obj_set_pos(lv_obj_get_child(cont, 10), 100, 150);
+    lv_obj_set_size(lv_obj_get_child(cont, 11), 200, 100);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 12), 0);
+    lv_obj_swap(lv_obj_get_child(cont, 13), lv_obj_get_child(cont, 150));
+    check_all_points();
+
+    /*Move the whole container*/
+    lv_obj_set_pos(cont, 20, 10);
+    check_all_points();
+}
+
+void test_obj_hit_index_add_delete_hide(void)
+{
+    create_buttons(100);
+    check_all_points();
+
+    lv_obj_delete(lv_obj_get_child(cont, 30));
+    lv_obj_set_hidden(lv_obj_get_child(cont, 31), true);
+    check_all_points();
+
+    create_buttons(20);
+    check_all_points();
+
+    lv_obj_set_parent(lv_obj_get_child(cont, 5), lv_screen_active());
+    check_all_points();
+}
+
+void test_obj_hit_index_click_area(void)
+{
+    create_buttons(100);
+    check_all_points();
+
+    lv_obj_set_ext_click_area(lv_obj_get_child(cont, 40), 30);
+    check_all_points();
+
+    /*Children out of the button are found only if its overflow is visible*/
+    lv_obj_t * btn = lv_obj_get_child(cont, 41);
+    lv_obj_t * child = lv_obj_create(btn);
+    lv_obj_set_size(child, 80, 80);
+    lv_obj_set_pos(child, 20, 20);
+    check_all_points();
+
+    lv_obj_set_overflow_visible(btn, true);
+    check_all_points();
+
+    lv_obj_set_style_shadow_width(btn, 40, 0);
+    check_all_points();
+}
+
+void test_obj_hit_index_transformed_child(void)
+{
+    create_buttons(100);
+
+    lv_obj_t * btn = lv_obj_get_child(cont, 50);
+    lv_obj_set_size(btn, 150, 40);
+    lv_obj_set_style_transform_rotation(btn, 450, 0);
+    check_all_points();
+
+    lv_obj_set_style_transform_scale(lv_obj_get_child(cont, 60), 512, 0);
+    check_all_points();
+
+    lv_obj_set_style_transform_rotation(btn, 0, 0);
+    check_all_points();
+}
+
+void test_obj_hit_index_flex(void)
+{
+    create_buttons(60);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    check_all_points();
+
+    lv_obj_set_style_pad_column(cont, 15, 0);
+    check_all_points();
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_scroll_to_y(cont, 200, LV_ANIM_OFF);
+    check_all_points();
+}
+
+#endif
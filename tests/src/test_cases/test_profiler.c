@@ -11,6 +11,14 @@
 static uint32_t profiler_tick = 0;
 static int output_line = 0;
 static char output_buf[OUTPUT_LINE_MAX][OUTPUT_BUF_MAX];
+static int profiler_tid = 1;
+static uint8_t bin_buf[256];
+static uint32_t bin_len = 0;
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    static volatile bool writers_exit;
+    static __thread int writer_tid;
+#endif
 
 static uint64_t get_tick_cb(void)
 {
@@ -26,6 +34,49 @@ static void flush_cb(const char * buf)
     output_line++;
 }
 
+static int tid_get_cb(void)
+{
+    return profiler_tid;
+}
+
+static void flush_bin_cb(const void * buf, uint32_t size)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(bin_buf), bin_len + size);
+
+    lv_memcpy(&bin_buf[bin_len], buf, size);
+    bin_len += size;
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+static int writer_tid_get_cb(void)
+{
+    return writer_tid;
+}
+
+static void writer_flush_cb(const char * buf)
+{
+    LV_UNUSED(buf);
+}
+
+static void writer_thread_cb(void * user_data)
+{
+    writer_tid = (int)(lv_uintptr_t)user_data;
+    while(!writers_exit) {
+        LV_PROFILER_BEGIN_TAG("writer");
+        LV_PROFILER_END_TAG("writer");
+    }
+}
+#endif
+
+static void reset_output(void)
+{
+    profiler_tick = 0;
+    output_line = 0;
+    lv_memzero(output_buf, sizeof(output_buf));
+    bin_len = 0;
+    lv_memzero(bin_buf, sizeof(bin_buf));
+}
+
 void setUp(void)
 {
     lv_profiler_builtin_config_t config;
@@ -98,4 +149,118 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+void test_profiler_threads(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    config.tid_get_cb = tid_get_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    reset_output();
+
+    /* each thread writes to its own ring */
+    profiler_tid = 1;
+    LV_PROFILER_BEGIN_TAG("thread_1");
+    profiler_tid = 2;
+    LV_PROFILER_BEGIN_TAG("thread_2");
+    LV_PROFILER_END_TAG("thread_2");
+    profiler_tid = 1;
+    LV_PROFILER_END_TAG("thread_1");
+
+    lv_profiler_builtin_flush();
+
+    /* the rings are flushed one after the other */
+    TEST_ASSERT_EQUAL_INT(4, output_line);
+    TEST_ASSERT_EQUAL_STRING("   LVGL-1 [0] 0.000000000: tracing_mark_write: B|1|thread_1\n", output_buf[0]);
+    TEST_ASSERT_EQUAL_STRING("   LVGL-1 [0] 3.000000000: tracing_mark_write: E|1|thread_1\n", output_buf[1]);
+    TEST_ASSERT_EQUAL_STRING("   LVGL-2 [0] 1.000000000: tracing_mark_write: B|1|thread_2\n", output_buf[2]);
+    TEST_ASSERT_EQUAL_STRING("   LVGL-2 [0] 2.000000000: tracing_mark_write: E|1|thread_2\n", output_buf[3]);
+
+    /* the rings are empty after flushing */
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(4, output_line);
+}
+
+void test_profiler_binary(void)
+{
+    reset_output();
+
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = flush_cb;
+    config.flush_bin_cb = flush_bin_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    /* the header is written by init */
+    static const uint8_t header[] = {'L', 'V', 'P', 'T', 1, 0, 0, 0, 0xE8, 0x03, 0, 0};
+    TEST_ASSERT_EQUAL_UINT32(sizeof(header), bin_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(header, bin_buf, sizeof(header));
+
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    LV_PROFILER_END_TAG("custom_tag");
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+
+    lv_profiler_builtin_flush();
+
+    /* the name is written only once, before its first event */
+    static const uint8_t records[] = {
+        'N', 10, 0, 0, 'c', 'u', 's', 't', 'o', 'm', '_', 't', 'a', 'g',
+        'B', 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        'E', 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        'B', 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    };
+    TEST_ASSERT_EQUAL_UINT32(sizeof(header) + sizeof(records), bin_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(records, &bin_buf[sizeof(header)], sizeof(records));
+
+    /* nothing is written in the text format */
+    TEST_ASSERT_EQUAL_INT(0, output_line);
+}
+
+void test_profiler_uninit_while_writing(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.flush_cb = writer_flush_cb;
+    config.tid_get_cb = writer_tid_get_cb;
+
+    /* replace the context of setUp before the writers start, it has one ring for all the threads
+     * and its flush callback can't be called from the drain thread */
+    lv_profiler_builtin_init(&config);
+
+    writers_exit = false;
+    lv_thread_t threads[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_thread_init(&threads[i], "writer", LV_THREAD_PRIO_MID, writer_thread_cb, 8 * 1024, (void *)(lv_uintptr_t)(i + 1));
+    }
+
+    /* the rings and the context are freed only when no writer uses them */
+    for(i = 0; i < 50; i++) {
+        lv_profiler_builtin_init(&config);
+        lv_sleep_ms(1);
+        lv_profiler_builtin_uninit();
+    }
+
+    writers_exit = true;
+    for(i = 0; i < 4; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->profiler_writer_cnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires LV_USE_OS == LV_OS_PTHREAD");
+#endif
+}
+
 #endif
@@ -0,0 +1,96 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t MEM_SIZE = 0;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 0);
+}
+
+void test_str_intern_same_string_is_shared(void)
+{
+    char path1[] = "A:src/test_assets/test_img_lvgl_logo.png";
+    char path2[] = "A:src/test_assets/test_img_lvgl_logo.png";
+
+    uint32_t str_cnt = LV_GLOBAL_DEFAULT()->str_intern.str_cnt;
+
+    const char * s1 = lv_str_intern(path1);
+    const char * s2 = lv_str_intern(path2);
+    TEST_ASSERT_NOT_NULL(s1);
+    TEST_ASSERT_EQUAL_PTR(s1, s2);
+    TEST_ASSERT_NOT_EQUAL(path1, s1);
+    TEST_ASSERT_EQUAL_STRING(path1, s1);
+    TEST_ASSERT_EQUAL_UINT32(str_cnt + 1, LV_GLOBAL_DEFAULT()->str_intern.str_cnt);
+
+    /*Interning the interned string only adds a reference*/
+    const char * s3 = lv_str_intern(s1);
+    TEST_ASSERT_EQUAL_PTR(s1, s3);
+
+    const char * other = lv_str_intern("A:other.png");
+    TEST_ASSERT_NOT_EQUAL(s1, other);
+    TEST_ASSERT_EQUAL_UINT32(str_cnt + 2, LV_GLOBAL_DEFAULT()->str_intern.str_cnt);
+
+    /*The string is kept until the last reference is released*/
+    lv_str_intern_release(s2);
+    lv_str_intern_release(s3);
+    TEST_ASSERT_EQUAL_STRING(path1, s1);
+    TEST_ASSERT_EQUAL_UINT32(str_cnt + 2, LV_GLOBAL_DEFAULT()->str_intern.str_cnt);
+
+    lv_str_intern_release(s1);
+    lv_str_intern_release(other);
+    lv_str_intern_release(NULL);
+    TEST_ASSERT_EQUAL_UINT32(str_cnt, LV_GLOBAL_DEFAULT()->str_intern.str_cnt);
+}
+
+void test_str_intern_hash(void)
+{
+    /*FNV-1a reference values*/
+    TEST_ASSERT_EQUAL_HEX32(0x811c9dc5, lv_str_hash(""));
+    TEST_ASSERT_EQUAL_HEX32(0xe40c292c, lv_str_hash("a"));
+    TEST_ASSERT_EQUAL_HEX32(0xbf9cf968, lv_str_hash("foobar"));
+
+    const char * s = lv_str_intern("foobar");
+    TEST_ASSERT_EQUAL_HEX32(lv_str_hash("foobar"), lv_str_intern_get_hash(s));
+    lv_str_intern_release(s);
+}
+
+void test_str_intern_image_src(void)
+{
+    const char * path = "A:src/test_assets/test_img_lvgl_logo.png";
+    lv_obj_t * img1 = lv_image_create(lv_screen_active());
+    lv_obj_t * img2 = lv_image_create(lv_screen_active());
+    lv_image_set_src(img1, path);
+    lv_image_set_src(img2, path);
+
+    /*The images share one copy of the path*/
+    TEST_ASSERT_NOT_EQUAL(path, lv_image_get_src(img1));
+    TEST_ASSERT_EQUAL_PTR(lv_image_get_src(img1), lv_image_get_src(img2));
+
+    /*Setting the own source again keeps it*/
+    lv_image_set_src(img1, lv_image_get_src(img1));
+    TEST_ASSERT_EQUAL_STRING(path, lv_image_get_src(img1));
+
+    lv_obj_delete(img1);
+    TEST_ASSERT_EQUAL_STRING(path, lv_image_get_src(img2));
+
+    lv_image_set_src(img2, LV_SYMBOL_OK);
+    TEST_ASSERT_EQUAL_STRING(LV_SYMBOL_OK, lv_image_get_src(img2));
+    lv_obj_delete(img2);
+
+    /*The header cache holds the last reference to the path*/
+    lv_image_header_cache_drop(NULL);
+    lv_image_cache_drop(NULL);
+}
+
+#endif
@@ -201,6 +201,63 @@ void test_style_merge(void)
     lv_style_reset(&merged_style);
 }
 
+void test_style_freeze(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_width(&style, 10);
+    lv_style_set_text_opa(&style, LV_OPA_50);
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    lv_style_set_pad_left(&style, 3);
+    lv_style_set_radius(&style, 5);
+
+    lv_style_freeze(&style);
+
+    lv_style_value_t value;
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_WIDTH, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(10, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_TEXT_OPA, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(LV_OPA_50, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_RADIUS, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(5, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_HEIGHT, &value) == LV_STYLE_RES_NOT_FOUND);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_PROP_INV, &value) == LV_STYLE_RES_NOT_FOUND);
+
+    /*A frozen style can still be modified*/
+    lv_style_set_width(&style, 20);
+    lv_style_set_height(&style, 30);
+    lv_style_set_x(&style, 40);
+    TEST_ASSERT_TRUE(lv_style_remove_prop(&style, LV_STYLE_BG_OPA));
+
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_WIDTH, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(20, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_HEIGHT, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(30, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_X, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(40, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_PAD_LEFT, &value) == LV_STYLE_RES_FOUND);
+    TEST_ASSERT_EQUAL(3, value.num);
+    TEST_ASSERT_TRUE(lv_style_get_prop(&style, LV_STYLE_BG_OPA, &value) == LV_STYLE_RES_NOT_FOUND);
+
+    /*The properties are kept sorted*/
+    lv_style_prop_t * props = (lv_style_prop_t *)style.values_and_props + style.prop_cnt * sizeof(lv_style_value_t);
+    uint32_t i;
+    for(i = 1; i < style.prop_cnt; i++) {
+        TEST_ASSERT_TRUE(props[i - 1] < props[i]);
+    }
+
+    /*The widgets get the same values as with a not frozen style*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL(20, lv_obj_get_style_width(obj, 0));
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_radius(obj, 0));
+    TEST_ASSERT_EQUAL(LV_OPA_50, lv_obj_get_style_text_opa(obj, 0));
+    lv_obj_delete(obj);
+
+    lv_style_reset(&style);
+    TEST_ASSERT_FALSE(style.frozen);
+}
+
 void test_style_has_prop(void)
 {
     lv_style_t style;
@@ -249,4 +306,98 @@ void test_style_remove_theme(void)
     TEST_ASSERT_EQUAL(0, lv_obj_get_style_bg_opa(sw, LV_PART_KNOB));
 }
 
+void test_style_value_cache_invalidation(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_opa(&style, LV_OPA_50);
+    lv_style_set_radius(&style, 5);
+
+    lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_radius(&style_pr, 8);
+
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style, LV_PART_MAIN);
+    lv_obj_add_style(obj, &style_pr, LV_PART_MAIN | LV_STATE_PRESSED);
+
+    /*Read twice to have the values cached*/
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+
+    /*Other state*/
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(8, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Modified shared style*/
+    lv_style_set_radius(&style, 6);
+    lv_style_set_border_width(&style, 3);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(6, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+
+    /*Local style property*/
+    lv_obj_set_style_radius(obj, 7, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_RADIUS, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(6, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Disabled and removed style*/
+    lv_obj_style_set_disabled(obj, &style, LV_PART_MAIN, true);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_style_set_disabled(obj, &style, LV_PART_MAIN, false);
+    TEST_ASSERT_EQUAL(6, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_remove_style(obj, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    /*Inherited property changed on the parent*/
+    lv_obj_set_style_text_letter_space(parent, 2, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(2, lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN));
+    lv_obj_set_style_text_letter_space(parent, 4, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(4, lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN));
+
+    lv_obj_delete(parent);
+    lv_style_reset(&style);
+    lv_style_reset(&style_pr);
+}
+
+void test_style_value_cache_transition(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_bg_opa(&style_pr, LV_OPA_COVER);
+    lv_style_set_transition(&style_pr, &tr);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style_pr, LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_set_style_transition(obj, &tr, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    /*Transitions are started only on rendered widgets*/
+    lv_refr_now(NULL);
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    lv_tick_inc(50);
+    lv_timer_handler();
+    lv_opa_t opa_mid = lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+    TEST_ASSERT_GREATER_THAN(LV_OPA_TRANSP, opa_mid);
+    TEST_ASSERT_LESS_THAN(LV_OPA_COVER, opa_mid);
+
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, lv_obj_get_style_bg_opa(obj, LV_PART_MAIN));
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style_pr);
+}
+
 #endif
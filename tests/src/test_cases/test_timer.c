@@ -0,0 +1,216 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define LOG_SIZE    16
+
+static uint32_t log_buf[LOG_SIZE];
+static uint32_t log_cnt;
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(log_cnt < LOG_SIZE) log_buf[log_cnt] = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(timer);
+    log_cnt++;
+}
+
+static void delete_other_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_t * other = lv_timer_get_user_data(timer);
+    lv_timer_delete(other);
+    lv_timer_set_user_data(timer, NULL);
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_delete(timer);
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    lv_timer_t * new_timer = lv_timer_create(log_cb, 0, (void *)100);
+    lv_timer_set_repeat_count(new_timer, 1);
+}
+
+static lv_timer_t * log_timer_create(uint32_t period, uint32_t id)
+{
+    return lv_timer_create(log_cb, period, (void *)(lv_uintptr_t)id);
+}
+
+/**
+ * Increment the tick and run the timers
+ * @param ms        elapsed milliseconds
+ */
+static void step(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    log_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_timer_order(void)
+{
+    lv_timer_t * t1 = log_timer_create(30, 1);
+    lv_timer_t * t2 = log_timer_create(10, 2);
+    lv_timer_t * t3 = log_timer_create(15, 3);
+
+    /*Only the ready timers run*/
+    step(10);
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[0]);
+
+    /*The timers whose next runs were earlier run first*/
+    log_cnt = 0;
+    step(25);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[2]);
+
+    /*Ready at the same time: the newer timer runs first*/
+    lv_timer_reset(t1);
+    lv_timer_reset(t2);
+    lv_timer_reset(t3);
+    lv_timer_set_period(t2, 30);
+    lv_timer_set_period(t3, 30);
+    log_cnt = 0;
+    step(30);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, log_buf[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_pause_resume_ready(void)
+{
+    lv_timer_t * t1 = log_timer_create(10, 1);
+    lv_timer_t * t2 = log_timer_create(1000, 2);
+
+    lv_timer_pause(t1);
+    step(20);
+    TEST_ASSERT_EQUAL_UINT32(0, log_cnt);
+
+    lv_timer_resume(t1);
+    lv_timer_resume(t1); /*Resuming twice is harmless*/
+    step(0);
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+
+    /*Ready makes a timer with a long period run right away*/
+    lv_timer_ready(t2);
+    step(0);
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[1]);
+
+    /*A shorter period takes effect immediately*/
+    lv_timer_set_period(t2, 5);
+    step(5);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = log_timer_create(10, 1);
+    lv_timer_set_repeat_count(t1, 2);
+
+    lv_timer_t * t2 = log_timer_create(10, 2);
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_set_auto_delete(t2, false);
+
+    step(10);
+    step(10);
+    step(10);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+
+    /*The not auto deleted timer is paused and it can be restarted*/
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_resume(t2);
+    step(10);
+    TEST_ASSERT_EQUAL_UINT32(4, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, log_buf[3]);
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_create_delete_in_cb(void)
+{
+    lv_timer_t * t1 = log_timer_create(10, 1);
+    lv_timer_t * t2 = lv_timer_create(delete_other_cb, 5, t1);
+    lv_timer_create(delete_self_cb, 5, (void *)3);
+    lv_timer_t * t4 = lv_timer_create(create_cb, 5, NULL);
+    lv_timer_set_repeat_count(t4, 1);
+
+    /*t1 is deleted before it's ready, the timer created by t4 runs in the same round*/
+    step(10);
+    TEST_ASSERT_EQUAL_UINT32(3, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, log_buf[0]);
+    TEST_ASSERT_EQUAL_UINT32(100, log_buf[2]);
+
+    step(10);
+    TEST_ASSERT_EQUAL_UINT32(4, log_cnt);
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_zero_period(void)
+{
+    lv_timer_t * t1 = log_timer_create(0, 1);
+
+    /*Run only once in a handler call even if the tick doesn't change*/
+    step(0);
+    TEST_ASSERT_EQUAL_UINT32(1, log_cnt);
+    step(0);
+    TEST_ASSERT_EQUAL_UINT32(2, log_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_get_time_until_next());
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_many(void)
+{
+    /*Check the heap with enough timers to grow it several times*/
+    lv_timer_t * timers[200];
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        timers[i] = lv_timer_create(log_cb, 1000 + (i * 37) % 200, NULL);
+    }
+
+    for(i = 0; i < 200; i += 3) {
+        lv_timer_delete(timers[i]);
+        timers[i] = NULL;
+    }
+
+    step(1200);
+    TEST_ASSERT_EQUAL_UINT32(133, log_cnt);
+
+    /*The remaining time is given by the closest timer*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000, lv_timer_get_time_until_next());
+
+    for(i = 0; i < 200; i++) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+#endif
@@ -1016,4 +1016,51 @@ void test_label_text_trim(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_text_trim.png");
 }
 
+void test_label_line_cache(void)
+{
+    static const char * text =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Cras malesuada ultrices magna in rutrum.\n"
+        "Nunc et lacus et odio ultrices aliquam. Integer vel sapien nec erat suscipit commodo.\n\n"
+        "Aenean vulputate, ligula eget sagittis pharetra, augue dolor hendrerit justo, sit amet iaculis nisi.\n"
+        "Pellentesque habitant morbi tristique senectus et netus et malesuada fames ac turpis egestas.\n"
+        "Donec tincidunt, lorem sed volutpat faucibus, lectus mi gravida lorem, nec mattis nibh dui non est.";
+
+    lv_obj_clean(lv_screen_active());
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_center(cont);
+
+    lv_obj_t * test_label = lv_label_create(cont);
+    lv_obj_set_width(test_label, lv_pct(100));
+    lv_obj_set_style_text_align(test_label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_label_set_text(test_label, text);
+    lv_obj_scroll_to_y(cont, 150, LV_ANIM_OFF);
+
+    /*Drawing from the middle of the text needs to look the same with and without the line cache*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_line_cache.png");
+
+#if LV_LABEL_LINE_CACHE
+    lv_label_t * l = (lv_label_t *)test_label;
+    TEST_ASSERT_TRUE(l->lines.valid);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(8, l->lines.line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, l->lines.lines[0].start);
+    TEST_ASSERT_EQUAL_UINT32(lv_strlen(text), l->lines.lines[l->lines.line_cnt].start);
+    uint32_t line_cnt = l->lines.line_cnt;
+
+    /*The lines are calculated again when the text changes*/
+    lv_label_ins_text(test_label, 0, "First line\n");
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(l->lines.valid);
+    TEST_ASSERT_EQUAL_UINT32(line_cnt + 1, l->lines.line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(lv_strlen("First line\n"), l->lines.lines[1].start);
+
+    /*Short texts don't use it*/
+    lv_label_set_text(test_label, "Short text");
+    lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(l->lines.lines);
+#endif
+}
+
 #endif
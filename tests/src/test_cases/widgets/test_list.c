@@ -120,4 +120,71 @@ void test_list_translation_tag(void)
 
 }
 
+static uint32_t bind_cnt;
+
+static void virtual_item_bind_cb(lv_obj_t * l, lv_obj_t * item, uint32_t index)
+{
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Item %" LV_PRIu32, index);
+    lv_list_set_button_text(l, item, buf);
+    bind_cnt++;
+}
+
+void test_list_virtual(void)
+{
+    lv_obj_clean(lv_screen_active());
+    list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 200, 300);
+    lv_obj_center(list);
+    lv_list_set_item_cb(list, NULL, virtual_item_bind_cb);
+    lv_list_set_item_count(list, 10000);
+    lv_obj_update_layout(list);
+
+    /*Only the visible items have widgets*/
+    TEST_ASSERT_EQUAL_UINT32(10000, lv_list_get_item_count(list));
+    TEST_ASSERT_LESS_THAN_UINT32(20, lv_obj_get_child_count(list));
+
+    lv_obj_t * item = lv_list_get_item(list, 0);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_list_get_item_index(list, item));
+    TEST_ASSERT_NULL(lv_list_get_item(list, 5000));
+
+    /*The content is as high as with all the items*/
+    int32_t pad_row = lv_obj_get_style_pad_row(list, LV_PART_MAIN);
+    int32_t stride = lv_obj_get_height(item) + pad_row;
+    TEST_ASSERT_EQUAL_INT32(10000 * stride - pad_row, lv_obj_get_self_height(list));
+
+    lv_obj_scroll_to_y(list, 5000 * stride, LV_ANIM_OFF);
+    lv_obj_update_layout(list);
+    item = lv_list_get_item(list, 5000);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_STRING("Item 5000", lv_list_get_button_text(list, item));
+    TEST_ASSERT_EQUAL_UINT32(5000, lv_list_get_item_index(list, lv_obj_get_child(item, 0)));
+    TEST_ASSERT_NULL(lv_list_get_item(list, 0));
+
+    lv_area_t content_area;
+    lv_obj_get_content_coords(list, &content_area);
+    TEST_ASSERT_EQUAL_INT32(content_area.y1, item->coords.y1);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/list_virtual.png");
+
+    /*Scrolling by an item reuses only one widget*/
+    bind_cnt = 0;
+    lv_obj_scroll_by(list, 0, -stride, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(1, bind_cnt);
+
+    /*Less items than widgets*/
+    lv_list_set_item_count(list, 3);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_NOT_NULL(lv_list_get_item(list, 0));
+    TEST_ASSERT_NOT_NULL(lv_list_get_item(list, 2));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(list));
+
+    /*The deleted widgets are created again*/
+    lv_obj_clean(list);
+    TEST_ASSERT_NOT_NULL(lv_list_get_item(list, 0));
+
+    lv_list_set_item_cb(list, NULL, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_count(list));
+}
+
 #endif
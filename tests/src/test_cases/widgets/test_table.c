@@ -383,4 +383,82 @@ void test_table_properties(void)
 #endif
 }
 
+static const char * virtual_cell_text_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+
+    /*Every 10th row has 2 lines in the second column*/
+    if(col == 1 && row % 10 == 0) lv_snprintf(buf, sizeof(buf), "Row %" LV_PRIu32 "\nsecond line", row);
+    else lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 ", %" LV_PRIu32, row, col);
+    return buf;
+}
+
+void test_table_virtual_fixed_row_height(void)
+{
+    lv_obj_set_size(table, 300, 200);
+    lv_obj_center(table);
+    lv_table_set_column_count(table, 2);
+    lv_table_set_column_width(table, 0, 120);
+    lv_table_set_column_width(table, 1, 160);
+    lv_table_set_cell_text_cb(table, virtual_cell_text_cb);
+    lv_table_set_virtual_row_height(table, 30, true);
+    lv_table_set_row_count(table, 100000);
+
+    TEST_ASSERT_EQUAL_PTR(virtual_cell_text_cb, lv_table_get_cell_text_cb(table));
+    TEST_ASSERT_EQUAL_STRING("5001, 1", lv_table_get_cell_value(table, 5001, 1));
+
+    /*The cells can't be set in virtual mode*/
+    lv_table_set_cell_value(table, 0, 0, "text");
+    lv_table_set_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+    TEST_ASSERT_EQUAL_STRING("0, 0", lv_table_get_cell_value(table, 0, 0));
+    TEST_ASSERT_FALSE(lv_table_has_cell_ctrl(table, 0, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+    TEST_ASSERT_EQUAL_UINT32(100000, lv_table_get_row_count(table));
+
+    lv_obj_update_layout(table);
+    TEST_ASSERT_EQUAL_INT32(100000 * 30 - 1, lv_obj_get_self_height(table));
+
+    lv_obj_scroll_to_y(table, 50000 * 30, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_virtual.png");
+}
+
+void test_table_virtual_estimated_row_height(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+
+    lv_obj_set_size(table, 300, 200);
+    lv_obj_center(table);
+    lv_table_set_column_count(table, 2);
+    lv_table_set_column_width(table, 0, 120);
+    lv_table_set_column_width(table, 1, 160);
+    lv_table_set_cell_text_cb(table, virtual_cell_text_cb);
+    lv_table_set_row_count(table, 100000);
+    lv_obj_update_layout(table);
+
+    /*Only the visible rows are measured*/
+    int32_t row_h = table_ptr->row_h_def;
+    TEST_ASSERT_TRUE(table_ptr->row_measured[0] & 0x01);
+    TEST_ASSERT_FALSE(table_ptr->row_measured[50000 / 8] & 0x01);
+    TEST_ASSERT_GREATER_THAN_INT32(100000 * row_h - 1, lv_obj_get_self_height(table));
+
+    /*The rows are measured when they are scrolled in*/
+    int32_t self_h = lv_obj_get_self_height(table);
+    lv_obj_scroll_to_y(table, 50000 * row_h, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(table_ptr->row_measured[50000 / 8] & 0x01);
+    TEST_ASSERT_GREATER_THAN_INT32(self_h, lv_obj_get_self_height(table));
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_virtual_estimated.png");
+
+    /*Adding rows keeps the measured heights*/
+    self_h = lv_obj_get_self_height(table);
+    lv_table_set_row_count(table, 100010);
+    TEST_ASSERT_EQUAL_INT32(self_h + 10 * row_h, lv_obj_get_self_height(table));
+
+    /*Store the texts again*/
+    lv_table_set_cell_text_cb(table, NULL);
+    lv_table_set_row_count(table, 2);
+    lv_table_set_cell_value(table, 1, 1, "text");
+    TEST_ASSERT_EQUAL_STRING("text", lv_table_get_cell_value(table, 1, 1));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 0, 0));
+}
+
 #endif
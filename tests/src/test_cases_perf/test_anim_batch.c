@@ -0,0 +1,112 @@
+/* Performance test for running many animations as separate `lv_anim_t`s and as an animation batch */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_ITERATIONS     200
+#define ITEM_CNT            1000
+
+static int32_t vars[ITEM_CNT][2];
+static lv_anim_batch_t * batch;
+
+static void anim_x_cb(void * var, int32_t v)
+{
+    int32_t * p = var;
+    p[0] = v;
+}
+
+static void anim_y_cb(void * var, int32_t v)
+{
+    int32_t * p = var;
+    p[1] = v;
+}
+
+static void batch_exec_cb(lv_anim_batch_t * b, uint32_t index, void * var, const int32_t * values)
+{
+    LV_UNUSED(b);
+    LV_UNUSED(index);
+    int32_t * p = var;
+    p[0] = values[0];
+    p[1] = values[1];
+}
+
+static void step_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+}
+
+/**
+ * Start an x and a y animation for each variable
+ */
+static void anims_start(void)
+{
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, vars[i]);
+        lv_anim_set_duration(&a, 1000 + i);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_set_values(&a, 0, 100000);
+        lv_anim_set_exec_cb(&a, anim_x_cb);
+        lv_anim_start(&a);
+        lv_anim_set_values(&a, 100000, 0);
+        lv_anim_set_exec_cb(&a, anim_y_cb);
+        lv_anim_start(&a);
+    }
+}
+
+/**
+ * Start a batch animating the x and y value of each variable
+ */
+static void batch_start(void)
+{
+    batch = lv_anim_batch_create(2);
+    TEST_ASSERT_NOT_NULL(batch);
+    lv_anim_batch_set_exec_cb(batch, batch_exec_cb);
+    lv_anim_batch_set_path_cb(batch, lv_anim_path_ease_in_out);
+    lv_anim_batch_set_repeat_count(batch, LV_ANIM_REPEAT_INFINITE);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        int32_t index = lv_anim_batch_add(batch, vars[i], 1000 + i, 0);
+        lv_anim_batch_set_values(batch, index, 0, 0, 100000);
+        lv_anim_batch_set_values(batch, index, 1, 100000, 0);
+    }
+    lv_anim_batch_start(batch);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+    if(batch) {
+        lv_anim_batch_delete(batch);
+        batch = NULL;
+    }
+}
+
+void test_anim_batch_step(void)
+{
+    lv_test_perf_stats_t anims;
+    lv_test_perf_stats_t batched;
+
+    anims_start();
+    lv_test_perf_run("animation step, 2 x 1000 lv_anim_t", step_cb, NULL, TEST_ITERATIONS, &anims);
+    lv_anim_delete_all();
+
+    batch_start();
+    lv_test_perf_run("animation step, 1000 items x 2 channels batch", step_cb, NULL, TEST_ITERATIONS, &batched);
+
+    /*The same values with less work*/
+    TEST_ASSERT_LESS_THAN_UINT64(anims.median_ns, batched.median_ns);
+}
+
+#endif
@@ -0,0 +1,153 @@
+/* Performance test for rendering large draw tasks in bands on the software draw threads.
+ * Build with `OPTIONS_TEST_PERF_DRAW_UNITS` to have more than one draw thread.*/
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+#include <unistd.h>
+
+#define TEST_ITERATIONS     50
+#define TEST_W              800
+#define TEST_H              480
+
+static lv_layer_t layer;
+static lv_draw_buf_t * img_buf;
+
+static const lv_area_t area = {0, 0, TEST_W - 1, TEST_H - 1};
+
+/**
+ * The bands can be rendered in parallel only if there are enough CPU cores
+ * @return  true: the draw units should be faster than a single thread
+ */
+static bool bands_are_parallel(void)
+{
+    return LV_DRAW_SW_DRAW_UNIT_CNT > 1 && sysconf(_SC_NPROCESSORS_ONLN) >= LV_DRAW_SW_DRAW_UNIT_CNT;
+}
+
+/**
+ * Wait until the draw units render all the draw tasks of the layer
+ */
+static void render_layer(void)
+{
+    layer.all_tasks_added = true;
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch_layer(NULL, &layer);
+    }
+    layer.all_tasks_added = false;
+}
+
+static void fill_init(lv_draw_fill_dsc_t * dsc)
+{
+    lv_draw_fill_dsc_init(dsc);
+    dsc->color = lv_color_hex(0x2040a0);
+    dsc->opa = LV_OPA_50;
+}
+
+static void image_init(lv_draw_image_dsc_t * dsc)
+{
+    lv_draw_image_dsc_init(dsc);
+    dsc->src = img_buf;
+    dsc->opa = LV_OPA_50;
+}
+
+/**
+ * Render a draw task directly on the calling thread
+ */
+static void draw_task_directly(lv_draw_task_type_t type, void * draw_dsc)
+{
+    lv_draw_task_t t;
+    lv_memzero(&t, sizeof(t));
+    t.type = type;
+    t.area = area;
+    t._real_area = area;
+    t.clip_area = area;
+    t.target_layer = &layer;
+    t.draw_dsc = draw_dsc;
+
+    if(type == LV_DRAW_TASK_TYPE_FILL) lv_draw_sw_fill(&t, draw_dsc, &area);
+    else lv_draw_sw_image(&t, draw_dsc, &area);
+}
+
+static void fill_single_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_fill_dsc_t dsc;
+    fill_init(&dsc);
+    draw_task_directly(LV_DRAW_TASK_TYPE_FILL, &dsc);
+}
+
+static void fill_draw_units_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_fill_dsc_t dsc;
+    fill_init(&dsc);
+    lv_draw_fill(&layer, &dsc, &area);
+    render_layer();
+}
+
+static void image_single_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_image_dsc_t dsc;
+    image_init(&dsc);
+    draw_task_directly(LV_DRAW_TASK_TYPE_IMAGE, &dsc);
+}
+
+static void image_draw_units_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_image_dsc_t dsc;
+    image_init(&dsc);
+    lv_draw_image(&layer, &dsc, &area);
+    render_layer();
+}
+
+void setUp(void)
+{
+    lv_layer_init(&layer);
+    layer.draw_buf = lv_draw_buf_create(TEST_W, TEST_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(layer.draw_buf);
+    lv_draw_buf_clear(layer.draw_buf, NULL);
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = area;
+    layer._clip_area = area;
+    layer.phy_clip_area = area;
+
+    img_buf = lv_draw_buf_create(TEST_W, TEST_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(img_buf);
+    lv_draw_buf_clear(img_buf, NULL);
+}
+
+void tearDown(void)
+{
+    lv_draw_buf_destroy(layer.draw_buf);
+    layer.draw_buf = NULL;
+    lv_draw_buf_destroy(img_buf);
+    img_buf = NULL;
+}
+
+void test_draw_fill_in_bands(void)
+{
+    lv_test_perf_stats_t single;
+    lv_test_perf_stats_t units;
+
+    lv_test_perf_run("fill 800x480, single thread", fill_single_thread_cb, NULL, TEST_ITERATIONS, &single);
+    lv_test_perf_run("fill 800x480, draw units", fill_draw_units_cb, NULL, TEST_ITERATIONS, &units);
+
+    /*The bands are rendered in parallel*/
+    if(bands_are_parallel()) TEST_ASSERT_LESS_THAN_UINT64(single.median_ns, units.median_ns);
+}
+
+void test_draw_image_in_bands(void)
+{
+    lv_test_perf_stats_t single;
+    lv_test_perf_stats_t units;
+
+    lv_test_perf_run("image 800x480, single thread", image_single_thread_cb, NULL, TEST_ITERATIONS, &single);
+    lv_test_perf_run("image 800x480, draw units", image_draw_units_cb, NULL, TEST_ITERATIONS, &units);
+
+    if(bands_are_parallel()) TEST_ASSERT_LESS_THAN_UINT64(single.median_ns, units.median_ns);
+}
+
+#endif
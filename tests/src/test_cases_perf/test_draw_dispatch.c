@@ -0,0 +1,165 @@
+/* Performance test for adding draw tasks and finding the available ones */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_DRAW_UNIT_ID   1
+#define TEST_THREAD_CNT     4
+#define TEST_ITERATIONS     50
+
+static lv_layer_t layer;
+
+/**
+ * Add small draw tasks to the layer row by row.
+ * @param cnt       number of draw tasks to add
+ * @param size      width and height of the draw tasks
+ */
+static void add_tasks(uint32_t cnt, int32_t size)
+{
+    int32_t col_cnt = lv_area_get_width(&layer.buf_area) / size;
+    int32_t row_cnt = lv_area_get_height(&layer.buf_area) / size;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t a;
+        a.x1 = (int32_t)(i % col_cnt) * size;
+        a.y1 = (int32_t)((i / col_cnt) % row_cnt) * size;
+        a.x2 = a.x1 + size - 1;
+        a.y2 = a.y1 + size - 1;
+        lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    }
+}
+
+/**
+ * Dispatch the draw tasks as a draw unit with `TEST_THREAD_CNT` threads would do.
+ */
+static void dispatch_tasks(void)
+{
+    while(layer.draw_task_head) {
+        lv_draw_task_t * t = NULL;
+        uint32_t i;
+        for(i = 0; i < TEST_THREAD_CNT; i++) {
+            t = lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID);
+            if(t == NULL) break;
+            t->state = LV_DRAW_TASK_STATE_FINISHED;
+        }
+        lv_draw_dispatch_layer(NULL, &layer);
+    }
+}
+
+/**
+ * Take all the draw tasks which are available at once, as if there were unlimited draw threads.
+ */
+static void take_all_tasks(void)
+{
+    lv_draw_task_t * t = NULL;
+    while((t = lv_draw_get_next_available_task(&layer, t, TEST_DRAW_UNIT_ID)) != NULL) {
+        t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    }
+}
+
+/**
+ * Mark all the draw tasks finished and remove them from the layer
+ */
+static void finish_all_tasks(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+/**
+ * Measure adding and dispatching `cnt` draw tasks and return the median time of a task in each case
+ * @param cnt           number of draw tasks
+ * @param add_ns        store the time of adding a task here
+ * @param dispatch_ns   store the time of dispatching a task here
+ */
+static void measure(uint32_t cnt, uint64_t * add_ns, uint64_t * dispatch_ns)
+{
+    /*The samples keep only a pointer to the name*/
+    char add_name[64];
+    char dispatch_name[64];
+    lv_test_perf_samples_t add;
+    lv_test_perf_samples_t dispatch;
+
+    lv_snprintf(add_name, sizeof(add_name), "add %" LV_PRIu32 " draw tasks", cnt);
+    lv_test_perf_samples_init(&add, add_name);
+    lv_snprintf(dispatch_name, sizeof(dispatch_name), "dispatch %" LV_PRIu32 " draw tasks", cnt);
+    lv_test_perf_samples_init(&dispatch, dispatch_name);
+
+    uint32_t i;
+    for(i = 0; i < TEST_ITERATIONS; i++) {
+        lv_test_perf_sample_begin(&add);
+        add_tasks(cnt, 8);
+        lv_test_perf_sample_end(&add);
+
+        lv_test_perf_sample_begin(&dispatch);
+        dispatch_tasks();
+        lv_test_perf_sample_end(&dispatch);
+    }
+
+    lv_test_perf_stats_t stats;
+    lv_test_perf_samples_report(&add, &stats);
+    *add_ns = stats.median_ns / cnt;
+    lv_test_perf_samples_report(&dispatch, &stats);
+    *dispatch_ns = stats.median_ns / cnt;
+}
+
+void setUp(void)
+{
+    lv_layer_init(&layer);
+    lv_area_set(&layer.buf_area, 0, 0, 799, 479);
+    layer._clip_area = layer.buf_area;
+    layer.phy_clip_area = layer.buf_area;
+}
+
+void tearDown(void)
+{
+    finish_all_tasks();
+
+    /*The software renderer might have drawn some tasks too*/
+    if(layer.draw_buf) {
+        lv_draw_buf_destroy(layer.draw_buf);
+        layer.draw_buf = NULL;
+    }
+}
+
+void test_add_5000_draw_tasks(void)
+{
+    TEST_ASSERT_MAX_TIME(add_tasks, 40, 5000, 8);
+}
+
+void test_dispatch_5000_draw_tasks(void)
+{
+    add_tasks(5000, 8);
+    TEST_ASSERT_MAX_TIME(dispatch_tasks, 50, );
+}
+
+void test_find_independent_draw_tasks(void)
+{
+    add_tasks(5000, 8);
+    TEST_ASSERT_MAX_TIME(take_all_tasks, 300, );
+}
+
+void test_draw_task_cost_scaling(void)
+{
+    uint64_t add_100, dispatch_100;
+    uint64_t add_1k, dispatch_1k;
+    uint64_t add_5k, dispatch_5k;
+
+    measure(100, &add_100, &dispatch_100);
+    measure(1000, &add_1k, &dispatch_1k);
+    measure(5000, &add_5k, &dispatch_5k);
+
+    /*The cost of a task shouldn't grow with the number of tasks.
+     *Allow some growth for the caches and a constant for the timer resolution.*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(add_100 * 3 + 100, add_1k);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(add_100 * 3 + 100, add_5k);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(dispatch_100 * 3 + 100, dispatch_1k);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(dispatch_100 * 3 + 100, dispatch_5k);
+}
+
+#endif
@@ -0,0 +1,108 @@
+/* Performance test for the glyph and glyph id caches of the built-in fonts */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_ITERATIONS     100
+
+static const char * long_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. "
+    "Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis "
+    "vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit "
+    "tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae.\n";
+
+static const char * cjk_text =
+    "嵌入式图形库提供了创建美观的用户界面所需的一切，包括易于使用的图形元素、漂亮的视觉效果和低内存占用。"
+    "它可以在任何微控制器和显示器上运行，并且支持多种输入设备，例如触摸板、鼠标、键盘和编码器。\n";
+
+static lv_obj_t * label;
+
+/**
+ * Measure rendering the label. With empty caches only the letters repeated in the text are cached,
+ * without caching (`LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0`) all the numbers are similar to the cold ones.
+ * @param name          name of the measurement
+ * @param invalidate    true: drop the cached glyphs before each render
+ * @param stats         store the statistics here
+ */
+static void measure_render(const char * name, bool invalidate, lv_test_perf_stats_t * stats)
+{
+    lv_test_perf_samples_t samples;
+    lv_test_perf_samples_init(&samples, name);
+
+    /*Warm up*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < TEST_ITERATIONS; i++) {
+        if(invalidate) lv_font_fmt_txt_cache_invalidate();
+        lv_obj_invalidate(label);
+        lv_test_perf_sample_begin(&samples);
+        lv_refr_now(NULL);
+        lv_test_perf_sample_end(&samples);
+    }
+
+    lv_test_perf_samples_report(&samples, stats);
+}
+
+static void text_get_size_cb(void * user_data)
+{
+    const lv_font_t * font = user_data;
+    lv_point_t size;
+    lv_text_get_size(&size, cjk_text, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_GREATER_THAN(0, size.y);
+}
+
+static void text_get_size_cold_cb(void * user_data)
+{
+    lv_font_fmt_txt_cache_invalidate();
+    text_get_size_cb(user_data);
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, 300);
+    lv_label_set_text(label, long_text);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_font_fmt_txt_cache_invalidate();
+}
+
+#if LV_FONT_MONTSERRAT_28_COMPRESSED
+void test_font_cache_compressed_render(void)
+{
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+
+    lv_test_perf_stats_t cold;
+    lv_test_perf_stats_t warm;
+    measure_render("compressed label render, cold cache", true, &cold);
+    measure_render("compressed label render, warm cache", false, &warm);
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    TEST_ASSERT_LESS_THAN_UINT64(cold.median_ns, warm.median_ns);
+#endif
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(50 * 1000, cold.median_ns / 1000);
+}
+#endif
+
+#if LV_FONT_SOURCE_HAN_SANS_SC_14_CJK
+void test_font_cache_cjk_text_size(void)
+{
+    /*The CJK characters are looked up with a binary search in a large sparse character map*/
+    lv_test_perf_stats_t cold;
+    lv_test_perf_stats_t warm;
+    lv_test_perf_run("CJK text size, cold cache", text_get_size_cold_cb,
+                     (void *)&lv_font_source_han_sans_sc_14_cjk, TEST_ITERATIONS, &cold);
+    lv_test_perf_run("CJK text size, warm cache", text_get_size_cb,
+                     (void *)&lv_font_source_han_sans_sc_14_cjk, TEST_ITERATIONS, &warm);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(5 * 1000, cold.median_ns / 1000);
+}
+#endif
+
+#endif
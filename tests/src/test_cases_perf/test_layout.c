@@ -0,0 +1,87 @@
+/* Performance test for recalculating the flex and grid layouts */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_CHILD_CNT      200
+#define TEST_ITERATIONS     50
+
+static lv_obj_t * cont;
+
+static void fill_cont(void)
+{
+    uint32_t i;
+    for(i = 0; i < TEST_CHILD_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        lv_obj_set_size(obj, 40 + (i % 7) * 5, 30 + (i % 3) * 10);
+    }
+}
+
+static void relayout_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Changing the padding invalidates the layout of all children*/
+    static int32_t pad = 0;
+    pad = (pad + 1) % 4;
+    lv_obj_set_style_pad_row(cont, pad, 0);
+    lv_obj_update_layout(cont);
+}
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_layout_flex_row_wrap(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_START);
+    fill_cont();
+
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("flex row wrap", relayout_cb, NULL, TEST_ITERATIONS, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20 * 1000, stats.median_ns / 1000);
+}
+
+void test_layout_flex_grow(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    fill_cont();
+    uint32_t i;
+    for(i = 0; i < TEST_CHILD_CNT; i += 2) {
+        lv_obj_set_flex_grow(lv_obj_get_child(cont, i), 1);
+    }
+
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("flex column grow", relayout_cb, NULL, TEST_ITERATIONS, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20 * 1000, stats.median_ns / 1000);
+}
+
+void test_layout_grid(void)
+{
+    static const int32_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_FR(2), LV_GRID_CONTENT, LV_GRID_FR(1), 60, LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[TEST_CHILD_CNT / 5 + 1];
+    uint32_t i;
+    for(i = 0; i < TEST_CHILD_CNT / 5; i++) row_dsc[i] = LV_GRID_CONTENT;
+    row_dsc[TEST_CHILD_CNT / 5] = LV_GRID_TEMPLATE_LAST;
+
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    fill_cont();
+    for(i = 0; i < TEST_CHILD_CNT; i++) {
+        lv_obj_set_grid_cell(lv_obj_get_child(cont, i), LV_GRID_ALIGN_STRETCH, i % 5, 1,
+                             LV_GRID_ALIGN_CENTER, i / 5, 1);
+    }
+
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("grid 5 columns", relayout_cb, NULL, TEST_ITERATIONS, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20 * 1000, stats.median_ns / 1000);
+}
+#endif
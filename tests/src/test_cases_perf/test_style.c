@@ -0,0 +1,103 @@
+/* Performance test for getting the style properties of widgets */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+#include <time.h>
+
+#define TEST_LOOKUP_ROUNDS  20000
+
+static lv_obj_t * btn;
+
+/*The properties read when drawing a button*/
+static const lv_style_prop_t btn_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_BG_GRAD_DIR,
+    LV_STYLE_BG_MAIN_STOP, LV_STYLE_BG_GRAD_STOP, LV_STYLE_BG_IMAGE_SRC, LV_STYLE_RADIUS,
+    LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA, LV_STYLE_BORDER_SIDE,
+    LV_STYLE_OUTLINE_WIDTH, LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_PAD, LV_STYLE_SHADOW_WIDTH,
+    LV_STYLE_SHADOW_COLOR, LV_STYLE_SHADOW_OFFSET_X, LV_STYLE_SHADOW_OFFSET_Y, LV_STYLE_SHADOW_SPREAD,
+    LV_STYLE_SHADOW_OPA, LV_STYLE_OPA, LV_STYLE_OPA_LAYERED, LV_STYLE_BLEND_MODE,
+    LV_STYLE_TRANSFORM_ROTATION, LV_STYLE_TRANSFORM_SCALE_X, LV_STYLE_TRANSFORM_SCALE_Y,
+    LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_OPA, LV_STYLE_PAD_TOP, LV_STYLE_PAD_LEFT,
+};
+
+#define BTN_PROP_CNT (sizeof(btn_props) / sizeof(btn_props[0]))
+
+static void get_btn_props(lv_obj_t * obj, lv_part_t part, uint32_t rounds)
+{
+    uint32_t r;
+    for(r = 0; r < rounds; r++) {
+        uint32_t i;
+        for(i = 0; i < BTN_PROP_CNT; i++) {
+            volatile lv_style_value_t v = lv_obj_get_style_prop(obj, part, btn_props[i]);
+            LV_UNUSED(v);
+        }
+    }
+}
+
+static void get_btn_props_cb(void * user_data)
+{
+    get_btn_props(user_data, LV_PART_MAIN, 100);
+}
+
+static void print_lookups_per_sec(const char * name, clock_t t)
+{
+    double sec = (double)t / CLOCKS_PER_SEC;
+    double lookups = (double)TEST_LOOKUP_ROUNDS * BTN_PROP_CNT;
+    uint32_t k_per_sec = sec > 0 ? (uint32_t)(lookups / sec / 1000.0) : 0;
+    TEST_PRINTF("%s: %u k lookups/s", name, (unsigned int)k_per_sec);
+}
+
+void setUp(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_t * label_parent = lv_obj_create(cont);
+    btn = lv_button_create(label_parent);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Button");
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_style_lookup_main(void)
+{
+    clock_t start = clock();
+    get_btn_props(btn, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+    print_lookups_per_sec("button main", clock() - start);
+
+    TEST_ASSERT_MAX_TIME(get_btn_props, 150, btn, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+}
+
+void test_style_lookup_pressed(void)
+{
+    lv_obj_add_state(btn, LV_STATE_PRESSED | LV_STATE_FOCUSED);
+
+    clock_t start = clock();
+    get_btn_props(btn, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+    print_lookups_per_sec("button pressed", clock() - start);
+
+    TEST_ASSERT_MAX_TIME(get_btn_props, 150, btn, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+}
+
+void test_style_lookup_inherited(void)
+{
+    /*The text properties are inherited from the parents*/
+    lv_obj_t * label = lv_obj_get_child(btn, 0);
+
+    clock_t start = clock();
+    get_btn_props(label, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+    print_lookups_per_sec("label in button", clock() - start);
+
+    TEST_ASSERT_MAX_TIME(get_btn_props, 200, label, LV_PART_MAIN, TEST_LOOKUP_ROUNDS);
+}
+
+void test_style_lookup_stats(void)
+{
+    lv_obj_t * label = lv_obj_get_child(btn, 0);
+    lv_test_perf_run("button main, 100 rounds", get_btn_props_cb, btn, 200, NULL);
+    lv_test_perf_run("label in button, 100 rounds", get_btn_props_cb, label, 200, NULL);
+}
+#endif
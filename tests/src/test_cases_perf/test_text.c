@@ -0,0 +1,87 @@
+/* Performance test for measuring and wrapping text */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_ITERATIONS     100
+
+static const char * long_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. "
+    "Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis "
+    "vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit "
+    "tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae.\n"
+    "Árvíztűrő tükörfúrógép, Größe, Ñandú, Œuvre, ½ + ¼ = ¾ 123456789 (!?) [#] {%}\n";
+
+static lv_obj_t * label;
+
+static void text_get_size_cb(void * user_data)
+{
+    int32_t max_width = (int32_t)(lv_uintptr_t)user_data;
+    lv_point_t size;
+    lv_text_get_size(&size, long_text, LV_FONT_DEFAULT, 0, 0, max_width, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_GREATER_THAN(0, size.y);
+}
+
+static void label_set_text_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*Setting the text again measures and wraps it*/
+    lv_label_set_text(label, long_text);
+    lv_obj_update_layout(label);
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, 300);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_text_get_size_single_line(void)
+{
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("text size, no wrap", text_get_size_cb, (void *)(lv_uintptr_t)LV_COORD_MAX, TEST_ITERATIONS,
+                     &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(5 * 1000, stats.median_ns / 1000);
+}
+
+void test_text_get_size_wrapped(void)
+{
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("text size, wrapped", text_get_size_cb, (void *)(lv_uintptr_t)200, TEST_ITERATIONS, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(5 * 1000, stats.median_ns / 1000);
+}
+
+void test_text_label_wrap(void)
+{
+    lv_test_perf_stats_t stats;
+    lv_test_perf_run("label set text", label_set_text_cb, NULL, TEST_ITERATIONS, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(10 * 1000, stats.median_ns / 1000);
+}
+
+void test_text_label_draw(void)
+{
+    lv_label_set_text(label, long_text);
+
+    lv_test_perf_samples_t samples;
+    lv_test_perf_samples_init(&samples, "label render");
+
+    uint32_t i;
+    for(i = 0; i < TEST_ITERATIONS; i++) {
+        lv_obj_invalidate(label);
+        lv_test_perf_sample_begin(&samples);
+        lv_refr_now(NULL);
+        lv_test_perf_sample_end(&samples);
+    }
+
+    lv_test_perf_stats_t stats;
+    lv_test_perf_samples_report(&samples, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20 * 1000, stats.median_ns / 1000);
+}
+#endif
@@ -0,0 +1,114 @@
+/* Performance test for running the timers with many idle timers */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_ITERATIONS     200
+#define CHURN_CNT           100
+
+static lv_timer_t ** timers;
+static uint32_t timer_cnt;
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+}
+
+/**
+ * Create timers with long, different periods, which are not ready during the test
+ * @param cnt       number of timers to create
+ */
+static void timers_create(uint32_t cnt)
+{
+    timers = lv_malloc(cnt * sizeof(lv_timer_t *));
+    TEST_ASSERT_NOT_NULL(timers);
+    timer_cnt = cnt;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        timers[i] = lv_timer_create(timer_cb, 1000000 + i, NULL);
+    }
+}
+
+static void timers_delete(void)
+{
+    uint32_t i;
+    for(i = 0; i < timer_cnt; i++) {
+        lv_timer_delete(timers[i]);
+    }
+    lv_free(timers);
+    timers = NULL;
+    timer_cnt = 0;
+}
+
+static void handler_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_tick_inc(1);
+    lv_timer_handler();
+}
+
+/**
+ * Create short living timers, e.g. `lv_async_call()`s, and run them
+ */
+static void churn_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    uint32_t i;
+    for(i = 0; i < CHURN_CNT; i++) {
+        lv_timer_t * t = lv_timer_create(timer_cb, 0, NULL);
+        lv_timer_set_repeat_count(t, 1);
+    }
+    lv_timer_handler();
+}
+
+/**
+ * Measure a timer handler call and creating and running short timers among `cnt` idle timers
+ * @param cnt       number of idle timers
+ * @param handler   store the statistics of the handler calls here
+ * @param churn     store the statistics of the short timers here
+ */
+static void measure(uint32_t cnt, lv_test_perf_stats_t * handler, lv_test_perf_stats_t * churn)
+{
+    char name[64];
+    timers_create(cnt);
+
+    lv_snprintf(name, sizeof(name), "timer handler, %" LV_PRIu32 " idle timers", cnt);
+    lv_test_perf_run(name, handler_cb, NULL, TEST_ITERATIONS, handler);
+
+    lv_snprintf(name, sizeof(name), "%d short timers, %" LV_PRIu32 " idle timers", CHURN_CNT, cnt);
+    lv_test_perf_run(name, churn_cb, NULL, TEST_ITERATIONS, churn);
+
+    timers_delete();
+}
+
+void setUp(void)
+{
+    lv_timer_handler();
+}
+
+void tearDown(void)
+{
+    if(timers) timers_delete();
+}
+
+void test_timer_handler_scaling(void)
+{
+    lv_test_perf_stats_t handler_10;
+    lv_test_perf_stats_t handler_1k;
+    lv_test_perf_stats_t handler_10k;
+    lv_test_perf_stats_t churn_10;
+    lv_test_perf_stats_t churn_1k;
+    lv_test_perf_stats_t churn_10k;
+
+    measure(10, &handler_10, &churn_10);
+    measure(1000, &handler_1k, &churn_1k);
+    measure(10000, &handler_10k, &churn_10k);
+
+    /*Only the ready timers are touched so the idle ones cost almost nothing*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(handler_10.median_ns * 4 + 2000, handler_10k.median_ns);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(churn_10.median_ns * 4 + 20000, churn_10k.median_ns);
+}
+
+#endif
@@ -0,0 +1,102 @@
+/* Measure the frame times of the scenes of the benchmark demo on the host */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "../demos/lv_demos.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+#include <stdlib.h>
+
+#if LV_USE_DEMO_BENCHMARK
+
+/*Stop after this many ticks even if the demo hasn't ended*/
+#define TEST_TICK_LIMIT     (5 * 60 * 1000)
+
+static lv_demo_benchmark_scene_dsc_t * scenes;
+
+static void benchmark_end_cb(const lv_demo_benchmark_summary_t * summary)
+{
+    scenes = summary->scenes;
+}
+
+void setUp(void)
+{
+    scenes = NULL;
+}
+
+void tearDown(void)
+{
+    lv_demo_benchmark_set_end_cb(NULL);
+    lv_anim_delete_all();
+    lv_obj_clean(lv_layer_top());
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_benchmark_scenes(void)
+{
+    lv_test_perf_samples_t frames;
+    lv_test_perf_samples_init(&frames, "all scenes");
+
+    /*The elapsed ticks at the start of each frame to find its scene later*/
+    uint32_t * frame_ticks = NULL;
+    uint32_t elapsed = 0;
+
+    lv_demo_benchmark_set_end_cb(benchmark_end_cb);
+    lv_demo_benchmark();
+
+    while(scenes == NULL && elapsed < TEST_TICK_LIMIT) {
+        if(frames.cnt % 64 == 0) {
+            frame_ticks = realloc(frame_ticks, (frames.cnt + 64) * sizeof(uint32_t));
+            TEST_ASSERT_NOT_NULL(frame_ticks);
+        }
+        frame_ticks[frames.cnt] = elapsed;
+
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        elapsed += LV_DEF_REFR_PERIOD;
+
+        lv_test_perf_sample_begin(&frames);
+        lv_timer_handler();
+        lv_test_perf_sample_end(&frames);
+    }
+
+    TEST_ASSERT_NOT_NULL_MESSAGE(scenes, "The benchmark hasn't finished");
+
+    /*The frame which loads a scene is the first frame of that scene*/
+    uint32_t scene_start = 0;
+    uint32_t f = 0;
+    uint32_t i;
+    for(i = 0; scenes[i].create_cb; i++) {
+        uint32_t scene_end = scene_start + scenes[i].scene_time;
+        lv_test_perf_samples_t scene_samples;
+        lv_test_perf_samples_init(&scene_samples, scenes[i].name);
+        while(f < frames.cnt && frame_ticks[f] < scene_end) {
+            lv_test_perf_sample_add(&scene_samples, frames.time_ns[f], frames.instructions[f]);
+            f++;
+        }
+
+        TEST_ASSERT_GREATER_THAN(0, scene_samples.cnt);
+        lv_test_perf_samples_report(&scene_samples, NULL);
+        scene_start = scene_end;
+    }
+
+    free(frame_ticks);
+    lv_test_perf_samples_report(&frames, NULL);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_benchmark_scenes(void)
+{
+    TEST_IGNORE_MESSAGE("LV_USE_DEMO_BENCHMARK is not enabled");
+}
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
+
+#endif
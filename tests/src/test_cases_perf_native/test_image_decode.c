@@ -0,0 +1,63 @@
+/* Measure decoding PNG and JPG images on the host */
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+#include "lv_test_perf.h"
+
+#define TEST_ITERATIONS     50
+
+extern const lv_image_dsc_t test_img_lvgl_logo_png;
+extern const lv_image_dsc_t test_img_lvgl_logo_jpg;
+
+static void decode_cb(void * user_data)
+{
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.no_cache = true;
+
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, user_data, &args);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+
+    /*Decoders without a full frame buffer decode the image area by area*/
+    if(dsc.decoded == NULL) {
+        lv_area_t full_area;
+        lv_area_set(&full_area, 0, 0, dsc.header.w - 1, dsc.header.h - 1);
+        lv_area_t decoded_area;
+        decoded_area.y1 = LV_COORD_MIN;
+        do {
+            res = lv_image_decoder_get_area(&dsc, &full_area, &decoded_area);
+            TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+        } while(decoded_area.x2 < full_area.x2 || decoded_area.y2 < full_area.y2);
+    }
+
+    TEST_ASSERT_NOT_NULL(dsc.decoded);
+    lv_image_decoder_close(&dsc);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_image_decode_png(void)
+{
+#if LV_USE_LODEPNG || LV_USE_LIBPNG
+    lv_test_perf_run("decode png", decode_cb, (void *)&test_img_lvgl_logo_png, TEST_ITERATIONS, NULL);
+#else
+    TEST_IGNORE_MESSAGE("No PNG decoder is enabled");
+#endif
+}
+
+void test_image_decode_jpg(void)
+{
+#if LV_USE_TJPGD || LV_USE_LIBJPEG_TURBO
+    lv_test_perf_run("decode jpg", decode_cb, (void *)&test_img_lvgl_logo_jpg, TEST_ITERATIONS, NULL);
+#else
+    TEST_IGNORE_MESSAGE("No JPG decoder is enabled");
+#endif
+}
+#endif